@@ -0,0 +1,69 @@
+#ifndef __ALIOTH_BENCH_H__
+#define __ALIOTH_BENCH_H__
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "aliox/grammar.h"
+#include "fmt/format.h"
+
+namespace alioth::bench {
+
+/**
+ * 基准测试用例
+ */
+struct Case {
+  std::string name{};
+  std::function<void()> run{};
+};
+
+/**
+ * 获取全部已注册的基准测试用例
+ */
+std::vector<Case>& Cases();
+
+/**
+ * 注册基准测试用例，供 BENCH 宏使用
+ */
+struct Registrar {
+  Registrar(std::string const& name, std::function<void()> run);
+};
+
+/**
+ * 随仓库发布的文法文件，路径相对于 AliothHome
+ */
+std::vector<std::string> const& Grammars();
+
+/**
+ * 加载随仓库发布的文法文件
+ *
+ * @param path 相对于 AliothHome 的文法路径
+ */
+Grammar LoadGrammar(std::string const& path);
+
+/**
+ * 重复执行函数，返回单次执行的平均耗时，单位为毫秒
+ *
+ * @param repeat 重复次数
+ * @param fn 被测函数
+ */
+template <typename F>
+double Measure(size_t repeat, F&& fn) {
+  auto const start = std::chrono::steady_clock::now();
+  for (auto i = 0UL; i < repeat; ++i) fn();
+  auto const end = std::chrono::steady_clock::now();
+  std::chrono::duration<double, std::milli> elapsed = end - start;
+  return elapsed.count() / repeat;
+}
+
+}  // namespace alioth::bench
+
+#define BENCH(suite, name)                                               \
+  static void Bench_##suite##_##name();                                  \
+  static ::alioth::bench::Registrar const bench_##suite##_##name{        \
+      #suite "." #name, &Bench_##suite##_##name};                        \
+  static void Bench_##suite##_##name()
+
+#endif
@@ -0,0 +1,197 @@
+#include <algorithm>
+
+#include "alioth/lexicon.h"
+#include "bench.h"
+
+namespace alioth::bench {
+
+namespace {
+
+/**
+ * 依据文法的单词定义构建词法规则
+ */
+Lex BuildLexicon(Grammar const& grammar) {
+  auto builder = Lexicon::Builder(grammar.options.at("lang"));
+  if (grammar.options.contains("keywords")) {
+    builder.Keywords(grammar.options.at("keywords").get<bool>());
+  }
+  if (grammar.options.contains("lazy")) {
+    builder.Lazy(grammar.options.at("lazy").get<size_t>());
+  }
+  for (auto const& term : grammar.terms) {
+    builder.Define(term.name, RegexTree::Compile(term.regex), term.contexts);
+  }
+  return builder.Build();
+}
+
+/**
+ * 生成包含大量关键字的文法，模拟机器生成的文法
+ *
+ * @param keywords 关键字数量
+ */
+Grammar KeywordGrammar(size_t keywords) {
+  Grammar grammar{};
+  grammar.options["lang"] = "keywords";
+  for (auto i = 0UL; i < keywords; ++i) {
+    auto name = fmt::format("kw{}x{}", i * 7919 % keywords, i);
+    grammar.terms.push_back({.name = "K_" + name, .regex = name});
+  }
+  grammar.terms.push_back({.name = "ID", .regex = R"([a-zA-Z_]\w*)"});
+  grammar.terms.push_back({.name = "NUM", .regex = R"(\d+)"});
+  grammar.terms.push_back({.name = "SPACE", .regex = R"(\s+)"});
+  return grammar;
+}
+
+/**
+ * 在指定上下文中反复扫描全文，返回吞吐量，单位为 MB/s
+ *
+ * @param lex 词法规则
+ * @param text 输入文本
+ * @param context 上下文名称
+ */
+double ScanThroughput(Lex const& lex, std::string const& text,
+                      std::string const& context) {
+  auto const& contexts = lex->contexts;
+  auto const it = std::find(contexts.begin(), contexts.end(), context);
+  auto const ctx = static_cast<ContextID>(it - contexts.begin());
+
+  auto ms = Measure(20, [&] {
+    for (auto offset = 0UL; offset < text.size();) {
+      offset += lex->Scan(text, offset, ctx).length;
+    }
+  });
+  return text.size() / ms / 1000;
+}
+
+}  // namespace
+
+/**
+ * 对比最小化前后的词法状态数量
+ */
+BENCH(Lexicon, Minimize) {
+  for (auto const& path : Grammars()) {
+    auto grammar = LoadGrammar(path);
+
+    grammar.options["minimize"] = false;
+    auto raw = grammar.Compile()->lex->states.size();
+
+    grammar.options["minimize"] = true;
+    auto min = grammar.Compile()->lex->states.size();
+
+    fmt::println("  {:<48} states {:>6} -> {:>6}", path, raw, min);
+  }
+}
+
+/**
+ * 构建词法规则的耗时
+ */
+BENCH(Lexicon, Build) {
+  for (auto const& path : Grammars()) {
+    auto grammar = LoadGrammar(path);
+    auto states = 0UL;
+    auto ms =
+        Measure(10, [&] { states = BuildLexicon(grammar)->states.size(); });
+    fmt::println("  {:<48} {:>6} states {:>10.3f} ms", path, states, ms);
+  }
+
+  for (auto keywords : {100UL, 400UL, 1600UL}) {
+    auto grammar = KeywordGrammar(keywords);
+    auto states = 0UL;
+    auto ms =
+        Measure(1, [&] { states = BuildLexicon(grammar)->states.size(); });
+    auto name = fmt::format("<{} keywords>", keywords);
+    fmt::println("  {:<48} {:>6} states {:>10.3f} ms", name, states, ms);
+  }
+}
+
+/**
+ * 注释密集和模板文本密集输入的扫描吞吐量
+ */
+BENCH(Lexicon, Scan) {
+  std::string comments{};
+  for (auto i = 0; i < 20000; ++i) {
+    comments += fmt::format("# comment line {} {:-<60}\n", i, "");
+    comments += fmt::format("T_{} = /t{}/\n", i, i);
+  }
+  auto lex = LoadGrammar("grammar/grammar.grammar").Compile()->lex;
+  fmt::println("  {:<48} {:>10.1f} MB/s", "<comment-heavy grammar>",
+               ScanThroughput(lex, comments, "grammar"));
+
+  std::string spaces{};
+  for (auto i = 0; i < 20000; ++i) {
+    spaces += fmt::format("\n    {:>16} {:>24}", "name:", i);
+  }
+  lex = LoadGrammar("examples/marking_language/manifest.grammar")
+            .Compile()
+            ->lex;
+  fmt::println("  {:<48} {:>10.1f} MB/s", "<space-heavy manifest>",
+               ScanThroughput(lex, spaces, lex->Lang()));
+
+  std::string text{};
+  for (auto i = 0; i < 20000; ++i) {
+    text += fmt::format("<p class=\"item\">template text {:-<60}</p>\n", i);
+    if (i % 8 == 0) text += "{";
+  }
+  lex = LoadGrammar("grammar/template.grammar").Compile()->lex;
+  fmt::println("  {:<48} {:>10.1f} MB/s", "<template-heavy text>",
+               ScanThroughput(lex, text, "template"));
+}
+
+/**
+ * 关键字移出状态机前后的状态数量和标识符密集输入的扫描吞吐量
+ */
+BENCH(Lexicon, Keywords) {
+  auto compare = [](std::string const& name, Grammar grammar,
+                    std::string const& text) {
+    for (auto keywords : {false, true}) {
+      grammar.options["keywords"] = keywords;
+      auto lex = BuildLexicon(grammar);
+      auto label = fmt::format("<{} keywords={}>", name, keywords);
+      fmt::println("  {:<48} {:>6} states {:>10.1f} MB/s", label,
+                   lex->states.size(), ScanThroughput(lex, text, lex->Lang()));
+    }
+  };
+
+  std::string text{};
+  for (auto i = 0; i < 20000; ++i) {
+    text += fmt::format("let value{} = if index then {} else other;\n", i, i);
+    text += "for item in items return item fn none continue break\n";
+  }
+  compare("play", LoadGrammar("examples/programming_language/play.grammar"),
+          text);
+
+  auto grammar = KeywordGrammar(1600);
+  text.clear();
+  for (auto i = 0UL; i < 200000; ++i) {
+    auto const& term = grammar.terms[i * 7 % 1600];
+    text += i % 2 ? term.regex : fmt::format("kw{}y{}", i % 1600, i % 100);
+    text += ' ';
+  }
+  compare("1600 keywords", grammar, text);
+}
+
+/**
+ * 预先构造与惰性构造状态机的构建耗时和扫描吞吐量
+ */
+BENCH(Lexicon, Lazy) {
+  for (auto keywords : {400UL, 1600UL}) {
+    auto grammar = KeywordGrammar(keywords);
+    std::string text{};
+    for (auto i = 0UL; i < 200000; ++i) {
+      auto const& term = grammar.terms[i * 7 % 64];
+      text += i % 2 ? term.regex : fmt::format("id{}", i % 100);
+      text += ' ';
+    }
+
+    for (auto lazy : {0UL, 1UL << 20}) {
+      grammar.options["lazy"] = lazy;
+      Lex lex{};
+      auto ms = Measure(1, [&] { lex = BuildLexicon(grammar); });
+      auto label = fmt::format("<{} keywords lazy={}>", keywords, lazy);
+      fmt::println("  {:<48} build {:>10.3f} ms scan {:>8.1f} MB/s", label, ms,
+                   ScanThroughput(lex, text, lex->Lang()));
+    }
+  }
+}
+
+}  // namespace alioth::bench
@@ -0,0 +1,51 @@
+#include "alioth/alioth.h"
+#include "bench.h"
+
+namespace alioth::bench {
+
+std::vector<Case>& Cases() {
+  static std::vector<Case> cases;
+  return cases;
+}
+
+Registrar::Registrar(std::string const& name, std::function<void()> run) {
+  Cases().push_back({name, std::move(run)});
+}
+
+std::vector<std::string> const& Grammars() {
+  static std::vector<std::string> const grammars = {
+      "grammar/grammar.grammar",
+      "grammar/template.grammar",
+      "examples/programming_language/play.grammar",
+      "examples/marking_language/manifest.grammar",
+  };
+  return grammars;
+}
+
+Grammar LoadGrammar(std::string const& path) {
+  return Grammar::Load(Document::Read(AliothHome() / path));
+}
+
+}  // namespace alioth::bench
+
+/**
+ * 运行基准测试
+ *
+ * 可以指定若干过滤词，仅运行名称包含任一过滤词的用例
+ */
+int main(int argc, char** argv) {
+  using namespace alioth::bench;
+
+  for (auto const& bench : Cases()) {
+    auto selected = argc <= 1;
+    for (auto i = 1; i < argc; ++i) {
+      if (bench.name.find(argv[i]) != std::string::npos) selected = true;
+    }
+    if (!selected) continue;
+
+    fmt::println("[ {} ]", bench.name);
+    bench.run();
+  }
+
+  return 0;
+}
@@ -0,0 +1,118 @@
+#include "alioth/alioth.h"
+#include "alioth/parser.h"
+#include "bench.h"
+
+namespace alioth::bench {
+
+namespace {
+
+/**
+ * 重复解析源码，输出耗时、吞吐量和单词缓存的命中率
+ *
+ * @param grammar 文法路径
+ * @param source 源码路径
+ */
+void Report(std::string const& grammar, std::string const& source) {
+  auto syntax = LoadGrammar(grammar).Compile();
+  auto doc = Document::Read(AliothHome() / source);
+  auto stats = Parser::Statistics{};
+  auto ms = Measure(20, [&] {
+    auto parser = Parser(syntax, doc);
+    parser.Parse();
+    stats = parser.Stats();
+  });
+  auto const rate = 100.0 * stats.hits / (stats.hits + stats.misses);
+  fmt::println("  {:<48} {:>10.3f} ms {:>8.1f} MB/s {:>6.1f}% hits", source,
+               ms, doc->content.size() / ms / 1000, rate);
+}
+
+}  // namespace
+
+/**
+ * 解析源码的吞吐量
+ *
+ * 模板文法的许多状态具有多个上下文，分析线路分叉后常在相同位置重复扫描
+ */
+BENCH(Parser, Parse) {
+  Report("grammar/template.grammar",
+         "templates/skeleton/cpp/syntax.cpp.template");
+  Report("grammar/template.grammar",
+         "templates/skeleton/cpp/syntax.h.template");
+  Report("grammar/grammar.grammar", "grammar/template.grammar");
+  Report("examples/programming_language/play.grammar",
+         "examples/programming_language/test.play");
+  Report("examples/marking_language/manifest.grammar",
+         "examples/marking_language/example.manifest");
+}
+
+/**
+ * 不分叉的文法反复解析文档，始终只有一条分析线路，单词不经过缓存
+ *
+ * 展开的列表属性在每次归约时复制，文档保持较小以免复制掩盖扫描的开销
+ */
+BENCH(Parser, Single) {
+  auto syntax =
+      LoadGrammar("examples/marking_language/manifest.grammar").Compile();
+  std::string text{};
+  for (auto i = 0; i < 50; ++i) {
+    text += fmt::format("service S{} {{\n", i);
+    text += fmt::format("  event E{}: Payload\n", i);
+    text += fmt::format("  readonly field F{}: Type\n", i);
+    text += fmt::format("  method M{}(a: A, b: B): R\n", i);
+    text += "}\n";
+  }
+  auto doc = Document::Create(text);
+
+  auto stats = Parser::Statistics{};
+  auto ms = Measure(500, [&] {
+    auto parser = Parser(syntax, doc);
+    parser.Parse();
+    stats = parser.Stats();
+  });
+  fmt::println("  {:<48} {:>10.3f} ms {:>8.1f} MB/s {:>8} scans",
+               "<generated manifest>", ms, text.size() / ms / 1000,
+               stats.hits + stats.misses);
+}
+
+/**
+ * 空白和注释密集的输入在保留与丢弃被忽略单词时的解析耗时和终结符数量
+ */
+BENCH(Parser, DropIgnored) {
+  auto syntax =
+      LoadGrammar("examples/marking_language/manifest.grammar").Compile();
+  std::string text{};
+  for (auto i = 0; i < 2000; ++i) {
+    text += fmt::format("# service {}\n# {:-<60}\nservice S{} {{\n", i, "", i);
+    for (auto j = 0; j < 4; ++j) {
+      text += fmt::format("    # field {}\n", j);
+      text += fmt::format("    field   F{}  :   T{}\n\n", j, j);
+    }
+    text += "}\n\n";
+  }
+  auto doc = Document::Create(text);
+
+  for (auto drop : {false, true}) {
+    auto terms = 0UL;
+    auto ms = Measure(3, [&] {
+      auto parser = Parser(syntax, doc);
+      parser.DropIgnored(drop);
+      auto root = parser.Parse();
+      terms = 0;
+      std::vector<AST> pending{root};
+      while (!pending.empty()) {
+        auto node = pending.back();
+        pending.pop_back();
+        if (node->AsTerm()) terms++;
+        if (auto ntrm = node->AsNtrm()) {
+          pending.insert(pending.end(), ntrm->sentence.begin(),
+                         ntrm->sentence.end());
+        }
+      }
+    });
+    fmt::println("  {:<48} {:>10.3f} ms {:>8} terms {:>8} KB",
+                 fmt::format("<whitespace-heavy manifest drop={}>", drop), ms,
+                 terms, terms * sizeof(ASTTermNode) / 1024);
+  }
+}
+
+}  // namespace alioth::bench
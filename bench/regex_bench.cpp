@@ -0,0 +1,75 @@
+#include "alioth/regex.h"
+#include "bench.h"
+
+namespace alioth::bench {
+
+namespace {
+
+/**
+ * 生成由大量关键字构成的单个正则表达式
+ *
+ * @param keywords 关键字数量
+ */
+std::string KeywordPattern(size_t keywords) {
+  std::vector<std::string> alternatives;
+  for (auto i = 0UL; i < keywords; ++i) {
+    alternatives.push_back(fmt::format("kw{}x{}", i * 7919 % keywords, i));
+  }
+  return fmt::format("{}", fmt::join(alternatives, "|"));
+}
+
+/**
+ * 统计解析正则表达式与展开到扁平存储的耗时
+ *
+ * @param name 用例名称
+ * @param patterns 正则表达式
+ * @param repeat 重复次数
+ */
+void Report(std::string const& name, std::vector<std::string> const& patterns,
+            size_t repeat) {
+  auto parse = Measure(repeat, [&] {
+    for (auto const& pattern : patterns) RegexTree::Compile(pattern);
+  });
+
+  std::vector<Regex> trees;
+  for (auto const& pattern : patterns) {
+    trees.push_back(RegexTree::Compile(pattern));
+  }
+
+  // 扁平存储一次求出全部集合，另含展开位置所匹配字节的开销
+  auto arena = Measure(repeat, [&] {
+    RegexTree::Arena arena{};
+    for (auto id = 0UL; id < trees.size(); ++id) {
+      arena.Accept(arena.Add(trees[id]), id + 1);
+    }
+  });
+
+  fmt::println("  {:<40} parse {:>9.3f} ms arena {:>9.3f} ms", name, parse,
+               arena);
+}
+
+}  // namespace
+
+/**
+ * 编译正则表达式的耗时
+ */
+BENCH(Regex, Compile) {
+  for (auto const& path : Grammars()) {
+    auto grammar = LoadGrammar(path);
+    std::vector<std::string> patterns;
+    for (auto const& term : grammar.terms) patterns.push_back(term.regex);
+    Report(path, patterns, 10);
+  }
+
+  for (auto keywords : {100UL, 400UL, 1600UL}) {
+    auto name = fmt::format("<{} keywords in one pattern>", keywords);
+    Report(name, {KeywordPattern(keywords)}, 1);
+  }
+
+  for (auto length : {1000UL, 4000UL}) {
+    auto name = fmt::format("<{} chars literal>", length);
+    Report(name, {std::string(length, 'a')}, 1);
+  }
+}
+
+}  // namespace alioth::bench
@@ -0,0 +1,247 @@
+#include "alioth/regex.h"
+#include "alioth/syntax.h"
+#include "bench.h"
+
+namespace alioth::bench {
+
+namespace {
+
+/**
+ * 生成由多层二元运算构成的表达式文法，模拟产生式很多的文法
+ *
+ * 每层运算符对应两条产生式，层数越多状态和展望符号越多
+ *
+ * @param levels 运算符层数
+ */
+Grammar ExpressionGrammar(size_t levels) {
+  Grammar grammar{};
+  grammar.options["lang"] = "expr";
+  for (auto i = 0UL; i < levels; ++i) {
+    grammar.terms.push_back(
+        {.name = fmt::format("OP{}", i), .regex = fmt::format("op{}", i)});
+  }
+  grammar.terms.push_back({.name = "ID", .regex = R"([a-zA-Z_]\w*)"});
+  grammar.terms.push_back({.name = "LP", .regex = R"(\()"});
+  grammar.terms.push_back({.name = "RP", .regex = R"(\))"});
+  grammar.terms.push_back({.name = "SPACE", .ignore = true, .regex = R"(\s+)"});
+
+  grammar.ntrms.push_back(
+      {.name = "expr", .formulas = {{.symbols = {{.name = "e0"}}}}});
+  for (auto i = 0UL; i <= levels; ++i) {
+    auto name = fmt::format("e{}", i);
+    auto next = fmt::format("e{}", i + 1);
+    if (i == levels) {
+      grammar.ntrms.push_back(
+          {.name = name,
+           .formulas = {{.symbols = {{.name = "ID"}}},
+                        {.symbols = {{.name = "LP"},
+                                     {.name = "e0"},
+                                     {.name = "RP"}}}}});
+      continue;
+    }
+    auto op = fmt::format("OP{}", i);
+    grammar.ntrms.push_back(
+        {.name = name,
+         .formulas = {
+             {.symbols = {{.name = name}, {.name = op}, {.name = next}}},
+             {.symbols = {{.name = next}}}}});
+  }
+  return grammar;
+}
+
+/**
+ * 生成一条产生式含有多个可省符号的文法
+ *
+ * @param count 可省符号数量
+ */
+Grammar OptionalGrammar(size_t count) {
+  Grammar grammar{};
+  grammar.options["lang"] = "opt";
+  Grammar::Formula formula{};
+  for (auto i = 0UL; i < count; ++i) {
+    auto name = fmt::format("T{}", i);
+    grammar.terms.push_back({.name = name, .regex = fmt::format("t{}", i)});
+    formula.symbols.push_back(
+        {.name = name, .attr = fmt::format("t{}", i), .optional = true});
+  }
+  grammar.terms.push_back({.name = "SEMI", .regex = ";"});
+  grammar.terms.push_back({.name = "SPACE", .ignore = true, .regex = R"(\s+)"});
+  formula.symbols.push_back({.name = "SEMI"});
+
+  grammar.ntrms.push_back(
+      {.name = "opt",
+       .formulas = {{.symbols = {{.name = "stmt", .attr = "stmts"}}},
+                    {.symbols = {{.name = "opt", .attr = "..."},
+                                 {.name = "stmt", .attr = "stmts"}}}}});
+  grammar.ntrms.push_back({.name = "stmt", .formulas = {formula}});
+  return grammar;
+}
+
+/**
+ * 只执行文法分析，即计算可空性、FIRST集合和FOLLOW集合的构建器
+ */
+struct Analyzer : Syntactic::Builder {
+  using Builder::Builder;
+
+  void Analyze() {
+    CalculateNullable();
+    CalculateFirst();
+    CalculateSuffixes();
+    CalculateFollow();
+  }
+};
+
+/**
+ * 向构建器中添加由非终结符链构成的文法，模拟机器生成的大型文法
+ *
+ * c{i} -> c{i+1} c{i+1} | T{i} c{i+1}，链尾可空
+ * 链上每个非终结符的可空性和FIRST集合都依赖其后的全部非终结符
+ *
+ * @param builder 构建器，词法规则包含单词 T0 至 T63
+ * @param ntrms 非终结符数量
+ */
+void ChainFormulas(Syntactic::Builder& builder, size_t ntrms) {
+  builder.Formula("chain").Symbol("c0").Commit();
+  for (auto i = 0UL; i < ntrms; ++i) {
+    auto name = fmt::format("c{}", i);
+    auto next = fmt::format("c{}", i + 1);
+    auto term = fmt::format("T{}", i % 64);
+    builder.Formula(name).Symbol(next).Symbol(next).Commit();
+    builder.Formula(name).Symbol(term).Symbol(next).Commit();
+  }
+  auto last = fmt::format("c{}", ntrms);
+  builder.Formula(last).Commit();
+  builder.Formula(last).Symbol("T0").Commit();
+}
+
+}  // namespace
+
+/**
+ * 构建语法规则的耗时和状态数量
+ */
+BENCH(Syntactic, Build) {
+  std::vector<std::pair<std::string, Grammar>> grammars{};
+  for (auto const& path : Grammars()) {
+    grammars.emplace_back(path, LoadGrammar(path));
+  }
+  for (auto levels : {25UL, 50UL, 100UL}) {
+    grammars.emplace_back(fmt::format("<{} operator levels>", levels),
+                          ExpressionGrammar(levels));
+  }
+
+  for (auto& [name, grammar] : grammars) {
+    for (auto lalr : {false, true}) {
+      grammar.options["lalr"] = lalr;
+      auto states = 0UL;
+      auto ms = Measure(1, [&] { states = grammar.Compile()->states.size(); });
+      auto label = fmt::format("{} lalr={}", name, lalr);
+      fmt::println("  {:<48} {:>6} states {:>10.3f} ms", label, states, ms);
+    }
+  }
+}
+
+/**
+ * 多线程构造状态机的耗时
+ */
+BENCH(Syntactic, Jobs) {
+  auto grammar = ExpressionGrammar(200);
+  for (auto jobs : {1UL, 2UL, 4UL, 0UL}) {
+    auto states = 0UL;
+    auto ms =
+        Measure(1, [&] { states = grammar.Compile(jobs)->states.size(); });
+    auto label = fmt::format("<200 operator levels> jobs={}", jobs);
+    fmt::println("  {:<48} {:>6} states {:>10.3f} ms", label, states, ms);
+  }
+}
+
+/**
+ * 状态表与压缩动作表占用的字节数
+ *
+ * 状态表的每个动作按一个 std::map 节点估算，即键值对加上三个指针和颜色标记
+ */
+BENCH(Syntactic, Table) {
+  auto constexpr kNode =
+      sizeof(std::pair<SymbolID, StateID>) + 4 * sizeof(void*);
+  for (auto const& path : Grammars()) {
+    auto grammar = LoadGrammar(path);
+    for (auto lalr : {false, true}) {
+      grammar.options["lalr"] = lalr;
+      auto syntax = grammar.Compile();
+      auto entries = 0UL;
+      auto defaults = 0UL;
+      for (auto const& state : syntax->states) {
+        entries += state.shift.size() + state.reduce.size();
+      }
+      for (auto const formula : syntax->table->defaults) {
+        defaults += formula != Syntactic::Table::kNone;
+      }
+      auto const maps =
+          entries * kNode + syntax->states.size() * sizeof(Syntactic::State);
+      auto label = fmt::format("{} lalr={}", path, lalr);
+      fmt::println("  {:<48} {:>8} -> {:>7} bytes {:>4}/{:<4} defaults", label,
+                   maps, syntax->table->Bytes(), defaults,
+                   syntax->states.size());
+    }
+  }
+}
+
+/**
+ * 从JSON格式加载语法规则与直接使用二进制镜像的耗时
+ */
+BENCH(Syntactic, Image) {
+  std::vector<std::pair<std::string, Grammar>> grammars{};
+  for (auto const& path : Grammars()) {
+    grammars.emplace_back(path, LoadGrammar(path));
+  }
+  grammars.emplace_back("<100 operator levels>", ExpressionGrammar(100));
+
+  for (auto& [name, grammar] : grammars) {
+    auto syntax = grammar.Compile();
+    auto const json = syntax->Store().dump();
+    auto const image = syntax->Image();
+    auto const load =
+        Measure(5, [&] { Syntactic::Load(nlohmann::json::parse(json)); });
+    auto const view = Measure(5, [&] { Syntactic::View(image); });
+    fmt::println("  {:<48} json {:>10.3f} ms image {:>8.3f} ms {:>7} bytes",
+                 name, load, view, image.size());
+  }
+}
+
+/**
+ * 可省符号按组合展开与改用可空辅助非终结符的产生式数量、状态数量和构建耗时
+ */
+BENCH(Syntactic, Optional) {
+  for (auto count : {4UL, 8UL, 12UL}) {
+    auto grammar = OptionalGrammar(count);
+    for (auto strategy : {"expand", "nullable"}) {
+      grammar.options["optional"] = strategy;
+      Syntax syntax;
+      auto ms = Measure(1, [&] { syntax = grammar.Compile(); });
+      auto label = fmt::format("<{} optional symbols> {}", count, strategy);
+      fmt::println("  {:<48} {:>6} formulas {:>6} states {:>10.3f} ms", label,
+                   syntax->formulas.size(), syntax->states.size(), ms);
+    }
+  }
+}
+
+/**
+ * 大量非终结符的文法分析耗时
+ */
+BENCH(Syntactic, Analyze) {
+  Lexicon::Builder lexicon{"chain"};
+  for (auto i = 0UL; i < 64; ++i) {
+    lexicon.Define(fmt::format("T{}", i),
+                   RegexTree::Compile(fmt::format("t{}", i)));
+  }
+  auto const lex = lexicon.Build();
+
+  for (auto ntrms : {1000UL, 2000UL, 4000UL}) {
+    Analyzer analyzer{lex};
+    ChainFormulas(analyzer, ntrms);
+    auto ms = Measure(1, [&] { analyzer.Analyze(); });
+    auto label = fmt::format("<{} chained nonterminals>", ntrms);
+    fmt::println("  {:<48} {:>10.3f} ms", label, ms);
+  }
+}
+
+}  // namespace alioth::bench
@@ -0,0 +1,36 @@
+#include "alioth/tokenizer.h"
+
+#include <thread>
+
+#include "bench.h"
+
+namespace alioth::bench {
+
+/**
+ * 顺序扫描与分块并行扫描大型清单文件的吞吐量
+ */
+BENCH(Tokenizer, All) {
+  auto lex = LoadGrammar("examples/marking_language/manifest.grammar")
+                 .Compile()
+                 ->lex;
+  std::string text{};
+  for (auto i = 0; text.size() < (64 << 20); ++i) {
+    text += fmt::format("# generated service {}\nservice S{} {{\n", i, i);
+    text += fmt::format("  event E{}: Payload{}\n", i, i);
+    text += fmt::format("  readonly field F{}: Field{}\n", i, i);
+    text += fmt::format("  method M{}(a: Arg, b: Arg): Ret{}\n}}\n\n", i, i);
+  }
+  auto doc = Document::Create(text);
+
+  auto const cores = std::max(1U, std::thread::hardware_concurrency());
+  for (auto jobs : {1UL, 2UL, 4UL, static_cast<size_t>(cores)}) {
+    auto batch = Tokenizer::Batch{};
+    auto ms = Measure(3, [&] { Tokenizer(lex, doc).All(batch, jobs); });
+    fmt::println("  {:<48} {:>10.1f} MB/s {:>10} tokens",
+                 fmt::format("<{} MB manifest, {} jobs>", text.size() >> 20,
+                             jobs),
+                 text.size() / ms / 1000, batch.Size());
+  }
+}
+
+}  // namespace alioth::bench
@@ -1,8 +1,11 @@
 #ifndef __PLAY_SYNTAX_H__
 #define __PLAY_SYNTAX_H__
 
+#include <string_view>
+
 #include "alioth/ast.h"
 #include "alioth/document.h"
+#include "alioth/lexicon.h"
 
 namespace play {
 
@@ -50,6 +53,27 @@ constexpr alioth::SymbolID T_NUMBER = 41;
 constexpr alioth::SymbolID T_ID = 42;
 constexpr alioth::SymbolID T_SPACE = 43;
 
+constexpr alioth::SymbolID kPlay = 45;
+constexpr alioth::SymbolID kStmt = 46;
+constexpr alioth::SymbolID kDeclare = 47;
+constexpr alioth::SymbolID kBranch = 48;
+constexpr alioth::SymbolID kIterate = 49;
+constexpr alioth::SymbolID kControl = 50;
+constexpr alioth::SymbolID kFunction = 51;
+constexpr alioth::SymbolID kExpression = 52;
+constexpr alioth::SymbolID kBlock = 53;
+constexpr alioth::SymbolID kStmts = 54;
+constexpr alioth::SymbolID kIf = 55;
+constexpr alioth::SymbolID kElseifs = 56;
+constexpr alioth::SymbolID kElse = 57;
+constexpr alioth::SymbolID kElseif = 58;
+constexpr alioth::SymbolID kParams = 59;
+constexpr alioth::SymbolID kPriority4 = 60;
+constexpr alioth::SymbolID kPriority3 = 61;
+constexpr alioth::SymbolID kPriority2 = 62;
+constexpr alioth::SymbolID kPriority1 = 63;
+constexpr alioth::SymbolID kPriority0 = 64;
+
 
 struct BranchNode: public alioth::ASTNtrmNode {
   alioth::ASTAttrs branchs{}; // if else elseif
@@ -236,6 +260,12 @@ struct StmtNode: public alioth::ASTNtrmNode {
 
 std::shared_ptr<PlayNode> ParsePlay(alioth::Doc source);
 
+/**
+ * 直接编码的词法扫描器，与语法规则的词法规则等价
+ */
+alioth::Lexicon::Token Scan(std::string_view text, size_t offset,
+                            alioth::ContextID context);
+
 }
 
 #endif
\ No newline at end of file
@@ -1,5 +1,3 @@
-
-#include "alioth/inspect.h"
 #include "cli/cli.h"
 #include "play/syntax.h"
 
@@ -10,13 +8,13 @@ struct Compile : public cli::Command {
     auto play = ::play::ParsePlay(doc);
 
     for (auto stmt : play->stmts) {
-      fmt::println("statement: {}", alioth::NameOf(stmt));
+      fmt::println("statement: {}", stmt->Name());
     }
 
     auto stmt = play->stmts.front().As<play::StmtNode>();
     // fmt::println("{}", alioth::StoreNode(play).dump(2));
     auto fn = stmt->function.As<play::FunctionNode>();
-    fmt::println("function name: {}", alioth::TextOf(fn->name));
+    fmt::println("function name: {}", fn->name->Text());
 
     return 0;
   }
@@ -0,0 +1,723 @@
+#include <stdexcept>
+
+#include "play/syntax.h"
+
+namespace play {
+
+/**
+ * 直接编码的词法扫描器，每个词法状态对应一个标签
+ * 状态转移直接跳转到目标标签，不经过转移表
+ */
+alioth::Lexicon::Token Scan(std::string_view text, size_t offset,
+                            alioth::ContextID context) {
+  if (offset >= text.size()) return {.id = alioth::Lexicon::kEOF};
+
+  auto const* data = reinterpret_cast<unsigned char const*>(text.data());
+  auto const size = text.size();
+  auto cursor = offset;
+
+  switch (static_cast<unsigned char>(context)) {
+    case 0: goto s1;
+    case 1: goto s2;
+    default: throw std::out_of_range("unknown lexical context");
+  }
+
+s1:
+  if (cursor < size) switch (data[cursor]) {
+    case 9: case 10: case 11: case 12: case 13: case 32: ++cursor; goto s3;
+    case 33: ++cursor; goto s4;
+    case 37: ++cursor; goto s6;
+    case 38: ++cursor; goto s7;
+    case 40: ++cursor; goto s8;
+    case 41: ++cursor; goto s9;
+    case 42: ++cursor; goto s10;
+    case 43: ++cursor; goto s11;
+    case 44: ++cursor; goto s12;
+    case 45: ++cursor; goto s13;
+    case 46: ++cursor; goto s14;
+    case 47: ++cursor; goto s15;
+    case 48: ++cursor; goto s16;
+    case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: ++cursor; goto s17;
+    case 59: ++cursor; goto s18;
+    case 60: ++cursor; goto s19;
+    case 61: ++cursor; goto s20;
+    case 62: ++cursor; goto s21;
+    case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 100: case 103: case 104: case 106: case 107: case 109: case 110: case 111: case 112: case 113: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 91: ++cursor; goto s23;
+    case 93: ++cursor; goto s24;
+    case 94: ++cursor; goto s25;
+    case 98: ++cursor; goto s26;
+    case 99: ++cursor; goto s27;
+    case 101: ++cursor; goto s28;
+    case 105: ++cursor; goto s30;
+    case 108: ++cursor; goto s31;
+    case 114: ++cursor; goto s33;
+    case 123: ++cursor; goto s35;
+    case 124: ++cursor; goto s36;
+    case 125: ++cursor; goto s37;
+    case 126: ++cursor; goto s38;
+    case 102: ++cursor; goto s87;
+    default: break;
+  }
+  return {.id = alioth::Lexicon::kERR, .length = cursor + 1 - offset};
+
+s2:
+  if (cursor < size) switch (data[cursor]) {
+    case 9: case 10: case 11: case 12: case 13: case 32: ++cursor; goto s3;
+    case 33: ++cursor; goto s4;
+    case 34: ++cursor; goto s5;
+    case 37: ++cursor; goto s6;
+    case 38: ++cursor; goto s7;
+    case 40: ++cursor; goto s8;
+    case 41: ++cursor; goto s9;
+    case 42: ++cursor; goto s10;
+    case 43: ++cursor; goto s11;
+    case 44: ++cursor; goto s12;
+    case 45: ++cursor; goto s13;
+    case 46: ++cursor; goto s14;
+    case 47: ++cursor; goto s15;
+    case 48: ++cursor; goto s16;
+    case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: ++cursor; goto s17;
+    case 59: ++cursor; goto s18;
+    case 60: ++cursor; goto s19;
+    case 61: ++cursor; goto s20;
+    case 62: ++cursor; goto s21;
+    case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 100: case 103: case 104: case 106: case 107: case 109: case 111: case 112: case 113: case 115: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 91: ++cursor; goto s23;
+    case 93: ++cursor; goto s24;
+    case 94: ++cursor; goto s25;
+    case 98: ++cursor; goto s26;
+    case 99: ++cursor; goto s27;
+    case 101: ++cursor; goto s28;
+    case 102: ++cursor; goto s29;
+    case 105: ++cursor; goto s30;
+    case 108: ++cursor; goto s31;
+    case 110: ++cursor; goto s32;
+    case 114: ++cursor; goto s33;
+    case 116: ++cursor; goto s34;
+    case 123: ++cursor; goto s35;
+    case 124: ++cursor; goto s36;
+    case 125: ++cursor; goto s37;
+    case 126: ++cursor; goto s38;
+    default: break;
+  }
+  return {.id = alioth::Lexicon::kERR, .length = cursor + 1 - offset};
+
+s3:
+  if (cursor < size) switch (data[cursor]) {
+    case 9: case 10: case 11: case 12: case 13: case 32: ++cursor; goto s3;
+    default: break;
+  }
+  return {.id = 43, .length = cursor - offset};
+
+s4:
+  if (cursor < size) switch (data[cursor]) {
+    case 61: ++cursor; goto s86;
+    default: break;
+  }
+  return {.id = 23, .length = cursor - offset};
+
+s5:
+  if (cursor < size) switch (data[cursor]) {
+    case 0: case 10: break;
+    case 34: ++cursor; goto s84;
+    case 92: ++cursor; goto s85;
+    default: ++cursor; goto s5;
+  }
+  return {.id = alioth::Lexicon::kERR, .length = cursor + 1 - offset};
+
+s6:
+  if (cursor < size) switch (data[cursor]) {
+    default: break;
+  }
+  return {.id = 14, .length = cursor - offset};
+
+s7:
+  if (cursor < size) switch (data[cursor]) {
+    case 38: ++cursor; goto s83;
+    default: break;
+  }
+  return {.id = 24, .length = cursor - offset};
+
+s8:
+  if (cursor < size) switch (data[cursor]) {
+    default: break;
+  }
+  return {.id = 1, .length = cursor - offset};
+
+s9:
+  if (cursor < size) switch (data[cursor]) {
+    default: break;
+  }
+  return {.id = 2, .length = cursor - offset};
+
+s10:
+  if (cursor < size) switch (data[cursor]) {
+    default: break;
+  }
+  return {.id = 12, .length = cursor - offset};
+
+s11:
+  if (cursor < size) switch (data[cursor]) {
+    default: break;
+  }
+  return {.id = 10, .length = cursor - offset};
+
+s12:
+  if (cursor < size) switch (data[cursor]) {
+    default: break;
+  }
+  return {.id = 7, .length = cursor - offset};
+
+s13:
+  if (cursor < size) switch (data[cursor]) {
+    default: break;
+  }
+  return {.id = 11, .length = cursor - offset};
+
+s14:
+  if (cursor < size) switch (data[cursor]) {
+    default: break;
+  }
+  return {.id = 9, .length = cursor - offset};
+
+s15:
+  if (cursor < size) switch (data[cursor]) {
+    default: break;
+  }
+  return {.id = 13, .length = cursor - offset};
+
+s16:
+  if (cursor < size) switch (data[cursor]) {
+    case 46: ++cursor; goto s78;
+    case 69: case 101: ++cursor; goto s79;
+    default: break;
+  }
+  return {.id = 41, .length = cursor - offset};
+
+s17:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: ++cursor; goto s17;
+    case 46: ++cursor; goto s78;
+    case 69: case 101: ++cursor; goto s79;
+    default: break;
+  }
+  return {.id = 41, .length = cursor - offset};
+
+s18:
+  if (cursor < size) switch (data[cursor]) {
+    default: break;
+  }
+  return {.id = 8, .length = cursor - offset};
+
+s19:
+  if (cursor < size) switch (data[cursor]) {
+    case 61: ++cursor; goto s77;
+    default: break;
+  }
+  return {.id = 15, .length = cursor - offset};
+
+s20:
+  if (cursor < size) switch (data[cursor]) {
+    case 61: ++cursor; goto s76;
+    default: break;
+  }
+  return {.id = 28, .length = cursor - offset};
+
+s21:
+  if (cursor < size) switch (data[cursor]) {
+    case 61: ++cursor; goto s75;
+    default: break;
+  }
+  return {.id = 16, .length = cursor - offset};
+
+s22:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s23:
+  if (cursor < size) switch (data[cursor]) {
+    default: break;
+  }
+  return {.id = 3, .length = cursor - offset};
+
+s24:
+  if (cursor < size) switch (data[cursor]) {
+    default: break;
+  }
+  return {.id = 4, .length = cursor - offset};
+
+s25:
+  if (cursor < size) switch (data[cursor]) {
+    default: break;
+  }
+  return {.id = 27, .length = cursor - offset};
+
+s26:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 114: ++cursor; goto s71;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s27:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 111: ++cursor; goto s64;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s28:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 108: ++cursor; goto s61;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s29:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 97: ++cursor; goto s54;
+    case 110: ++cursor; goto s55;
+    case 111: ++cursor; goto s56;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s30:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 102: ++cursor; goto s53;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s31:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 101: ++cursor; goto s51;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s32:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 117: ++cursor; goto s48;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s33:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 101: ++cursor; goto s43;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s34:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 114: ++cursor; goto s40;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s35:
+  if (cursor < size) switch (data[cursor]) {
+    default: break;
+  }
+  return {.id = 5, .length = cursor - offset};
+
+s36:
+  if (cursor < size) switch (data[cursor]) {
+    case 124: ++cursor; goto s39;
+    default: break;
+  }
+  return {.id = 25, .length = cursor - offset};
+
+s37:
+  if (cursor < size) switch (data[cursor]) {
+    default: break;
+  }
+  return {.id = 6, .length = cursor - offset};
+
+s38:
+  if (cursor < size) switch (data[cursor]) {
+    default: break;
+  }
+  return {.id = 26, .length = cursor - offset};
+
+s39:
+  if (cursor < size) switch (data[cursor]) {
+    default: break;
+  }
+  return {.id = 22, .length = cursor - offset};
+
+s40:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 117: ++cursor; goto s41;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s41:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 101: ++cursor; goto s42;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s42:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    default: break;
+  }
+  return {.id = 38, .length = cursor - offset};
+
+s43:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 116: ++cursor; goto s44;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s44:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 117: ++cursor; goto s45;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s45:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 114: ++cursor; goto s46;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s46:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 110: ++cursor; goto s47;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s47:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    default: break;
+  }
+  return {.id = 36, .length = cursor - offset};
+
+s48:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 108: ++cursor; goto s49;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s49:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 108: ++cursor; goto s50;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s50:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    default: break;
+  }
+  return {.id = 37, .length = cursor - offset};
+
+s51:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 116: ++cursor; goto s52;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s52:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    default: break;
+  }
+  return {.id = 29, .length = cursor - offset};
+
+s53:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    default: break;
+  }
+  return {.id = 31, .length = cursor - offset};
+
+s54:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 108: ++cursor; goto s58;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s55:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    default: break;
+  }
+  return {.id = 30, .length = cursor - offset};
+
+s56:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 114: ++cursor; goto s57;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s57:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    default: break;
+  }
+  return {.id = 33, .length = cursor - offset};
+
+s58:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 115: ++cursor; goto s59;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s59:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 101: ++cursor; goto s60;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s60:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    default: break;
+  }
+  return {.id = 39, .length = cursor - offset};
+
+s61:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 115: ++cursor; goto s62;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s62:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 101: ++cursor; goto s63;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s63:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    default: break;
+  }
+  return {.id = 32, .length = cursor - offset};
+
+s64:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 110: ++cursor; goto s65;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s65:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 116: ++cursor; goto s66;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s66:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 105: ++cursor; goto s67;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s67:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 110: ++cursor; goto s68;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s68:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 117: ++cursor; goto s69;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s69:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 101: ++cursor; goto s70;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s70:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    default: break;
+  }
+  return {.id = 34, .length = cursor - offset};
+
+s71:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 101: ++cursor; goto s72;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s72:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 97: ++cursor; goto s73;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s73:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 107: ++cursor; goto s74;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+
+s74:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    default: break;
+  }
+  return {.id = 35, .length = cursor - offset};
+
+s75:
+  if (cursor < size) switch (data[cursor]) {
+    default: break;
+  }
+  return {.id = 18, .length = cursor - offset};
+
+s76:
+  if (cursor < size) switch (data[cursor]) {
+    default: break;
+  }
+  return {.id = 19, .length = cursor - offset};
+
+s77:
+  if (cursor < size) switch (data[cursor]) {
+    default: break;
+  }
+  return {.id = 17, .length = cursor - offset};
+
+s78:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: ++cursor; goto s82;
+    default: break;
+  }
+  return {.id = alioth::Lexicon::kERR, .length = cursor + 1 - offset};
+
+s79:
+  if (cursor < size) switch (data[cursor]) {
+    case 43: case 45: ++cursor; goto s80;
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: ++cursor; goto s81;
+    default: break;
+  }
+  return {.id = alioth::Lexicon::kERR, .length = cursor + 1 - offset};
+
+s80:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: ++cursor; goto s81;
+    default: break;
+  }
+  return {.id = alioth::Lexicon::kERR, .length = cursor + 1 - offset};
+
+s81:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: ++cursor; goto s81;
+    default: break;
+  }
+  return {.id = 41, .length = cursor - offset};
+
+s82:
+  if (cursor < size) switch (data[cursor]) {
+    case 69: case 101: ++cursor; goto s79;
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: ++cursor; goto s82;
+    default: break;
+  }
+  return {.id = 41, .length = cursor - offset};
+
+s83:
+  if (cursor < size) switch (data[cursor]) {
+    default: break;
+  }
+  return {.id = 21, .length = cursor - offset};
+
+s84:
+  if (cursor < size) switch (data[cursor]) {
+    default: break;
+  }
+  return {.id = 40, .length = cursor - offset};
+
+s85:
+  if (cursor < size) switch (data[cursor]) {
+    case 0: case 10: break;
+    default: ++cursor; goto s5;
+  }
+  return {.id = alioth::Lexicon::kERR, .length = cursor + 1 - offset};
+
+s86:
+  if (cursor < size) switch (data[cursor]) {
+    default: break;
+  }
+  return {.id = 20, .length = cursor - offset};
+
+s87:
+  if (cursor < size) switch (data[cursor]) {
+    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 95: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: ++cursor; goto s22;
+    case 110: ++cursor; goto s55;
+    case 111: ++cursor; goto s56;
+    default: break;
+  }
+  return {.id = 42, .length = cursor - offset};
+}
+
+}
@@ -1,7 +1,6 @@
 #include "play/syntax.h"
 
 #include "alioth/parser.h"
-#include "alioth/inspect.h"
 #include "nlohmann/json.hpp"
 
 namespace play {
@@ -11,7 +10,7 @@ alioth::ASTAttr ParseArbitraryAttribute(alioth::AST node);
 
 std::shared_ptr<BranchNode> ParseBranch(alioth::ASTNtrm node) {
   auto n = std::make_shared<BranchNode>(*node);
-  for( auto attr : alioth::AttrsOf(node, "branchs")) n->branchs.push_back(ParseArbitraryAttribute(attr));
+  for( auto attr : node->Attrs("branchs")) n->branchs.push_back(ParseArbitraryAttribute(attr));
   return n;
 }
 std::shared_ptr<ControlNode> ParseBreakControl(alioth::ASTNtrm node) {
@@ -31,7 +30,7 @@ std::shared_ptr<ControlNode> ParseContinueControl(alioth::ASTNtrm node) {
 std::shared_ptr<ControlNode> ParseReturnControl(alioth::ASTNtrm node) {
   auto n = std::make_shared<ControlNode::Return>(*node);
 
-  n->expr = ParseArbitraryAttribute(alioth::AttrOf(node, "expr"));
+  n->expr = ParseArbitraryAttribute(node->Attr("expr"));
 
   return n;
 }
@@ -39,7 +38,7 @@ std::shared_ptr<ControlNode> ParseReturnControl(alioth::ASTNtrm node) {
 
 std::shared_ptr<ControlNode> ParseControl(alioth::ASTNtrm node) {
   std::shared_ptr<ControlNode> n;
-  switch(alioth::FinalFormulaOf(node)) {
+  switch(node->OriginFormula()) {
     case 32: 
       n = ParseBreakControl(node);
       break;
@@ -58,59 +57,59 @@ std::shared_ptr<ControlNode> ParseControl(alioth::ASTNtrm node) {
 }
 std::shared_ptr<DeclareNode> ParseDeclare(alioth::ASTNtrm node) {
   auto n = std::make_shared<DeclareNode>(*node);
-  n->init = ParseArbitraryAttribute(alioth::AttrOf(node, "init"));
-  n->name = ParseArbitraryAttribute(alioth::AttrOf(node, "name"));
+  n->init = ParseArbitraryAttribute(node->Attr("init"));
+  n->name = ParseArbitraryAttribute(node->Attr("name"));
   return n;
 }
 std::shared_ptr<ElseNode> ParseElse(alioth::ASTNtrm node) {
   auto n = std::make_shared<ElseNode>(*node);
-  for( auto attr : alioth::AttrsOf(node, "stmts")) n->stmts.push_back(ParseArbitraryAttribute(attr));
+  for( auto attr : node->Attrs("stmts")) n->stmts.push_back(ParseArbitraryAttribute(attr));
   return n;
 }
 std::shared_ptr<ElseifNode> ParseElseif(alioth::ASTNtrm node) {
   auto n = std::make_shared<ElseifNode>(*node);
-  n->condition = ParseArbitraryAttribute(alioth::AttrOf(node, "condition"));
-  for( auto attr : alioth::AttrsOf(node, "stmts")) n->stmts.push_back(ParseArbitraryAttribute(attr));
+  n->condition = ParseArbitraryAttribute(node->Attr("condition"));
+  for( auto attr : node->Attrs("stmts")) n->stmts.push_back(ParseArbitraryAttribute(attr));
   return n;
 }
 std::shared_ptr<ExpressionNode> ParseBinaryExpression(alioth::ASTNtrm node) {
   auto n = std::make_shared<ExpressionNode::Binary>(*node);
 
-  n->lhs = ParseArbitraryAttribute(alioth::AttrOf(node, "lhs"));
-  n->op = ParseArbitraryAttribute(alioth::AttrOf(node, "op"));
-  n->rhs = ParseArbitraryAttribute(alioth::AttrOf(node, "rhs"));
+  n->lhs = ParseArbitraryAttribute(node->Attr("lhs"));
+  n->op = ParseArbitraryAttribute(node->Attr("op"));
+  n->rhs = ParseArbitraryAttribute(node->Attr("rhs"));
 
   return n;
 }
 std::shared_ptr<ExpressionNode> ParseMonoExpression(alioth::ASTNtrm node) {
   auto n = std::make_shared<ExpressionNode::Mono>(*node);
 
-  n->op = ParseArbitraryAttribute(alioth::AttrOf(node, "op"));
-  n->rhs = ParseArbitraryAttribute(alioth::AttrOf(node, "rhs"));
+  n->op = ParseArbitraryAttribute(node->Attr("op"));
+  n->rhs = ParseArbitraryAttribute(node->Attr("rhs"));
 
   return n;
 }
 std::shared_ptr<ExpressionNode> ParseSubExpression(alioth::ASTNtrm node) {
   auto n = std::make_shared<ExpressionNode::Sub>(*node);
 
-  n->expr = ParseArbitraryAttribute(alioth::AttrOf(node, "expr"));
+  n->expr = ParseArbitraryAttribute(node->Attr("expr"));
 
   return n;
 }
 std::shared_ptr<ExpressionNode> ParseValueExpression(alioth::ASTNtrm node) {
   auto n = std::make_shared<ExpressionNode::Value>(*node);
 
-  n->boolean = ParseArbitraryAttribute(alioth::AttrOf(node, "boolean"));
-  n->null = ParseArbitraryAttribute(alioth::AttrOf(node, "null"));
-  n->number = ParseArbitraryAttribute(alioth::AttrOf(node, "number"));
-  n->string = ParseArbitraryAttribute(alioth::AttrOf(node, "string"));
+  n->boolean = ParseArbitraryAttribute(node->Attr("boolean"));
+  n->null = ParseArbitraryAttribute(node->Attr("null"));
+  n->number = ParseArbitraryAttribute(node->Attr("number"));
+  n->string = ParseArbitraryAttribute(node->Attr("string"));
 
   return n;
 }
 std::shared_ptr<ExpressionNode> ParseVarExpression(alioth::ASTNtrm node) {
   auto n = std::make_shared<ExpressionNode::Var>(*node);
 
-  n->name = ParseArbitraryAttribute(alioth::AttrOf(node, "name"));
+  n->name = ParseArbitraryAttribute(node->Attr("name"));
 
   return n;
 }
@@ -118,7 +117,7 @@ std::shared_ptr<ExpressionNode> ParseVarExpression(alioth::ASTNtrm node) {
 
 std::shared_ptr<ExpressionNode> ParseExpression(alioth::ASTNtrm node) {
   std::shared_ptr<ExpressionNode> n;
-  switch(alioth::FinalFormulaOf(node)) {
+  switch(node->OriginFormula()) {
     case 41: case 43: case 44: case 46: case 47: case 49: case 50: case 51: case 53: case 54: case 55: 
       n = ParseBinaryExpression(node);
       break;
@@ -143,55 +142,55 @@ std::shared_ptr<ExpressionNode> ParseExpression(alioth::ASTNtrm node) {
 }
 std::shared_ptr<FunctionNode> ParseFunction(alioth::ASTNtrm node) {
   auto n = std::make_shared<FunctionNode>(*node);
-  n->name = ParseArbitraryAttribute(alioth::AttrOf(node, "name"));
-  for( auto attr : alioth::AttrsOf(node, "params")) n->params.push_back(ParseArbitraryAttribute(attr));
-for( auto attr : alioth::AttrsOf(node, "stmts")) n->stmts.push_back(ParseArbitraryAttribute(attr));
+  n->name = ParseArbitraryAttribute(node->Attr("name"));
+  for( auto attr : node->Attrs("params")) n->params.push_back(ParseArbitraryAttribute(attr));
+for( auto attr : node->Attrs("stmts")) n->stmts.push_back(ParseArbitraryAttribute(attr));
   return n;
 }
 std::shared_ptr<IfNode> ParseIf(alioth::ASTNtrm node) {
   auto n = std::make_shared<IfNode>(*node);
-  n->condition = ParseArbitraryAttribute(alioth::AttrOf(node, "condition"));
-  for( auto attr : alioth::AttrsOf(node, "stmts")) n->stmts.push_back(ParseArbitraryAttribute(attr));
+  n->condition = ParseArbitraryAttribute(node->Attr("condition"));
+  for( auto attr : node->Attrs("stmts")) n->stmts.push_back(ParseArbitraryAttribute(attr));
   return n;
 }
 std::shared_ptr<IterateNode> ParseIterate(alioth::ASTNtrm node) {
   auto n = std::make_shared<IterateNode>(*node);
-  n->cond = ParseArbitraryAttribute(alioth::AttrOf(node, "cond"));
-  n->ctrl = ParseArbitraryAttribute(alioth::AttrOf(node, "ctrl"));
-  n->init = ParseArbitraryAttribute(alioth::AttrOf(node, "init"));
-  for( auto attr : alioth::AttrsOf(node, "stmts")) n->stmts.push_back(ParseArbitraryAttribute(attr));
+  n->cond = ParseArbitraryAttribute(node->Attr("cond"));
+  n->ctrl = ParseArbitraryAttribute(node->Attr("ctrl"));
+  n->init = ParseArbitraryAttribute(node->Attr("init"));
+  for( auto attr : node->Attrs("stmts")) n->stmts.push_back(ParseArbitraryAttribute(attr));
   return n;
 }
 std::shared_ptr<PlayNode> ParsePlay(alioth::ASTNtrm node) {
   auto n = std::make_shared<PlayNode>(*node);
-  for( auto attr : alioth::AttrsOf(node, "stmts")) n->stmts.push_back(ParseArbitraryAttribute(attr));
+  for( auto attr : node->Attrs("stmts")) n->stmts.push_back(ParseArbitraryAttribute(attr));
   return n;
 }
 std::shared_ptr<StmtNode> ParseStmt(alioth::ASTNtrm node) {
   auto n = std::make_shared<StmtNode>(*node);
-  n->branch = ParseArbitraryAttribute(alioth::AttrOf(node, "branch"));
-  n->control = ParseArbitraryAttribute(alioth::AttrOf(node, "control"));
-  n->declare = ParseArbitraryAttribute(alioth::AttrOf(node, "declare"));
-  n->expression = ParseArbitraryAttribute(alioth::AttrOf(node, "expression"));
-  n->function = ParseArbitraryAttribute(alioth::AttrOf(node, "function"));
-  n->iterate = ParseArbitraryAttribute(alioth::AttrOf(node, "iterate"));
+  n->branch = ParseArbitraryAttribute(node->Attr("branch"));
+  n->control = ParseArbitraryAttribute(node->Attr("control"));
+  n->declare = ParseArbitraryAttribute(node->Attr("declare"));
+  n->expression = ParseArbitraryAttribute(node->Attr("expression"));
+  n->function = ParseArbitraryAttribute(node->Attr("function"));
+  n->iterate = ParseArbitraryAttribute(node->Attr("iterate"));
   return n;
 }
 
 
 alioth::ASTAttr ParseArbitraryAttribute(alioth::AST node) {
   if(node) switch(node->id) {
-    case 48: return ParseBranch(alioth::AsNtrm(node));
-    case 50: return ParseControl(alioth::AsNtrm(node));
-    case 47: return ParseDeclare(alioth::AsNtrm(node));
-    case 57: return ParseElse(alioth::AsNtrm(node));
-    case 58: return ParseElseif(alioth::AsNtrm(node));
-    case 52: return ParseExpression(alioth::AsNtrm(node));
-    case 51: return ParseFunction(alioth::AsNtrm(node));
-    case 55: return ParseIf(alioth::AsNtrm(node));
-    case 49: return ParseIterate(alioth::AsNtrm(node));
-    case 45: return ParsePlay(alioth::AsNtrm(node));
-    case 46: return ParseStmt(alioth::AsNtrm(node));
+    case kBranch: return ParseBranch(node->AsNtrm());
+    case kControl: return ParseControl(node->AsNtrm());
+    case kDeclare: return ParseDeclare(node->AsNtrm());
+    case kElse: return ParseElse(node->AsNtrm());
+    case kElseif: return ParseElseif(node->AsNtrm());
+    case kExpression: return ParseExpression(node->AsNtrm());
+    case kFunction: return ParseFunction(node->AsNtrm());
+    case kIf: return ParseIf(node->AsNtrm());
+    case kIterate: return ParseIterate(node->AsNtrm());
+    case kPlay: return ParsePlay(node->AsNtrm());
+    case kStmt: return ParseStmt(node->AsNtrm());
     
     default: break;
   }
@@ -202,19 +201,2909 @@ alioth::ASTAttr ParseArbitraryAttribute(alioth::AST node) {
 std::shared_ptr<PlayNode> ParsePlay(alioth::Doc source) {
   auto syntax = SyntaxOf();
   auto parser = alioth::Parser(syntax, source);
+  parser.UseScanner(&Scan);
   auto root = parser.Parse();
-  auto play = ParsePlay(AsNtrm(alioth::AttrOf(root, "play")));
+  auto play = ParsePlay(root->Attr("play")->AsNtrm());
   play->root = root;
   return play;
 }
 
 alioth::Syntax SyntaxOf() {
-  static uint8_t binary[] = {
-    165, 104, 102, 111, 114, 109, 117, 108, 97, 115, 152, 66, 162, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 100, 112, 108, 97, 121, 98, 105, 100, 24, 45, 100, 104, 101, 97, 100, 24, 44, 162, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 101, 115, 116, 109, 116, 115, 98, 105, 100, 24, 46, 100, 104, 101, 97, 100, 24, 45, 162, 100, 98, 111, 100, 121, 131, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 45, 161, 98, 105, 100, 8, 162, 100, 97, 116, 116, 114, 101, 115, 116, 109, 116, 115, 98, 105, 100, 24, 46, 100, 104, 101, 97, 100, 24, 45, 162, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 103, 100, 101, 99, 108, 97, 114, 101, 98, 105, 100, 24, 47, 100, 104, 101, 97, 100, 24, 46, 162, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 102, 98, 114, 97, 110, 99, 104, 98, 105, 100, 24, 48, 100, 104, 101, 97, 100, 24, 46, 162, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 103, 105, 116, 101, 114, 97, 116, 101, 98, 105, 100, 24, 49, 100, 104, 101, 97, 100, 24, 46, 162, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 103, 99, 111, 110, 116, 114, 111, 108, 98, 105, 100, 24, 50, 100, 104, 101, 97, 100, 24, 46, 162, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 104, 102, 117, 110, 99, 116, 105, 111, 110, 98, 105, 100, 24, 51, 100, 104, 101, 97, 100, 24, 46, 162, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 106, 101, 120, 112, 114, 101, 115, 115, 105, 111, 110, 98, 105, 100, 24, 52, 100, 104, 101, 97, 100, 24, 46, 162, 100, 98, 111, 100, 121, 131, 161, 98, 105, 100, 5, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 54, 161, 98, 105, 100, 6, 100, 104, 101, 97, 100, 24, 53, 162, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 101, 115, 116, 109, 116, 115, 98, 105, 100, 24, 46, 100, 104, 101, 97, 100, 24, 54, 162, 100, 98, 111, 100, 121, 130, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 54, 161, 98, 105, 100, 8, 100, 104, 101, 97, 100, 24, 54, 162, 100, 98, 111, 100, 121, 131, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 54, 161, 98, 105, 100, 8, 162, 100, 97, 116, 116, 114, 101, 115, 116, 109, 116, 115, 98, 105, 100, 24, 46, 100, 104, 101, 97, 100, 24, 54, 162, 100, 98, 111, 100, 121, 130, 161, 98, 105, 100, 24, 29, 162, 100, 97, 116, 116, 114, 100, 110, 97, 109, 101, 98, 105, 100, 24, 42, 100, 104, 101, 97, 100, 24, 47, 162, 100, 98, 111, 100, 121, 132, 161, 98, 105, 100, 24, 29, 162, 100, 97, 116, 116, 114, 100, 110, 97, 109, 101, 98, 105, 100, 24, 42, 161, 98, 105, 100, 24, 28, 162, 100, 97, 116, 116, 114, 100, 105, 110, 105, 116, 98, 105, 100, 24, 52, 100, 104, 101, 97, 100, 24, 47, 162, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 103, 98, 114, 97, 110, 99, 104, 115, 98, 105, 100, 24, 55, 100, 104, 101, 97, 100, 24, 48, 162, 100, 98, 111, 100, 121, 130, 162, 100, 97, 116, 116, 114, 103, 98, 114, 97, 110, 99, 104, 115, 98, 105, 100, 24, 55, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 56, 100, 104, 101, 97, 100, 24, 48, 162, 100, 98, 111, 100, 121, 130, 162, 100, 97, 116, 116, 114, 103, 98, 114, 97, 110, 99, 104, 115, 98, 105, 100, 24, 55, 162, 100, 97, 116, 116, 114, 103, 98, 114, 97, 110, 99, 104, 115, 98, 105, 100, 24, 57, 100, 104, 101, 97, 100, 24, 48, 162, 100, 98, 111, 100, 121, 131, 162, 100, 97, 116, 116, 114, 103, 98, 114, 97, 110, 99, 104, 115, 98, 105, 100, 24, 55, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 56, 162, 100, 97, 116, 116, 114, 103, 98, 114, 97, 110, 99, 104, 115, 98, 105, 100, 24, 57, 100, 104, 101, 97, 100, 24, 48, 162, 100, 98, 111, 100, 121, 133, 161, 98, 105, 100, 24, 31, 161, 98, 105, 100, 1, 162, 100, 97, 116, 116, 114, 105, 99, 111, 110, 100, 105, 116, 105, 111, 110, 98, 105, 100, 24, 52, 161, 98, 105, 100, 2, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 53, 100, 104, 101, 97, 100, 24, 55, 162, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 103, 98, 114, 97, 110, 99, 104, 115, 98, 105, 100, 24, 58, 100, 104, 101, 97, 100, 24, 56, 162, 100, 98, 111, 100, 121, 130, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 56, 162, 100, 97, 116, 116, 114, 103, 98, 114, 97, 110, 99, 104, 115, 98, 105, 100, 24, 58, 100, 104, 101, 97, 100, 24, 56, 162, 100, 98, 111, 100, 121, 134, 161, 98, 105, 100, 24, 32, 161, 98, 105, 100, 24, 31, 161, 98, 105, 100, 1, 162, 100, 97, 116, 116, 114, 105, 99, 111, 110, 100, 105, 116, 105, 111, 110, 98, 105, 100, 24, 52, 161, 98, 105, 100, 2, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 53, 100, 104, 101, 97, 100, 24, 58, 162, 100, 98, 111, 100, 121, 130, 161, 98, 105, 100, 24, 32, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 53, 100, 104, 101, 97, 100, 24, 57, 162, 100, 98, 111, 100, 121, 134, 161, 98, 105, 100, 24, 33, 161, 98, 105, 100, 1, 161, 98, 105, 100, 8, 161, 98, 105, 100, 8, 161, 98, 105, 100, 2, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 53, 100, 104, 101, 97, 100, 24, 49, 162, 100, 98, 111, 100, 121, 135, 161, 98, 105, 100, 24, 33, 161, 98, 105, 100, 1, 162, 100, 97, 116, 116, 114, 100, 105, 110, 105, 116, 98, 105, 100, 24, 47, 161, 98, 105, 100, 8, 161, 98, 105, 100, 8, 161, 98, 105, 100, 2, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 53, 100, 104, 101, 97, 100, 24, 49, 162, 100, 98, 111, 100, 121, 135, 161, 98, 105, 100, 24, 33, 161, 98, 105, 100, 1, 161, 98, 105, 100, 8, 162, 100, 97, 116, 116, 114, 100, 99, 111, 110, 100, 98, 105, 100, 24, 52, 161, 98, 105, 100, 8, 161, 98, 105, 100, 2, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 53, 100, 104, 101, 97, 100, 24, 49, 162, 100, 98, 111, 100, 121, 136, 161, 98, 105, 100, 24, 33, 161, 98, 105, 100, 1, 162, 100, 97, 116, 116, 114, 100, 105, 110, 105, 116, 98, 105, 100, 24, 47, 161, 98, 105, 100, 8, 162, 100, 97, 116, 116, 114, 100, 99, 111, 110, 100, 98, 105, 100, 24, 52, 161, 98, 105, 100, 8, 161, 98, 105, 100, 2, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 53, 100, 104, 101, 97, 100, 24, 49, 162, 100, 98, 111, 100, 121, 135, 161, 98, 105, 100, 24, 33, 161, 98, 105, 100, 1, 161, 98, 105, 100, 8, 161, 98, 105, 100, 8, 162, 100, 97, 116, 116, 114, 100, 99, 116, 114, 108, 98, 105, 100, 24, 52, 161, 98, 105, 100, 2, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 53, 100, 104, 101, 97, 100, 24, 49, 162, 100, 98, 111, 100, 121, 136, 161, 98, 105, 100, 24, 33, 161, 98, 105, 100, 1, 162, 100, 97, 116, 116, 114, 100, 105, 110, 105, 116, 98, 105, 100, 24, 47, 161, 98, 105, 100, 8, 161, 98, 105, 100, 8, 162, 100, 97, 116, 116, 114, 100, 99, 116, 114, 108, 98, 105, 100, 24, 52, 161, 98, 105, 100, 2, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 53, 100, 104, 101, 97, 100, 24, 49, 162, 100, 98, 111, 100, 121, 136, 161, 98, 105, 100, 24, 33, 161, 98, 105, 100, 1, 161, 98, 105, 100, 8, 162, 100, 97, 116, 116, 114, 100, 99, 111, 110, 100, 98, 105, 100, 24, 52, 161, 98, 105, 100, 8, 162, 100, 97, 116, 116, 114, 100, 99, 116, 114, 108, 98, 105, 100, 24, 52, 161, 98, 105, 100, 2, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 53, 100, 104, 101, 97, 100, 24, 49, 162, 100, 98, 111, 100, 121, 137, 161, 98, 105, 100, 24, 33, 161, 98, 105, 100, 1, 162, 100, 97, 116, 116, 114, 100, 105, 110, 105, 116, 98, 105, 100, 24, 47, 161, 98, 105, 100, 8, 162, 100, 97, 116, 116, 114, 100, 99, 111, 110, 100, 98, 105, 100, 24, 52, 161, 98, 105, 100, 8, 162, 100, 97, 116, 116, 114, 100, 99, 116, 114, 108, 98, 105, 100, 24, 52, 161, 98, 105, 100, 2, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 53, 100, 104, 101, 97, 100, 24, 49, 163, 100, 98, 111, 100, 121, 129, 161, 98, 105, 100, 24, 35, 100, 102, 111, 114, 109, 101, 98, 114, 101, 97, 107, 100, 104, 101, 97, 100, 24, 50, 163, 100, 98, 111, 100, 121, 129, 161, 98, 105, 100, 24, 34, 100, 102, 111, 114, 109, 104, 99, 111, 110, 116, 105, 110, 117, 101, 100, 104, 101, 97, 100, 24, 50, 163, 100, 98, 111, 100, 121, 129, 161, 98, 105, 100, 24, 36, 100, 102, 111, 114, 109, 102, 114, 101, 116, 117, 114, 110, 100, 104, 101, 97, 100, 24, 50, 163, 100, 98, 111, 100, 121, 130, 161, 98, 105, 100, 24, 36, 162, 100, 97, 116, 116, 114, 100, 101, 120, 112, 114, 98, 105, 100, 24, 52, 100, 102, 111, 114, 109, 102, 114, 101, 116, 117, 114, 110, 100, 104, 101, 97, 100, 24, 50, 162, 100, 98, 111, 100, 121, 133, 161, 98, 105, 100, 24, 30, 162, 100, 97, 116, 116, 114, 100, 110, 97, 109, 101, 98, 105, 100, 24, 42, 161, 98, 105, 100, 1, 161, 98, 105, 100, 2, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 53, 100, 104, 101, 97, 100, 24, 51, 162, 100, 98, 111, 100, 121, 134, 161, 98, 105, 100, 24, 30, 162, 100, 97, 116, 116, 114, 100, 110, 97, 109, 101, 98, 105, 100, 24, 42, 161, 98, 105, 100, 1, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 59, 161, 98, 105, 100, 2, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 53, 100, 104, 101, 97, 100, 24, 51, 162, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 102, 112, 97, 114, 97, 109, 115, 98, 105, 100, 24, 42, 100, 104, 101, 97, 100, 24, 59, 162, 100, 98, 111, 100, 121, 131, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 59, 161, 98, 105, 100, 7, 162, 100, 97, 116, 116, 114, 102, 112, 97, 114, 97, 109, 115, 98, 105, 100, 24, 42, 100, 104, 101, 97, 100, 24, 59, 162, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 60, 100, 104, 101, 97, 100, 24, 52, 163, 100, 98, 111, 100, 121, 131, 162, 100, 97, 116, 116, 114, 99, 108, 104, 115, 98, 105, 100, 24, 52, 162, 100, 97, 116, 116, 114, 98, 111, 112, 98, 105, 100, 24, 28, 162, 100, 97, 116, 116, 114, 99, 114, 104, 115, 98, 105, 100, 24, 60, 100, 102, 111, 114, 109, 102, 98, 105, 110, 97, 114, 121, 100, 104, 101, 97, 100, 24, 52, 162, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 61, 100, 104, 101, 97, 100, 24, 60, 163, 100, 98, 111, 100, 121, 131, 162, 100, 97, 116, 116, 114, 99, 108, 104, 115, 98, 105, 100, 24, 60, 162, 100, 97, 116, 116, 114, 98, 111, 112, 98, 105, 100, 21, 162, 100, 97, 116, 116, 114, 99, 114, 104, 115, 98, 105, 100, 24, 61, 100, 102, 111, 114, 109, 102, 98, 105, 110, 97, 114, 121, 100, 104, 101, 97, 100, 24, 60, 163, 100, 98, 111, 100, 121, 131, 162, 100, 97, 116, 116, 114, 99, 108, 104, 115, 98, 105, 100, 24, 60, 162, 100, 97, 116, 116, 114, 98, 111, 112, 98, 105, 100, 22, 162, 100, 97, 116, 116, 114, 99, 114, 104, 115, 98, 105, 100, 24, 61, 100, 102, 111, 114, 109, 102, 98, 105, 110, 97, 114, 121, 100, 104, 101, 97, 100, 24, 60, 162, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 62, 100, 104, 101, 97, 100, 24, 61, 163, 100, 98, 111, 100, 121, 131, 162, 100, 97, 116, 116, 114, 99, 108, 104, 115, 98, 105, 100, 24, 61, 162, 100, 97, 116, 116, 114, 98, 111, 112, 98, 105, 100, 10, 162, 100, 97, 116, 116, 114, 99, 114, 104, 115, 98, 105, 100, 24, 62, 100, 102, 111, 114, 109, 102, 98, 105, 110, 97, 114, 121, 100, 104, 101, 97, 100, 24, 61, 163, 100, 98, 111, 100, 121, 131, 162, 100, 97, 116, 116, 114, 99, 108, 104, 115, 98, 105, 100, 24, 61, 162, 100, 97, 116, 116, 114, 98, 111, 112, 98, 105, 100, 11, 162, 100, 97, 116, 116, 114, 99, 114, 104, 115, 98, 105, 100, 24, 62, 100, 102, 111, 114, 109, 102, 98, 105, 110, 97, 114, 121, 100, 104, 101, 97, 100, 24, 61, 162, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 63, 100, 104, 101, 97, 100, 24, 62, 163, 100, 98, 111, 100, 121, 131, 162, 100, 97, 116, 116, 114, 99, 108, 104, 115, 98, 105, 100, 24, 62, 162, 100, 97, 116, 116, 114, 98, 111, 112, 98, 105, 100, 12, 162, 100, 97, 116, 116, 114, 99, 114, 104, 115, 98, 105, 100, 24, 63, 100, 102, 111, 114, 109, 102, 98, 105, 110, 97, 114, 121, 100, 104, 101, 97, 100, 24, 62, 163, 100, 98, 111, 100, 121, 131, 162, 100, 97, 116, 116, 114, 99, 108, 104, 115, 98, 105, 100, 24, 62, 162, 100, 97, 116, 116, 114, 98, 111, 112, 98, 105, 100, 13, 162, 100, 97, 116, 116, 114, 99, 114, 104, 115, 98, 105, 100, 24, 63, 100, 102, 111, 114, 109, 102, 98, 105, 110, 97, 114, 121, 100, 104, 101, 97, 100, 24, 62, 163, 100, 98, 111, 100, 121, 131, 162, 100, 97, 116, 116, 114, 99, 108, 104, 115, 98, 105, 100, 24, 62, 162, 100, 97, 116, 116, 114, 98, 111, 112, 98, 105, 100, 14, 162, 100, 97, 116, 116, 114, 99, 114, 104, 115, 98, 105, 100, 24, 63, 100, 102, 111, 114, 109, 102, 98, 105, 110, 97, 114, 121, 100, 104, 101, 97, 100, 24, 62, 162, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 64, 100, 104, 101, 97, 100, 24, 63, 163, 100, 98, 111, 100, 121, 131, 162, 100, 97, 116, 116, 114, 99, 108, 104, 115, 98, 105, 100, 24, 63, 162, 100, 97, 116, 116, 114, 98, 111, 112, 98, 105, 100, 24, 24, 162, 100, 97, 116, 116, 114, 99, 114, 104, 115, 98, 105, 100, 24, 64, 100, 102, 111, 114, 109, 102, 98, 105, 110, 97, 114, 121, 100, 104, 101, 97, 100, 24, 63, 163, 100, 98, 111, 100, 121, 131, 162, 100, 97, 116, 116, 114, 99, 108, 104, 115, 98, 105, 100, 24, 63, 162, 100, 97, 116, 116, 114, 98, 111, 112, 98, 105, 100, 24, 25, 162, 100, 97, 116, 116, 114, 99, 114, 104, 115, 98, 105, 100, 24, 64, 100, 102, 111, 114, 109, 102, 98, 105, 110, 97, 114, 121, 100, 104, 101, 97, 100, 24, 63, 163, 100, 98, 111, 100, 121, 131, 162, 100, 97, 116, 116, 114, 99, 108, 104, 115, 98, 105, 100, 24, 63, 162, 100, 97, 116, 116, 114, 98, 111, 112, 98, 105, 100, 24, 27, 162, 100, 97, 116, 116, 114, 99, 114, 104, 115, 98, 105, 100, 24, 64, 100, 102, 111, 114, 109, 102, 98, 105, 110, 97, 114, 121, 100, 104, 101, 97, 100, 24, 63, 163, 100, 98, 111, 100, 121, 130, 162, 100, 97, 116, 116, 114, 98, 111, 112, 98, 105, 100, 11, 162, 100, 97, 116, 116, 114, 99, 114, 104, 115, 98, 105, 100, 24, 64, 100, 102, 111, 114, 109, 100, 109, 111, 110, 111, 100, 104, 101, 97, 100, 24, 64, 163, 100, 98, 111, 100, 121, 130, 162, 100, 97, 116, 116, 114, 98, 111, 112, 98, 105, 100, 23, 162, 100, 97, 116, 116, 114, 99, 114, 104, 115, 98, 105, 100, 24, 64, 100, 102, 111, 114, 109, 100, 109, 111, 110, 111, 100, 104, 101, 97, 100, 24, 64, 163, 100, 98, 111, 100, 121, 130, 162, 100, 97, 116, 116, 114, 98, 111, 112, 98, 105, 100, 24, 26, 162, 100, 97, 116, 116, 114, 99, 114, 104, 115, 98, 105, 100, 24, 64, 100, 102, 111, 114, 109, 100, 109, 111, 110, 111, 100, 104, 101, 97, 100, 24, 64, 163, 100, 98, 111, 100, 121, 131, 161, 98, 105, 100, 1, 162, 100, 97, 116, 116, 114, 100, 101, 120, 112, 114, 98, 105, 100, 24, 52, 161, 98, 105, 100, 2, 100, 102, 111, 114, 109, 99, 115, 117, 98, 100, 104, 101, 97, 100, 24, 64, 163, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 100, 110, 97, 109, 101, 98, 105, 100, 24, 42, 100, 102, 111, 114, 109, 99, 118, 97, 114, 100, 104, 101, 97, 100, 24, 64, 163, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 102, 115, 116, 114, 105, 110, 103, 98, 105, 100, 24, 40, 100, 102, 111, 114, 109, 101, 118, 97, 108, 117, 101, 100, 104, 101, 97, 100, 24, 64, 163, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 102, 110, 117, 109, 98, 101, 114, 98, 105, 100, 24, 41, 100, 102, 111, 114, 109, 101, 118, 97, 108, 117, 101, 100, 104, 101, 97, 100, 24, 64, 163, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 103, 98, 111, 111, 108, 101, 97, 110, 98, 105, 100, 24, 38, 100, 102, 111, 114, 109, 101, 118, 97, 108, 117, 101, 100, 104, 101, 97, 100, 24, 64, 163, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 103, 98, 111, 111, 108, 101, 97, 110, 98, 105, 100, 24, 39, 100, 102, 111, 114, 109, 101, 118, 97, 108, 117, 101, 100, 104, 101, 97, 100, 24, 64, 163, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 100, 110, 117, 108, 108, 98, 105, 100, 24, 37, 100, 102, 111, 114, 109, 101, 118, 97, 108, 117, 101, 100, 104, 101, 97, 100, 24, 64, 103, 105, 103, 110, 111, 114, 101, 115, 129, 24, 43, 99, 108, 101, 120, 163, 104, 99, 111, 110, 116, 101, 120, 116, 115, 130, 100, 112, 108, 97, 121, 100, 106, 115, 111, 110, 102, 115, 116, 97, 116, 101, 115, 152, 88, 161, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 162, 97, 48, 1, 97, 49, 2, 161, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 91, 98, 49, 48, 3, 99, 49, 48, 48, 22, 99, 49, 48, 49, 24, 28, 99, 49, 48, 50, 24, 87, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 24, 30, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 24, 31, 99, 49, 48, 57, 22, 98, 49, 49, 3, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 24, 33, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 98, 49, 50, 3, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 99, 49, 50, 51, 24, 35, 99, 49, 50, 52, 24, 36, 99, 49, 50, 53, 24, 37, 99, 49, 50, 54, 24, 38, 98, 49, 51, 3, 98, 51, 50, 3, 98, 51, 51, 4, 98, 51, 55, 6, 98, 51, 56, 7, 98, 52, 48, 8, 98, 52, 49, 9, 98, 52, 50, 10, 98, 52, 51, 11, 98, 52, 52, 12, 98, 52, 53, 13, 98, 52, 54, 14, 98, 52, 55, 15, 98, 52, 56, 16, 98, 52, 57, 17, 98, 53, 48, 17, 98, 53, 49, 17, 98, 53, 50, 17, 98, 53, 51, 17, 98, 53, 52, 17, 98, 53, 53, 17, 98, 53, 54, 17, 98, 53, 55, 17, 98, 53, 57, 18, 98, 54, 48, 19, 98, 54, 49, 20, 98, 54, 50, 21, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 97, 57, 3, 98, 57, 48, 22, 98, 57, 49, 23, 98, 57, 51, 24, 24, 98, 57, 52, 24, 25, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 24, 26, 98, 57, 57, 24, 27, 161, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 92, 98, 49, 48, 3, 99, 49, 48, 48, 22, 99, 49, 48, 49, 24, 28, 99, 49, 48, 50, 24, 29, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 24, 30, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 24, 31, 99, 49, 48, 57, 22, 98, 49, 49, 3, 99, 49, 49, 48, 24, 32, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 24, 33, 99, 49, 49, 53, 22, 99, 49, 49, 54, 24, 34, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 98, 49, 50, 3, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 99, 49, 50, 51, 24, 35, 99, 49, 50, 52, 24, 36, 99, 49, 50, 53, 24, 37, 99, 49, 50, 54, 24, 38, 98, 49, 51, 3, 98, 51, 50, 3, 98, 51, 51, 4, 98, 51, 52, 5, 98, 51, 55, 6, 98, 51, 56, 7, 98, 52, 48, 8, 98, 52, 49, 9, 98, 52, 50, 10, 98, 52, 51, 11, 98, 52, 52, 12, 98, 52, 53, 13, 98, 52, 54, 14, 98, 52, 55, 15, 98, 52, 56, 16, 98, 52, 57, 17, 98, 53, 48, 17, 98, 53, 49, 17, 98, 53, 50, 17, 98, 53, 51, 17, 98, 53, 52, 17, 98, 53, 53, 17, 98, 53, 54, 17, 98, 53, 55, 17, 98, 53, 57, 18, 98, 54, 48, 19, 98, 54, 49, 20, 98, 54, 50, 21, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 97, 57, 3, 98, 57, 48, 22, 98, 57, 49, 23, 98, 57, 51, 24, 24, 98, 57, 52, 24, 25, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 24, 26, 98, 57, 57, 24, 27, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 43, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 166, 98, 49, 48, 3, 98, 49, 49, 3, 98, 49, 50, 3, 98, 49, 51, 3, 98, 51, 50, 3, 97, 57, 3, 162, 103, 97, 99, 99, 101, 112, 116, 115, 23, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 161, 98, 54, 49, 24, 86, 161, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 254, 98, 45, 49, 5, 99, 45, 49, 48, 5, 100, 45, 49, 48, 48, 5, 100, 45, 49, 48, 49, 5, 100, 45, 49, 48, 50, 5, 100, 45, 49, 48, 51, 5, 100, 45, 49, 48, 52, 5, 100, 45, 49, 48, 53, 5, 100, 45, 49, 48, 54, 5, 100, 45, 49, 48, 55, 5, 100, 45, 49, 48, 56, 5, 100, 45, 49, 48, 57, 5, 99, 45, 49, 49, 5, 100, 45, 49, 49, 48, 5, 100, 45, 49, 49, 49, 5, 100, 45, 49, 49, 50, 5, 100, 45, 49, 49, 51, 5, 100, 45, 49, 49, 52, 5, 100, 45, 49, 49, 53, 5, 100, 45, 49, 49, 54, 5, 100, 45, 49, 49, 55, 5, 100, 45, 49, 49, 56, 5, 100, 45, 49, 49, 57, 5, 99, 45, 49, 50, 5, 100, 45, 49, 50, 48, 5, 100, 45, 49, 50, 49, 5, 100, 45, 49, 50, 50, 5, 100, 45, 49, 50, 51, 5, 100, 45, 49, 50, 52, 5, 100, 45, 49, 50, 53, 5, 100, 45, 49, 50, 54, 5, 100, 45, 49, 50, 55, 5, 100, 45, 49, 50, 56, 5, 99, 45, 49, 51, 5, 99, 45, 49, 52, 5, 99, 45, 49, 53, 5, 99, 45, 49, 54, 5, 99, 45, 49, 55, 5, 99, 45, 49, 56, 5, 99, 45, 49, 57, 5, 98, 45, 50, 5, 99, 45, 50, 48, 5, 99, 45, 50, 49, 5, 99, 45, 50, 50, 5, 99, 45, 50, 51, 5, 99, 45, 50, 52, 5, 99, 45, 50, 53, 5, 99, 45, 50, 54, 5, 99, 45, 50, 55, 5, 99, 45, 50, 56, 5, 99, 45, 50, 57, 5, 98, 45, 51, 5, 99, 45, 51, 48, 5, 99, 45, 51, 49, 5, 99, 45, 51, 50, 5, 99, 45, 51, 51, 5, 99, 45, 51, 52, 5, 99, 45, 51, 53, 5, 99, 45, 51, 54, 5, 99, 45, 51, 55, 5, 99, 45, 51, 56, 5, 99, 45, 51, 57, 5, 98, 45, 52, 5, 99, 45, 52, 48, 5, 99, 45, 52, 49, 5, 99, 45, 52, 50, 5, 99, 45, 52, 51, 5, 99, 45, 52, 52, 5, 99, 45, 52, 53, 5, 99, 45, 52, 54, 5, 99, 45, 52, 55, 5, 99, 45, 52, 56, 5, 99, 45, 52, 57, 5, 98, 45, 53, 5, 99, 45, 53, 48, 5, 99, 45, 53, 49, 5, 99, 45, 53, 50, 5, 99, 45, 53, 51, 5, 99, 45, 53, 52, 5, 99, 45, 53, 53, 5, 99, 45, 53, 54, 5, 99, 45, 53, 55, 5, 99, 45, 53, 56, 5, 99, 45, 53, 57, 5, 98, 45, 54, 5, 99, 45, 54, 48, 5, 99, 45, 54, 49, 5, 99, 45, 54, 50, 5, 99, 45, 54, 51, 5, 99, 45, 54, 52, 5, 99, 45, 54, 53, 5, 99, 45, 54, 54, 5, 99, 45, 54, 55, 5, 99, 45, 54, 56, 5, 99, 45, 54, 57, 5, 98, 45, 55, 5, 99, 45, 55, 48, 5, 99, 45, 55, 49, 5, 99, 45, 55, 50, 5, 99, 45, 55, 51, 5, 99, 45, 55, 52, 5, 99, 45, 55, 53, 5, 99, 45, 55, 54, 5, 99, 45, 55, 55, 5, 99, 45, 55, 56, 5, 99, 45, 55, 57, 5, 98, 45, 56, 5, 99, 45, 56, 48, 5, 99, 45, 56, 49, 5, 99, 45, 56, 50, 5, 99, 45, 56, 51, 5, 99, 45, 56, 52, 5, 99, 45, 56, 53, 5, 99, 45, 56, 54, 5, 99, 45, 56, 55, 5, 99, 45, 56, 56, 5, 99, 45, 56, 57, 5, 98, 45, 57, 5, 99, 45, 57, 48, 5, 99, 45, 57, 49, 5, 99, 45, 57, 50, 5, 99, 45, 57, 51, 5, 99, 45, 57, 52, 5, 99, 45, 57, 53, 5, 99, 45, 57, 54, 5, 99, 45, 57, 55, 5, 99, 45, 57, 56, 5, 99, 45, 57, 57, 5, 97, 49, 5, 99, 49, 48, 48, 5, 99, 49, 48, 49, 5, 99, 49, 48, 50, 5, 99, 49, 48, 51, 5, 99, 49, 48, 52, 5, 99, 49, 48, 53, 5, 99, 49, 48, 54, 5, 99, 49, 48, 55, 5, 99, 49, 48, 56, 5, 99, 49, 48, 57, 5, 98, 49, 49, 5, 99, 49, 49, 48, 5, 99, 49, 49, 49, 5, 99, 49, 49, 50, 5, 99, 49, 49, 51, 5, 99, 49, 49, 52, 5, 99, 49, 49, 53, 5, 99, 49, 49, 54, 5, 99, 49, 49, 55, 5, 99, 49, 49, 56, 5, 99, 49, 49, 57, 5, 98, 49, 50, 5, 99, 49, 50, 48, 5, 99, 49, 50, 49, 5, 99, 49, 50, 50, 5, 99, 49, 50, 51, 5, 99, 49, 50, 52, 5, 99, 49, 50, 53, 5, 99, 49, 50, 54, 5, 99, 49, 50, 55, 5, 98, 49, 51, 5, 98, 49, 52, 5, 98, 49, 53, 5, 98, 49, 54, 5, 98, 49, 55, 5, 98, 49, 56, 5, 98, 49, 57, 5, 97, 50, 5, 98, 50, 48, 5, 98, 50, 49, 5, 98, 50, 50, 5, 98, 50, 51, 5, 98, 50, 52, 5, 98, 50, 53, 5, 98, 50, 54, 5, 98, 50, 55, 5, 98, 50, 56, 5, 98, 50, 57, 5, 97, 51, 5, 98, 51, 48, 5, 98, 51, 49, 5, 98, 51, 50, 5, 98, 51, 51, 5, 98, 51, 52, 24, 84, 98, 51, 53, 5, 98, 51, 54, 5, 98, 51, 55, 5, 98, 51, 56, 5, 98, 51, 57, 5, 97, 52, 5, 98, 52, 48, 5, 98, 52, 49, 5, 98, 52, 50, 5, 98, 52, 51, 5, 98, 52, 52, 5, 98, 52, 53, 5, 98, 52, 54, 5, 98, 52, 55, 5, 98, 52, 56, 5, 98, 52, 57, 5, 97, 53, 5, 98, 53, 48, 5, 98, 53, 49, 5, 98, 53, 50, 5, 98, 53, 51, 5, 98, 53, 52, 5, 98, 53, 53, 5, 98, 53, 54, 5, 98, 53, 55, 5, 98, 53, 56, 5, 98, 53, 57, 5, 97, 54, 5, 98, 54, 48, 5, 98, 54, 49, 5, 98, 54, 50, 5, 98, 54, 51, 5, 98, 54, 52, 5, 98, 54, 53, 5, 98, 54, 54, 5, 98, 54, 55, 5, 98, 54, 56, 5, 98, 54, 57, 5, 97, 55, 5, 98, 55, 48, 5, 98, 55, 49, 5, 98, 55, 50, 5, 98, 55, 51, 5, 98, 55, 52, 5, 98, 55, 53, 5, 98, 55, 54, 5, 98, 55, 55, 5, 98, 55, 56, 5, 98, 55, 57, 5, 97, 56, 5, 98, 56, 48, 5, 98, 56, 49, 5, 98, 56, 50, 5, 98, 56, 51, 5, 98, 56, 52, 5, 98, 56, 53, 5, 98, 56, 54, 5, 98, 56, 55, 5, 98, 56, 56, 5, 98, 56, 57, 5, 97, 57, 5, 98, 57, 48, 5, 98, 57, 49, 5, 98, 57, 50, 24, 85, 98, 57, 51, 5, 98, 57, 52, 5, 98, 57, 53, 5, 98, 57, 54, 5, 98, 57, 55, 5, 98, 57, 56, 5, 98, 57, 57, 5, 161, 103, 97, 99, 99, 101, 112, 116, 115, 14, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 24, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 161, 98, 51, 56, 24, 83, 161, 103, 97, 99, 99, 101, 112, 116, 115, 1, 161, 103, 97, 99, 99, 101, 112, 116, 115, 2, 161, 103, 97, 99, 99, 101, 112, 116, 115, 12, 161, 103, 97, 99, 99, 101, 112, 116, 115, 10, 161, 103, 97, 99, 99, 101, 112, 116, 115, 7, 161, 103, 97, 99, 99, 101, 112, 116, 115, 11, 161, 103, 97, 99, 99, 101, 112, 116, 115, 9, 161, 103, 97, 99, 99, 101, 112, 116, 115, 13, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 41, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 163, 99, 49, 48, 49, 24, 79, 98, 52, 54, 24, 78, 98, 54, 57, 24, 79, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 41, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 173, 99, 49, 48, 49, 24, 79, 98, 52, 54, 24, 78, 98, 52, 56, 17, 98, 52, 57, 17, 98, 53, 48, 17, 98, 53, 49, 17, 98, 53, 50, 17, 98, 53, 51, 17, 98, 53, 52, 17, 98, 53, 53, 17, 98, 53, 54, 17, 98, 53, 55, 17, 98, 54, 57, 24, 79, 161, 103, 97, 99, 99, 101, 112, 116, 115, 8, 162, 103, 97, 99, 99, 101, 112, 116, 115, 15, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 161, 98, 54, 49, 24, 77, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 28, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 161, 98, 54, 49, 24, 76, 162, 103, 97, 99, 99, 101, 112, 116, 115, 16, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 161, 98, 54, 49, 24, 75, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 161, 103, 97, 99, 99, 101, 112, 116, 115, 3, 161, 103, 97, 99, 99, 101, 112, 116, 115, 4, 161, 103, 97, 99, 99, 101, 112, 116, 115, 24, 27, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 24, 71, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 24, 64, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 24, 61, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 24, 55, 99, 49, 49, 49, 24, 56, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 24, 54, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 24, 53, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 24, 51, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 24, 48, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 24, 43, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 24, 40, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 161, 103, 97, 99, 99, 101, 112, 116, 115, 5, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 25, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 161, 99, 49, 50, 52, 24, 39, 161, 103, 97, 99, 99, 101, 112, 116, 115, 6, 161, 103, 97, 99, 99, 101, 112, 116, 115, 24, 26, 161, 103, 97, 99, 99, 101, 112, 116, 115, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 24, 41, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 24, 42, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 38, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 24, 44, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 24, 45, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 24, 46, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 24, 47, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 36, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 24, 49, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 24, 50, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 37, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 24, 52, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 29, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 31, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 24, 58, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 30, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 24, 57, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 33, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 24, 59, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 24, 60, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 39, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 24, 62, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 24, 63, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 32, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 24, 65, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 24, 66, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 24, 67, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 24, 68, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 24, 69, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 24, 70, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 34, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 24, 72, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 24, 73, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 24, 74, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 35, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 22, 99, 49, 49, 49, 22, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 161, 103, 97, 99, 99, 101, 112, 116, 115, 18, 161, 103, 97, 99, 99, 101, 112, 116, 115, 19, 161, 103, 97, 99, 99, 101, 112, 116, 115, 17, 161, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 170, 98, 52, 56, 24, 82, 98, 52, 57, 24, 82, 98, 53, 48, 24, 82, 98, 53, 49, 24, 82, 98, 53, 50, 24, 82, 98, 53, 51, 24, 82, 98, 53, 52, 24, 82, 98, 53, 53, 24, 82, 98, 53, 54, 24, 82, 98, 53, 55, 24, 82, 161, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 172, 98, 52, 51, 24, 80, 98, 52, 53, 24, 80, 98, 52, 56, 24, 81, 98, 52, 57, 24, 81, 98, 53, 48, 24, 81, 98, 53, 49, 24, 81, 98, 53, 50, 24, 81, 98, 53, 51, 24, 81, 98, 53, 52, 24, 81, 98, 53, 53, 24, 81, 98, 53, 54, 24, 81, 98, 53, 55, 24, 81, 161, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 170, 98, 52, 56, 24, 81, 98, 52, 57, 24, 81, 98, 53, 48, 24, 81, 98, 53, 49, 24, 81, 98, 53, 50, 24, 81, 98, 53, 51, 24, 81, 98, 53, 52, 24, 81, 98, 53, 53, 24, 81, 98, 53, 54, 24, 81, 98, 53, 55, 24, 81, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 41, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 170, 98, 52, 56, 24, 81, 98, 52, 57, 24, 81, 98, 53, 48, 24, 81, 98, 53, 49, 24, 81, 98, 53, 50, 24, 81, 98, 53, 51, 24, 81, 98, 53, 52, 24, 81, 98, 53, 53, 24, 81, 98, 53, 54, 24, 81, 98, 53, 55, 24, 81, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 41, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 172, 99, 49, 48, 49, 24, 79, 98, 52, 56, 24, 82, 98, 52, 57, 24, 82, 98, 53, 48, 24, 82, 98, 53, 49, 24, 82, 98, 53, 50, 24, 82, 98, 53, 51, 24, 82, 98, 53, 52, 24, 82, 98, 53, 53, 24, 82, 98, 53, 54, 24, 82, 98, 53, 55, 24, 82, 98, 54, 57, 24, 79, 161, 103, 97, 99, 99, 101, 112, 116, 115, 21, 161, 103, 97, 99, 99, 101, 112, 116, 115, 24, 40, 161, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 254, 98, 45, 49, 5, 99, 45, 49, 48, 5, 100, 45, 49, 48, 48, 5, 100, 45, 49, 48, 49, 5, 100, 45, 49, 48, 50, 5, 100, 45, 49, 48, 51, 5, 100, 45, 49, 48, 52, 5, 100, 45, 49, 48, 53, 5, 100, 45, 49, 48, 54, 5, 100, 45, 49, 48, 55, 5, 100, 45, 49, 48, 56, 5, 100, 45, 49, 48, 57, 5, 99, 45, 49, 49, 5, 100, 45, 49, 49, 48, 5, 100, 45, 49, 49, 49, 5, 100, 45, 49, 49, 50, 5, 100, 45, 49, 49, 51, 5, 100, 45, 49, 49, 52, 5, 100, 45, 49, 49, 53, 5, 100, 45, 49, 49, 54, 5, 100, 45, 49, 49, 55, 5, 100, 45, 49, 49, 56, 5, 100, 45, 49, 49, 57, 5, 99, 45, 49, 50, 5, 100, 45, 49, 50, 48, 5, 100, 45, 49, 50, 49, 5, 100, 45, 49, 50, 50, 5, 100, 45, 49, 50, 51, 5, 100, 45, 49, 50, 52, 5, 100, 45, 49, 50, 53, 5, 100, 45, 49, 50, 54, 5, 100, 45, 49, 50, 55, 5, 100, 45, 49, 50, 56, 5, 99, 45, 49, 51, 5, 99, 45, 49, 52, 5, 99, 45, 49, 53, 5, 99, 45, 49, 54, 5, 99, 45, 49, 55, 5, 99, 45, 49, 56, 5, 99, 45, 49, 57, 5, 98, 45, 50, 5, 99, 45, 50, 48, 5, 99, 45, 50, 49, 5, 99, 45, 50, 50, 5, 99, 45, 50, 51, 5, 99, 45, 50, 52, 5, 99, 45, 50, 53, 5, 99, 45, 50, 54, 5, 99, 45, 50, 55, 5, 99, 45, 50, 56, 5, 99, 45, 50, 57, 5, 98, 45, 51, 5, 99, 45, 51, 48, 5, 99, 45, 51, 49, 5, 99, 45, 51, 50, 5, 99, 45, 51, 51, 5, 99, 45, 51, 52, 5, 99, 45, 51, 53, 5, 99, 45, 51, 54, 5, 99, 45, 51, 55, 5, 99, 45, 51, 56, 5, 99, 45, 51, 57, 5, 98, 45, 52, 5, 99, 45, 52, 48, 5, 99, 45, 52, 49, 5, 99, 45, 52, 50, 5, 99, 45, 52, 51, 5, 99, 45, 52, 52, 5, 99, 45, 52, 53, 5, 99, 45, 52, 54, 5, 99, 45, 52, 55, 5, 99, 45, 52, 56, 5, 99, 45, 52, 57, 5, 98, 45, 53, 5, 99, 45, 53, 48, 5, 99, 45, 53, 49, 5, 99, 45, 53, 50, 5, 99, 45, 53, 51, 5, 99, 45, 53, 52, 5, 99, 45, 53, 53, 5, 99, 45, 53, 54, 5, 99, 45, 53, 55, 5, 99, 45, 53, 56, 5, 99, 45, 53, 57, 5, 98, 45, 54, 5, 99, 45, 54, 48, 5, 99, 45, 54, 49, 5, 99, 45, 54, 50, 5, 99, 45, 54, 51, 5, 99, 45, 54, 52, 5, 99, 45, 54, 53, 5, 99, 45, 54, 54, 5, 99, 45, 54, 55, 5, 99, 45, 54, 56, 5, 99, 45, 54, 57, 5, 98, 45, 55, 5, 99, 45, 55, 48, 5, 99, 45, 55, 49, 5, 99, 45, 55, 50, 5, 99, 45, 55, 51, 5, 99, 45, 55, 52, 5, 99, 45, 55, 53, 5, 99, 45, 55, 54, 5, 99, 45, 55, 55, 5, 99, 45, 55, 56, 5, 99, 45, 55, 57, 5, 98, 45, 56, 5, 99, 45, 56, 48, 5, 99, 45, 56, 49, 5, 99, 45, 56, 50, 5, 99, 45, 56, 51, 5, 99, 45, 56, 52, 5, 99, 45, 56, 53, 5, 99, 45, 56, 54, 5, 99, 45, 56, 55, 5, 99, 45, 56, 56, 5, 99, 45, 56, 57, 5, 98, 45, 57, 5, 99, 45, 57, 48, 5, 99, 45, 57, 49, 5, 99, 45, 57, 50, 5, 99, 45, 57, 51, 5, 99, 45, 57, 52, 5, 99, 45, 57, 53, 5, 99, 45, 57, 54, 5, 99, 45, 57, 55, 5, 99, 45, 57, 56, 5, 99, 45, 57, 57, 5, 97, 49, 5, 99, 49, 48, 48, 5, 99, 49, 48, 49, 5, 99, 49, 48, 50, 5, 99, 49, 48, 51, 5, 99, 49, 48, 52, 5, 99, 49, 48, 53, 5, 99, 49, 48, 54, 5, 99, 49, 48, 55, 5, 99, 49, 48, 56, 5, 99, 49, 48, 57, 5, 98, 49, 49, 5, 99, 49, 49, 48, 5, 99, 49, 49, 49, 5, 99, 49, 49, 50, 5, 99, 49, 49, 51, 5, 99, 49, 49, 52, 5, 99, 49, 49, 53, 5, 99, 49, 49, 54, 5, 99, 49, 49, 55, 5, 99, 49, 49, 56, 5, 99, 49, 49, 57, 5, 98, 49, 50, 5, 99, 49, 50, 48, 5, 99, 49, 50, 49, 5, 99, 49, 50, 50, 5, 99, 49, 50, 51, 5, 99, 49, 50, 52, 5, 99, 49, 50, 53, 5, 99, 49, 50, 54, 5, 99, 49, 50, 55, 5, 98, 49, 51, 5, 98, 49, 52, 5, 98, 49, 53, 5, 98, 49, 54, 5, 98, 49, 55, 5, 98, 49, 56, 5, 98, 49, 57, 5, 97, 50, 5, 98, 50, 48, 5, 98, 50, 49, 5, 98, 50, 50, 5, 98, 50, 51, 5, 98, 50, 52, 5, 98, 50, 53, 5, 98, 50, 54, 5, 98, 50, 55, 5, 98, 50, 56, 5, 98, 50, 57, 5, 97, 51, 5, 98, 51, 48, 5, 98, 51, 49, 5, 98, 51, 50, 5, 98, 51, 51, 5, 98, 51, 52, 5, 98, 51, 53, 5, 98, 51, 54, 5, 98, 51, 55, 5, 98, 51, 56, 5, 98, 51, 57, 5, 97, 52, 5, 98, 52, 48, 5, 98, 52, 49, 5, 98, 52, 50, 5, 98, 52, 51, 5, 98, 52, 52, 5, 98, 52, 53, 5, 98, 52, 54, 5, 98, 52, 55, 5, 98, 52, 56, 5, 98, 52, 57, 5, 97, 53, 5, 98, 53, 48, 5, 98, 53, 49, 5, 98, 53, 50, 5, 98, 53, 51, 5, 98, 53, 52, 5, 98, 53, 53, 5, 98, 53, 54, 5, 98, 53, 55, 5, 98, 53, 56, 5, 98, 53, 57, 5, 97, 54, 5, 98, 54, 48, 5, 98, 54, 49, 5, 98, 54, 50, 5, 98, 54, 51, 5, 98, 54, 52, 5, 98, 54, 53, 5, 98, 54, 54, 5, 98, 54, 55, 5, 98, 54, 56, 5, 98, 54, 57, 5, 97, 55, 5, 98, 55, 48, 5, 98, 55, 49, 5, 98, 55, 50, 5, 98, 55, 51, 5, 98, 55, 52, 5, 98, 55, 53, 5, 98, 55, 54, 5, 98, 55, 55, 5, 98, 55, 56, 5, 98, 55, 57, 5, 97, 56, 5, 98, 56, 48, 5, 98, 56, 49, 5, 98, 56, 50, 5, 98, 56, 51, 5, 98, 56, 52, 5, 98, 56, 53, 5, 98, 56, 54, 5, 98, 56, 55, 5, 98, 56, 56, 5, 98, 56, 57, 5, 97, 57, 5, 98, 57, 48, 5, 98, 57, 49, 5, 98, 57, 50, 5, 98, 57, 51, 5, 98, 57, 52, 5, 98, 57, 53, 5, 98, 57, 54, 5, 98, 57, 55, 5, 98, 57, 56, 5, 98, 57, 57, 5, 161, 103, 97, 99, 99, 101, 112, 116, 115, 20, 162, 103, 97, 99, 99, 101, 112, 116, 115, 24, 42, 107, 116, 114, 97, 110, 115, 105, 116, 105, 111, 110, 115, 184, 63, 99, 49, 48, 48, 22, 99, 49, 48, 49, 22, 99, 49, 48, 50, 22, 99, 49, 48, 51, 22, 99, 49, 48, 52, 22, 99, 49, 48, 53, 22, 99, 49, 48, 54, 22, 99, 49, 48, 55, 22, 99, 49, 48, 56, 22, 99, 49, 48, 57, 22, 99, 49, 49, 48, 24, 55, 99, 49, 49, 49, 24, 56, 99, 49, 49, 50, 22, 99, 49, 49, 51, 22, 99, 49, 49, 52, 22, 99, 49, 49, 53, 22, 99, 49, 49, 54, 22, 99, 49, 49, 55, 22, 99, 49, 49, 56, 22, 99, 49, 49, 57, 22, 99, 49, 50, 48, 22, 99, 49, 50, 49, 22, 99, 49, 50, 50, 22, 98, 52, 56, 22, 98, 52, 57, 22, 98, 53, 48, 22, 98, 53, 49, 22, 98, 53, 50, 22, 98, 53, 51, 22, 98, 53, 52, 22, 98, 53, 53, 22, 98, 53, 54, 22, 98, 53, 55, 22, 98, 54, 53, 22, 98, 54, 54, 22, 98, 54, 55, 22, 98, 54, 56, 22, 98, 54, 57, 22, 98, 55, 48, 22, 98, 55, 49, 22, 98, 55, 50, 22, 98, 55, 51, 22, 98, 55, 52, 22, 98, 55, 53, 22, 98, 55, 54, 22, 98, 55, 55, 22, 98, 55, 56, 22, 98, 55, 57, 22, 98, 56, 48, 22, 98, 56, 49, 22, 98, 56, 50, 22, 98, 56, 51, 22, 98, 56, 52, 22, 98, 56, 53, 22, 98, 56, 54, 22, 98, 56, 55, 22, 98, 56, 56, 22, 98, 56, 57, 22, 98, 57, 48, 22, 98, 57, 53, 22, 98, 57, 55, 22, 98, 57, 56, 22, 98, 57, 57, 22, 101, 116, 101, 114, 109, 115, 152, 44, 161, 100, 110, 97, 109, 101, 101, 60, 69, 79, 70, 62, 161, 100, 110, 97, 109, 101, 100, 84, 95, 76, 80, 161, 100, 110, 97, 109, 101, 100, 84, 95, 82, 80, 161, 100, 110, 97, 109, 101, 100, 84, 95, 76, 73, 161, 100, 110, 97, 109, 101, 100, 84, 95, 82, 73, 161, 100, 110, 97, 109, 101, 100, 84, 95, 76, 83, 161, 100, 110, 97, 109, 101, 100, 84, 95, 82, 83, 161, 100, 110, 97, 109, 101, 103, 84, 95, 67, 79, 77, 77, 65, 161, 100, 110, 97, 109, 101, 102, 84, 95, 83, 69, 77, 73, 161, 100, 110, 97, 109, 101, 101, 84, 95, 68, 79, 84, 161, 100, 110, 97, 109, 101, 101, 84, 95, 65, 68, 68, 161, 100, 110, 97, 109, 101, 101, 84, 95, 83, 85, 66, 161, 100, 110, 97, 109, 101, 101, 84, 95, 77, 85, 76, 161, 100, 110, 97, 109, 101, 101, 84, 95, 68, 73, 86, 161, 100, 110, 97, 109, 101, 101, 84, 95, 77, 79, 76, 161, 100, 110, 97, 109, 101, 100, 84, 95, 76, 84, 161, 100, 110, 97, 109, 101, 100, 84, 95, 71, 84, 161, 100, 110, 97, 109, 101, 100, 84, 95, 76, 69, 161, 100, 110, 97, 109, 101, 100, 84, 95, 71, 69, 161, 100, 110, 97, 109, 101, 100, 84, 95, 69, 81, 161, 100, 110, 97, 109, 101, 100, 84, 95, 78, 69, 161, 100, 110, 97, 109, 101, 101, 84, 95, 65, 78, 68, 161, 100, 110, 97, 109, 101, 100, 84, 95, 79, 82, 161, 100, 110, 97, 109, 101, 101, 84, 95, 78, 79, 84, 161, 100, 110, 97, 109, 101, 104, 84, 95, 66, 73, 84, 65, 78, 68, 161, 100, 110, 97, 109, 101, 103, 84, 95, 66, 73, 84, 79, 82, 161, 100, 110, 97, 109, 101, 104, 84, 95, 66, 73, 84, 78, 79, 84, 161, 100, 110, 97, 109, 101, 104, 84, 95, 66, 73, 84, 88, 79, 82, 161, 100, 110, 97, 109, 101, 104, 84, 95, 65, 83, 83, 73, 71, 78, 161, 100, 110, 97, 109, 101, 101, 84, 95, 76, 69, 84, 161, 100, 110, 97, 109, 101, 100, 84, 95, 70, 78, 161, 100, 110, 97, 109, 101, 100, 84, 95, 73, 70, 161, 100, 110, 97, 109, 101, 102, 84, 95, 69, 76, 83, 69, 161, 100, 110, 97, 109, 101, 101, 84, 95, 70, 79, 82, 161, 100, 110, 97, 109, 101, 106, 84, 95, 67, 79, 78, 84, 73, 78, 85, 69, 161, 100, 110, 97, 109, 101, 103, 84, 95, 66, 82, 69, 65, 75, 161, 100, 110, 97, 109, 101, 104, 84, 95, 82, 69, 84, 85, 82, 78, 162, 103, 101, 110, 116, 114, 105, 101, 115, 129, 1, 100, 110, 97, 109, 101, 102, 84, 95, 78, 85, 76, 76, 162, 103, 101, 110, 116, 114, 105, 101, 115, 129, 1, 100, 110, 97, 109, 101, 102, 84, 95, 84, 82, 85, 69, 162, 103, 101, 110, 116, 114, 105, 101, 115, 129, 1, 100, 110, 97, 109, 101, 103, 84, 95, 70, 65, 76, 83, 69, 162, 103, 101, 110, 116, 114, 105, 101, 115, 129, 1, 100, 110, 97, 109, 101, 104, 84, 95, 83, 84, 82, 73, 78, 71, 161, 100, 110, 97, 109, 101, 104, 84, 95, 78, 85, 77, 66, 69, 82, 161, 100, 110, 97, 109, 101, 100, 84, 95, 73, 68, 161, 100, 110, 97, 109, 101, 103, 84, 95, 83, 80, 65, 67, 69, 101, 110, 116, 114, 109, 115, 149, 98, 83, 39, 100, 112, 108, 97, 121, 100, 115, 116, 109, 116, 103, 100, 101, 99, 108, 97, 114, 101, 102, 98, 114, 97, 110, 99, 104, 103, 105, 116, 101, 114, 97, 116, 101, 103, 99, 111, 110, 116, 114, 111, 108, 104, 102, 117, 110, 99, 116, 105, 111, 110, 106, 101, 120, 112, 114, 101, 115, 115, 105, 111, 110, 101, 98, 108, 111, 99, 107, 101, 115, 116, 109, 116, 115, 98, 105, 102, 103, 101, 108, 115, 101, 105, 102, 115, 100, 101, 108, 115, 101, 102, 101, 108, 115, 101, 105, 102, 102, 112, 97, 114, 97, 109, 115, 105, 112, 114, 105, 111, 114, 105, 116, 121, 52, 105, 112, 114, 105, 111, 114, 105, 116, 121, 51, 105, 112, 114, 105, 111, 114, 105, 116, 121, 50, 105, 112, 114, 105, 111, 114, 105, 116, 121, 49, 105, 112, 114, 105, 111, 114, 105, 116, 121, 48, 102, 115, 116, 97, 116, 101, 115, 153, 1, 81, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 184, 31, 97, 49, 1, 98, 49, 49, 2, 98, 50, 51, 3, 98, 50, 54, 4, 98, 50, 57, 5, 98, 51, 48, 6, 98, 51, 49, 7, 98, 51, 51, 8, 98, 51, 52, 9, 98, 51, 53, 10, 98, 51, 54, 11, 98, 51, 55, 12, 98, 51, 56, 13, 98, 51, 57, 14, 98, 52, 48, 15, 98, 52, 49, 16, 98, 52, 50, 17, 98, 52, 53, 18, 98, 52, 54, 19, 98, 52, 55, 20, 98, 52, 56, 21, 98, 52, 57, 22, 98, 53, 48, 23, 98, 53, 49, 24, 24, 98, 53, 50, 24, 25, 98, 53, 53, 24, 26, 98, 54, 48, 24, 27, 98, 54, 49, 24, 28, 98, 54, 50, 24, 29, 98, 54, 51, 24, 30, 98, 54, 52, 24, 31, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 176, 97, 49, 24, 62, 98, 49, 49, 24, 63, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 53, 50, 25, 1, 79, 98, 54, 48, 24, 73, 98, 54, 49, 24, 74, 98, 54, 50, 24, 75, 98, 54, 51, 24, 76, 98, 54, 52, 24, 77, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 171, 97, 49, 1, 98, 49, 49, 2, 98, 50, 51, 3, 98, 50, 54, 4, 98, 51, 55, 12, 98, 51, 56, 13, 98, 51, 57, 14, 98, 52, 48, 15, 98, 52, 49, 16, 98, 52, 50, 17, 98, 54, 52, 25, 1, 78, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 171, 97, 49, 1, 98, 49, 49, 2, 98, 50, 51, 3, 98, 50, 54, 4, 98, 51, 55, 12, 98, 51, 56, 13, 98, 51, 57, 14, 98, 52, 48, 15, 98, 52, 49, 16, 98, 52, 50, 17, 98, 54, 52, 25, 1, 77, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 171, 97, 49, 1, 98, 49, 49, 2, 98, 50, 51, 3, 98, 50, 54, 4, 98, 51, 55, 12, 98, 51, 56, 13, 98, 51, 57, 14, 98, 52, 48, 15, 98, 52, 49, 16, 98, 52, 50, 17, 98, 54, 52, 25, 1, 76, 161, 101, 115, 104, 105, 102, 116, 161, 98, 52, 50, 25, 1, 73, 161, 101, 115, 104, 105, 102, 116, 161, 98, 52, 50, 25, 1, 66, 161, 101, 115, 104, 105, 102, 116, 161, 97, 49, 25, 1, 62, 161, 101, 115, 104, 105, 102, 116, 161, 97, 49, 25, 1, 32, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 24, 33, 97, 56, 24, 33, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 24, 32, 97, 56, 24, 32, 163, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 24, 34, 97, 56, 24, 34, 101, 115, 104, 105, 102, 116, 176, 97, 49, 1, 98, 49, 49, 2, 98, 50, 51, 3, 98, 50, 54, 4, 98, 51, 55, 12, 98, 51, 56, 13, 98, 51, 57, 14, 98, 52, 48, 15, 98, 52, 49, 16, 98, 52, 50, 17, 98, 53, 50, 25, 1, 31, 98, 54, 48, 24, 27, 98, 54, 49, 24, 28, 98, 54, 50, 24, 29, 98, 54, 51, 24, 30, 98, 54, 52, 24, 31, 161, 102, 114, 101, 100, 117, 99, 101, 173, 97, 48, 24, 65, 98, 49, 48, 24, 65, 98, 49, 49, 24, 65, 98, 49, 50, 24, 65, 98, 49, 51, 24, 65, 98, 49, 52, 24, 65, 98, 50, 49, 24, 65, 98, 50, 50, 24, 65, 98, 50, 52, 24, 65, 98, 50, 53, 24, 65, 98, 50, 55, 24, 65, 98, 50, 56, 24, 65, 97, 56, 24, 65, 161, 102, 114, 101, 100, 117, 99, 101, 173, 97, 48, 24, 63, 98, 49, 48, 24, 63, 98, 49, 49, 24, 63, 98, 49, 50, 24, 63, 98, 49, 51, 24, 63, 98, 49, 52, 24, 63, 98, 50, 49, 24, 63, 98, 50, 50, 24, 63, 98, 50, 52, 24, 63, 98, 50, 53, 24, 63, 98, 50, 55, 24, 63, 98, 50, 56, 24, 63, 97, 56, 24, 63, 161, 102, 114, 101, 100, 117, 99, 101, 173, 97, 48, 24, 64, 98, 49, 48, 24, 64, 98, 49, 49, 24, 64, 98, 49, 50, 24, 64, 98, 49, 51, 24, 64, 98, 49, 52, 24, 64, 98, 50, 49, 24, 64, 98, 50, 50, 24, 64, 98, 50, 52, 24, 64, 98, 50, 53, 24, 64, 98, 50, 55, 24, 64, 98, 50, 56, 24, 64, 97, 56, 24, 64, 161, 102, 114, 101, 100, 117, 99, 101, 173, 97, 48, 24, 61, 98, 49, 48, 24, 61, 98, 49, 49, 24, 61, 98, 49, 50, 24, 61, 98, 49, 51, 24, 61, 98, 49, 52, 24, 61, 98, 50, 49, 24, 61, 98, 50, 50, 24, 61, 98, 50, 52, 24, 61, 98, 50, 53, 24, 61, 98, 50, 55, 24, 61, 98, 50, 56, 24, 61, 97, 56, 24, 61, 161, 102, 114, 101, 100, 117, 99, 101, 173, 97, 48, 24, 62, 98, 49, 48, 24, 62, 98, 49, 49, 24, 62, 98, 49, 50, 24, 62, 98, 49, 51, 24, 62, 98, 49, 52, 24, 62, 98, 50, 49, 24, 62, 98, 50, 50, 24, 62, 98, 50, 52, 24, 62, 98, 50, 53, 24, 62, 98, 50, 55, 24, 62, 98, 50, 56, 24, 62, 97, 56, 24, 62, 161, 102, 114, 101, 100, 117, 99, 101, 173, 97, 48, 24, 60, 98, 49, 48, 24, 60, 98, 49, 49, 24, 60, 98, 49, 50, 24, 60, 98, 49, 51, 24, 60, 98, 49, 52, 24, 60, 98, 50, 49, 24, 60, 98, 50, 50, 24, 60, 98, 50, 52, 24, 60, 98, 50, 53, 24, 60, 98, 50, 55, 24, 60, 98, 50, 56, 24, 60, 97, 56, 24, 60, 162, 102, 114, 101, 100, 117, 99, 101, 161, 97, 48, 0, 101, 115, 104, 105, 102, 116, 161, 97, 56, 25, 1, 29, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 1, 97, 56, 1, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 3, 97, 56, 3, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 4, 97, 56, 4, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 5, 97, 56, 5, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 6, 97, 56, 6, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 7, 97, 56, 7, 162, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 8, 97, 56, 8, 101, 115, 104, 105, 102, 116, 161, 98, 50, 56, 25, 1, 27, 162, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 15, 97, 56, 15, 101, 115, 104, 105, 102, 116, 164, 98, 51, 50, 24, 52, 98, 53, 54, 24, 53, 98, 53, 55, 24, 54, 98, 53, 56, 24, 55, 162, 102, 114, 101, 100, 117, 99, 101, 163, 97, 48, 24, 40, 98, 50, 56, 24, 40, 97, 56, 24, 40, 101, 115, 104, 105, 102, 116, 162, 98, 50, 49, 24, 48, 98, 50, 50, 24, 49, 162, 102, 114, 101, 100, 117, 99, 101, 165, 97, 48, 24, 42, 98, 50, 49, 24, 42, 98, 50, 50, 24, 42, 98, 50, 56, 24, 42, 97, 56, 24, 42, 101, 115, 104, 105, 102, 116, 162, 98, 49, 48, 24, 44, 98, 49, 49, 24, 45, 162, 102, 114, 101, 100, 117, 99, 101, 167, 97, 48, 24, 45, 98, 49, 48, 24, 45, 98, 49, 49, 24, 45, 98, 50, 49, 24, 45, 98, 50, 50, 24, 45, 98, 50, 56, 24, 45, 97, 56, 24, 45, 101, 115, 104, 105, 102, 116, 163, 98, 49, 50, 24, 38, 98, 49, 51, 24, 39, 98, 49, 52, 24, 40, 162, 102, 114, 101, 100, 117, 99, 101, 170, 97, 48, 24, 48, 98, 49, 48, 24, 48, 98, 49, 49, 24, 48, 98, 49, 50, 24, 48, 98, 49, 51, 24, 48, 98, 49, 52, 24, 48, 98, 50, 49, 24, 48, 98, 50, 50, 24, 48, 98, 50, 56, 24, 48, 97, 56, 24, 48, 101, 115, 104, 105, 102, 116, 163, 98, 50, 52, 24, 32, 98, 50, 53, 24, 33, 98, 50, 55, 24, 34, 161, 102, 114, 101, 100, 117, 99, 101, 173, 97, 48, 24, 52, 98, 49, 48, 24, 52, 98, 49, 49, 24, 52, 98, 49, 50, 24, 52, 98, 49, 51, 24, 52, 98, 49, 52, 24, 52, 98, 50, 49, 24, 52, 98, 50, 50, 24, 52, 98, 50, 52, 24, 52, 98, 50, 53, 24, 52, 98, 50, 55, 24, 52, 98, 50, 56, 24, 52, 97, 56, 24, 52, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 171, 97, 49, 1, 98, 49, 49, 2, 98, 50, 51, 3, 98, 50, 54, 4, 98, 51, 55, 12, 98, 51, 56, 13, 98, 51, 57, 14, 98, 52, 48, 15, 98, 52, 49, 16, 98, 52, 50, 17, 98, 54, 52, 24, 37, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 171, 97, 49, 1, 98, 49, 49, 2, 98, 50, 51, 3, 98, 50, 54, 4, 98, 51, 55, 12, 98, 51, 56, 13, 98, 51, 57, 14, 98, 52, 48, 15, 98, 52, 49, 16, 98, 52, 50, 17, 98, 54, 52, 24, 36, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 171, 97, 49, 1, 98, 49, 49, 2, 98, 50, 51, 3, 98, 50, 54, 4, 98, 51, 55, 12, 98, 51, 56, 13, 98, 51, 57, 14, 98, 52, 48, 15, 98, 52, 49, 16, 98, 52, 50, 17, 98, 54, 52, 24, 35, 161, 102, 114, 101, 100, 117, 99, 101, 173, 97, 48, 24, 55, 98, 49, 48, 24, 55, 98, 49, 49, 24, 55, 98, 49, 50, 24, 55, 98, 49, 51, 24, 55, 98, 49, 52, 24, 55, 98, 50, 49, 24, 55, 98, 50, 50, 24, 55, 98, 50, 52, 24, 55, 98, 50, 53, 24, 55, 98, 50, 55, 24, 55, 98, 50, 56, 24, 55, 97, 56, 24, 55, 161, 102, 114, 101, 100, 117, 99, 101, 173, 97, 48, 24, 54, 98, 49, 48, 24, 54, 98, 49, 49, 24, 54, 98, 49, 50, 24, 54, 98, 49, 51, 24, 54, 98, 49, 52, 24, 54, 98, 50, 49, 24, 54, 98, 50, 50, 24, 54, 98, 50, 52, 24, 54, 98, 50, 53, 24, 54, 98, 50, 55, 24, 54, 98, 50, 56, 24, 54, 97, 56, 24, 54, 161, 102, 114, 101, 100, 117, 99, 101, 173, 97, 48, 24, 53, 98, 49, 48, 24, 53, 98, 49, 49, 24, 53, 98, 49, 50, 24, 53, 98, 49, 51, 24, 53, 98, 49, 52, 24, 53, 98, 50, 49, 24, 53, 98, 50, 50, 24, 53, 98, 50, 52, 24, 53, 98, 50, 53, 24, 53, 98, 50, 55, 24, 53, 98, 50, 56, 24, 53, 97, 56, 24, 53, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 172, 97, 49, 1, 98, 49, 49, 2, 98, 50, 51, 3, 98, 50, 54, 4, 98, 51, 55, 12, 98, 51, 56, 13, 98, 51, 57, 14, 98, 52, 48, 15, 98, 52, 49, 16, 98, 52, 50, 17, 98, 54, 51, 24, 43, 98, 54, 52, 24, 31, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 172, 97, 49, 1, 98, 49, 49, 2, 98, 50, 51, 3, 98, 50, 54, 4, 98, 51, 55, 12, 98, 51, 56, 13, 98, 51, 57, 14, 98, 52, 48, 15, 98, 52, 49, 16, 98, 52, 50, 17, 98, 54, 51, 24, 42, 98, 54, 52, 24, 31, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 172, 97, 49, 1, 98, 49, 49, 2, 98, 50, 51, 3, 98, 50, 54, 4, 98, 51, 55, 12, 98, 51, 56, 13, 98, 51, 57, 14, 98, 52, 48, 15, 98, 52, 49, 16, 98, 52, 50, 17, 98, 54, 51, 24, 41, 98, 54, 52, 24, 31, 162, 102, 114, 101, 100, 117, 99, 101, 170, 97, 48, 24, 51, 98, 49, 48, 24, 51, 98, 49, 49, 24, 51, 98, 49, 50, 24, 51, 98, 49, 51, 24, 51, 98, 49, 52, 24, 51, 98, 50, 49, 24, 51, 98, 50, 50, 24, 51, 98, 50, 56, 24, 51, 97, 56, 24, 51, 101, 115, 104, 105, 102, 116, 163, 98, 50, 52, 24, 32, 98, 50, 53, 24, 33, 98, 50, 55, 24, 34, 162, 102, 114, 101, 100, 117, 99, 101, 170, 97, 48, 24, 50, 98, 49, 48, 24, 50, 98, 49, 49, 24, 50, 98, 49, 50, 24, 50, 98, 49, 51, 24, 50, 98, 49, 52, 24, 50, 98, 50, 49, 24, 50, 98, 50, 50, 24, 50, 98, 50, 56, 24, 50, 97, 56, 24, 50, 101, 115, 104, 105, 102, 116, 163, 98, 50, 52, 24, 32, 98, 50, 53, 24, 33, 98, 50, 55, 24, 34, 162, 102, 114, 101, 100, 117, 99, 101, 170, 97, 48, 24, 49, 98, 49, 48, 24, 49, 98, 49, 49, 24, 49, 98, 49, 50, 24, 49, 98, 49, 51, 24, 49, 98, 49, 52, 24, 49, 98, 50, 49, 24, 49, 98, 50, 50, 24, 49, 98, 50, 56, 24, 49, 97, 56, 24, 49, 101, 115, 104, 105, 102, 116, 163, 98, 50, 52, 24, 32, 98, 50, 53, 24, 33, 98, 50, 55, 24, 34, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 173, 97, 49, 1, 98, 49, 49, 2, 98, 50, 51, 3, 98, 50, 54, 4, 98, 51, 55, 12, 98, 51, 56, 13, 98, 51, 57, 14, 98, 52, 48, 15, 98, 52, 49, 16, 98, 52, 50, 17, 98, 54, 50, 24, 47, 98, 54, 51, 24, 30, 98, 54, 52, 24, 31, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 173, 97, 49, 1, 98, 49, 49, 2, 98, 50, 51, 3, 98, 50, 54, 4, 98, 51, 55, 12, 98, 51, 56, 13, 98, 51, 57, 14, 98, 52, 48, 15, 98, 52, 49, 16, 98, 52, 50, 17, 98, 54, 50, 24, 46, 98, 54, 51, 24, 30, 98, 54, 52, 24, 31, 162, 102, 114, 101, 100, 117, 99, 101, 167, 97, 48, 24, 47, 98, 49, 48, 24, 47, 98, 49, 49, 24, 47, 98, 50, 49, 24, 47, 98, 50, 50, 24, 47, 98, 50, 56, 24, 47, 97, 56, 24, 47, 101, 115, 104, 105, 102, 116, 163, 98, 49, 50, 24, 38, 98, 49, 51, 24, 39, 98, 49, 52, 24, 40, 162, 102, 114, 101, 100, 117, 99, 101, 167, 97, 48, 24, 46, 98, 49, 48, 24, 46, 98, 49, 49, 24, 46, 98, 50, 49, 24, 46, 98, 50, 50, 24, 46, 98, 50, 56, 24, 46, 97, 56, 24, 46, 101, 115, 104, 105, 102, 116, 163, 98, 49, 50, 24, 38, 98, 49, 51, 24, 39, 98, 49, 52, 24, 40, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 174, 97, 49, 1, 98, 49, 49, 2, 98, 50, 51, 3, 98, 50, 54, 4, 98, 51, 55, 12, 98, 51, 56, 13, 98, 51, 57, 14, 98, 52, 48, 15, 98, 52, 49, 16, 98, 52, 50, 17, 98, 54, 49, 24, 51, 98, 54, 50, 24, 29, 98, 54, 51, 24, 30, 98, 54, 52, 24, 31, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 174, 97, 49, 1, 98, 49, 49, 2, 98, 50, 51, 3, 98, 50, 54, 4, 98, 51, 55, 12, 98, 51, 56, 13, 98, 51, 57, 14, 98, 52, 48, 15, 98, 52, 49, 16, 98, 52, 50, 17, 98, 54, 49, 24, 50, 98, 54, 50, 24, 29, 98, 54, 51, 24, 30, 98, 54, 52, 24, 31, 162, 102, 114, 101, 100, 117, 99, 101, 165, 97, 48, 24, 44, 98, 50, 49, 24, 44, 98, 50, 50, 24, 44, 98, 50, 56, 24, 44, 97, 56, 24, 44, 101, 115, 104, 105, 102, 116, 162, 98, 49, 48, 24, 44, 98, 49, 49, 24, 45, 162, 102, 114, 101, 100, 117, 99, 101, 165, 97, 48, 24, 43, 98, 50, 49, 24, 43, 98, 50, 50, 24, 43, 98, 50, 56, 24, 43, 97, 56, 24, 43, 101, 115, 104, 105, 102, 116, 162, 98, 49, 48, 24, 44, 98, 49, 49, 24, 45, 161, 101, 115, 104, 105, 102, 116, 163, 98, 51, 49, 24, 59, 97, 53, 24, 58, 98, 53, 51, 24, 60, 162, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 16, 97, 56, 16, 101, 115, 104, 105, 102, 116, 163, 98, 51, 50, 24, 52, 98, 53, 55, 24, 56, 98, 53, 56, 24, 57, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 17, 97, 56, 17, 161, 102, 114, 101, 100, 117, 99, 101, 163, 97, 48, 20, 98, 51, 50, 20, 97, 56, 20, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 18, 97, 56, 18, 161, 102, 114, 101, 100, 117, 99, 101, 163, 97, 48, 21, 98, 51, 50, 21, 97, 56, 21, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 184, 31, 97, 49, 24, 103, 98, 49, 49, 24, 104, 98, 50, 51, 24, 105, 98, 50, 54, 24, 106, 98, 50, 57, 24, 107, 98, 51, 48, 24, 108, 98, 51, 49, 24, 109, 98, 51, 51, 24, 110, 98, 51, 52, 24, 111, 98, 51, 53, 24, 112, 98, 51, 54, 24, 113, 98, 51, 55, 24, 114, 98, 51, 56, 24, 115, 98, 51, 57, 24, 116, 98, 52, 48, 24, 117, 98, 52, 49, 24, 118, 98, 52, 50, 24, 119, 98, 52, 54, 24, 120, 98, 52, 55, 24, 121, 98, 52, 56, 24, 122, 98, 52, 57, 24, 123, 98, 53, 48, 24, 124, 98, 53, 49, 24, 125, 98, 53, 50, 24, 126, 98, 53, 52, 25, 1, 25, 98, 53, 53, 24, 128, 98, 54, 48, 24, 129, 98, 54, 49, 24, 130, 98, 54, 50, 24, 131, 98, 54, 51, 24, 132, 98, 54, 52, 24, 133, 161, 101, 115, 104, 105, 102, 116, 161, 97, 49, 24, 61, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 23, 97, 56, 23, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 176, 97, 49, 24, 62, 98, 49, 49, 24, 63, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 53, 50, 24, 72, 98, 54, 48, 24, 73, 98, 54, 49, 24, 74, 98, 54, 50, 24, 75, 98, 54, 51, 24, 76, 98, 54, 52, 24, 77, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 176, 97, 49, 24, 62, 98, 49, 49, 24, 63, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 53, 50, 25, 1, 23, 98, 54, 48, 24, 73, 98, 54, 49, 24, 74, 98, 54, 50, 24, 75, 98, 54, 51, 24, 76, 98, 54, 52, 24, 77, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 171, 97, 49, 24, 62, 98, 49, 49, 24, 63, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 54, 52, 25, 1, 22, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 171, 97, 49, 24, 62, 98, 49, 49, 24, 63, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 54, 52, 25, 1, 21, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 171, 97, 49, 24, 62, 98, 49, 49, 24, 63, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 54, 52, 25, 1, 20, 161, 102, 114, 101, 100, 117, 99, 101, 172, 98, 49, 48, 24, 65, 98, 49, 49, 24, 65, 98, 49, 50, 24, 65, 98, 49, 51, 24, 65, 98, 49, 52, 24, 65, 97, 50, 24, 65, 98, 50, 49, 24, 65, 98, 50, 50, 24, 65, 98, 50, 52, 24, 65, 98, 50, 53, 24, 65, 98, 50, 55, 24, 65, 98, 50, 56, 24, 65, 161, 102, 114, 101, 100, 117, 99, 101, 172, 98, 49, 48, 24, 63, 98, 49, 49, 24, 63, 98, 49, 50, 24, 63, 98, 49, 51, 24, 63, 98, 49, 52, 24, 63, 97, 50, 24, 63, 98, 50, 49, 24, 63, 98, 50, 50, 24, 63, 98, 50, 52, 24, 63, 98, 50, 53, 24, 63, 98, 50, 55, 24, 63, 98, 50, 56, 24, 63, 161, 102, 114, 101, 100, 117, 99, 101, 172, 98, 49, 48, 24, 64, 98, 49, 49, 24, 64, 98, 49, 50, 24, 64, 98, 49, 51, 24, 64, 98, 49, 52, 24, 64, 97, 50, 24, 64, 98, 50, 49, 24, 64, 98, 50, 50, 24, 64, 98, 50, 52, 24, 64, 98, 50, 53, 24, 64, 98, 50, 55, 24, 64, 98, 50, 56, 24, 64, 161, 102, 114, 101, 100, 117, 99, 101, 172, 98, 49, 48, 24, 61, 98, 49, 49, 24, 61, 98, 49, 50, 24, 61, 98, 49, 51, 24, 61, 98, 49, 52, 24, 61, 97, 50, 24, 61, 98, 50, 49, 24, 61, 98, 50, 50, 24, 61, 98, 50, 52, 24, 61, 98, 50, 53, 24, 61, 98, 50, 55, 24, 61, 98, 50, 56, 24, 61, 161, 102, 114, 101, 100, 117, 99, 101, 172, 98, 49, 48, 24, 62, 98, 49, 49, 24, 62, 98, 49, 50, 24, 62, 98, 49, 51, 24, 62, 98, 49, 52, 24, 62, 97, 50, 24, 62, 98, 50, 49, 24, 62, 98, 50, 50, 24, 62, 98, 50, 52, 24, 62, 98, 50, 53, 24, 62, 98, 50, 55, 24, 62, 98, 50, 56, 24, 62, 161, 102, 114, 101, 100, 117, 99, 101, 172, 98, 49, 48, 24, 60, 98, 49, 49, 24, 60, 98, 49, 50, 24, 60, 98, 49, 51, 24, 60, 98, 49, 52, 24, 60, 97, 50, 24, 60, 98, 50, 49, 24, 60, 98, 50, 50, 24, 60, 98, 50, 52, 24, 60, 98, 50, 53, 24, 60, 98, 50, 55, 24, 60, 98, 50, 56, 24, 60, 161, 101, 115, 104, 105, 102, 116, 162, 97, 50, 24, 98, 98, 50, 56, 24, 99, 162, 102, 114, 101, 100, 117, 99, 101, 162, 97, 50, 24, 40, 98, 50, 56, 24, 40, 101, 115, 104, 105, 102, 116, 162, 98, 50, 49, 24, 94, 98, 50, 50, 24, 95, 162, 102, 114, 101, 100, 117, 99, 101, 164, 97, 50, 24, 42, 98, 50, 49, 24, 42, 98, 50, 50, 24, 42, 98, 50, 56, 24, 42, 101, 115, 104, 105, 102, 116, 162, 98, 49, 48, 24, 90, 98, 49, 49, 24, 91, 162, 102, 114, 101, 100, 117, 99, 101, 166, 98, 49, 48, 24, 45, 98, 49, 49, 24, 45, 97, 50, 24, 45, 98, 50, 49, 24, 45, 98, 50, 50, 24, 45, 98, 50, 56, 24, 45, 101, 115, 104, 105, 102, 116, 163, 98, 49, 50, 24, 84, 98, 49, 51, 24, 85, 98, 49, 52, 24, 86, 162, 102, 114, 101, 100, 117, 99, 101, 169, 98, 49, 48, 24, 48, 98, 49, 49, 24, 48, 98, 49, 50, 24, 48, 98, 49, 51, 24, 48, 98, 49, 52, 24, 48, 97, 50, 24, 48, 98, 50, 49, 24, 48, 98, 50, 50, 24, 48, 98, 50, 56, 24, 48, 101, 115, 104, 105, 102, 116, 163, 98, 50, 52, 24, 78, 98, 50, 53, 24, 79, 98, 50, 55, 24, 80, 161, 102, 114, 101, 100, 117, 99, 101, 172, 98, 49, 48, 24, 52, 98, 49, 49, 24, 52, 98, 49, 50, 24, 52, 98, 49, 51, 24, 52, 98, 49, 52, 24, 52, 97, 50, 24, 52, 98, 50, 49, 24, 52, 98, 50, 50, 24, 52, 98, 50, 52, 24, 52, 98, 50, 53, 24, 52, 98, 50, 55, 24, 52, 98, 50, 56, 24, 52, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 171, 97, 49, 24, 62, 98, 49, 49, 24, 63, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 54, 52, 24, 83, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 171, 97, 49, 24, 62, 98, 49, 49, 24, 63, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 54, 52, 24, 82, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 171, 97, 49, 24, 62, 98, 49, 49, 24, 63, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 54, 52, 24, 81, 161, 102, 114, 101, 100, 117, 99, 101, 172, 98, 49, 48, 24, 55, 98, 49, 49, 24, 55, 98, 49, 50, 24, 55, 98, 49, 51, 24, 55, 98, 49, 52, 24, 55, 97, 50, 24, 55, 98, 50, 49, 24, 55, 98, 50, 50, 24, 55, 98, 50, 52, 24, 55, 98, 50, 53, 24, 55, 98, 50, 55, 24, 55, 98, 50, 56, 24, 55, 161, 102, 114, 101, 100, 117, 99, 101, 172, 98, 49, 48, 24, 54, 98, 49, 49, 24, 54, 98, 49, 50, 24, 54, 98, 49, 51, 24, 54, 98, 49, 52, 24, 54, 97, 50, 24, 54, 98, 50, 49, 24, 54, 98, 50, 50, 24, 54, 98, 50, 52, 24, 54, 98, 50, 53, 24, 54, 98, 50, 55, 24, 54, 98, 50, 56, 24, 54, 161, 102, 114, 101, 100, 117, 99, 101, 172, 98, 49, 48, 24, 53, 98, 49, 49, 24, 53, 98, 49, 50, 24, 53, 98, 49, 51, 24, 53, 98, 49, 52, 24, 53, 97, 50, 24, 53, 98, 50, 49, 24, 53, 98, 50, 50, 24, 53, 98, 50, 52, 24, 53, 98, 50, 53, 24, 53, 98, 50, 55, 24, 53, 98, 50, 56, 24, 53, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 172, 97, 49, 24, 62, 98, 49, 49, 24, 63, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 54, 51, 24, 89, 98, 54, 52, 24, 77, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 172, 97, 49, 24, 62, 98, 49, 49, 24, 63, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 54, 51, 24, 88, 98, 54, 52, 24, 77, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 172, 97, 49, 24, 62, 98, 49, 49, 24, 63, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 54, 51, 24, 87, 98, 54, 52, 24, 77, 162, 102, 114, 101, 100, 117, 99, 101, 169, 98, 49, 48, 24, 51, 98, 49, 49, 24, 51, 98, 49, 50, 24, 51, 98, 49, 51, 24, 51, 98, 49, 52, 24, 51, 97, 50, 24, 51, 98, 50, 49, 24, 51, 98, 50, 50, 24, 51, 98, 50, 56, 24, 51, 101, 115, 104, 105, 102, 116, 163, 98, 50, 52, 24, 78, 98, 50, 53, 24, 79, 98, 50, 55, 24, 80, 162, 102, 114, 101, 100, 117, 99, 101, 169, 98, 49, 48, 24, 50, 98, 49, 49, 24, 50, 98, 49, 50, 24, 50, 98, 49, 51, 24, 50, 98, 49, 52, 24, 50, 97, 50, 24, 50, 98, 50, 49, 24, 50, 98, 50, 50, 24, 50, 98, 50, 56, 24, 50, 101, 115, 104, 105, 102, 116, 163, 98, 50, 52, 24, 78, 98, 50, 53, 24, 79, 98, 50, 55, 24, 80, 162, 102, 114, 101, 100, 117, 99, 101, 169, 98, 49, 48, 24, 49, 98, 49, 49, 24, 49, 98, 49, 50, 24, 49, 98, 49, 51, 24, 49, 98, 49, 52, 24, 49, 97, 50, 24, 49, 98, 50, 49, 24, 49, 98, 50, 50, 24, 49, 98, 50, 56, 24, 49, 101, 115, 104, 105, 102, 116, 163, 98, 50, 52, 24, 78, 98, 50, 53, 24, 79, 98, 50, 55, 24, 80, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 173, 97, 49, 24, 62, 98, 49, 49, 24, 63, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 54, 50, 24, 93, 98, 54, 51, 24, 76, 98, 54, 52, 24, 77, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 173, 97, 49, 24, 62, 98, 49, 49, 24, 63, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 54, 50, 24, 92, 98, 54, 51, 24, 76, 98, 54, 52, 24, 77, 162, 102, 114, 101, 100, 117, 99, 101, 166, 98, 49, 48, 24, 47, 98, 49, 49, 24, 47, 97, 50, 24, 47, 98, 50, 49, 24, 47, 98, 50, 50, 24, 47, 98, 50, 56, 24, 47, 101, 115, 104, 105, 102, 116, 163, 98, 49, 50, 24, 84, 98, 49, 51, 24, 85, 98, 49, 52, 24, 86, 162, 102, 114, 101, 100, 117, 99, 101, 166, 98, 49, 48, 24, 46, 98, 49, 49, 24, 46, 97, 50, 24, 46, 98, 50, 49, 24, 46, 98, 50, 50, 24, 46, 98, 50, 56, 24, 46, 101, 115, 104, 105, 102, 116, 163, 98, 49, 50, 24, 84, 98, 49, 51, 24, 85, 98, 49, 52, 24, 86, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 174, 97, 49, 24, 62, 98, 49, 49, 24, 63, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 54, 49, 24, 97, 98, 54, 50, 24, 75, 98, 54, 51, 24, 76, 98, 54, 52, 24, 77, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 174, 97, 49, 24, 62, 98, 49, 49, 24, 63, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 54, 49, 24, 96, 98, 54, 50, 24, 75, 98, 54, 51, 24, 76, 98, 54, 52, 24, 77, 162, 102, 114, 101, 100, 117, 99, 101, 164, 97, 50, 24, 44, 98, 50, 49, 24, 44, 98, 50, 50, 24, 44, 98, 50, 56, 24, 44, 101, 115, 104, 105, 102, 116, 162, 98, 49, 48, 24, 90, 98, 49, 49, 24, 91, 162, 102, 114, 101, 100, 117, 99, 101, 164, 97, 50, 24, 43, 98, 50, 49, 24, 43, 98, 50, 50, 24, 43, 98, 50, 56, 24, 43, 101, 115, 104, 105, 102, 116, 162, 98, 49, 48, 24, 90, 98, 49, 49, 24, 91, 161, 101, 115, 104, 105, 102, 116, 162, 97, 53, 24, 101, 98, 53, 51, 24, 102, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 175, 97, 49, 24, 62, 98, 49, 49, 24, 63, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 54, 48, 24, 100, 98, 54, 49, 24, 74, 98, 54, 50, 24, 75, 98, 54, 51, 24, 76, 98, 54, 52, 24, 77, 162, 102, 114, 101, 100, 117, 99, 101, 162, 97, 50, 24, 41, 98, 50, 56, 24, 41, 101, 115, 104, 105, 102, 116, 162, 98, 50, 49, 24, 94, 98, 50, 50, 24, 95, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 184, 31, 97, 49, 24, 103, 98, 49, 49, 24, 104, 98, 50, 51, 24, 105, 98, 50, 54, 24, 106, 98, 50, 57, 24, 107, 98, 51, 48, 24, 108, 98, 51, 49, 24, 109, 98, 51, 51, 24, 110, 98, 51, 52, 24, 111, 98, 51, 53, 24, 112, 98, 51, 54, 24, 113, 98, 51, 55, 24, 114, 98, 51, 56, 24, 115, 98, 51, 57, 24, 116, 98, 52, 48, 24, 117, 98, 52, 49, 24, 118, 98, 52, 50, 24, 119, 98, 52, 54, 24, 120, 98, 52, 55, 24, 121, 98, 52, 56, 24, 122, 98, 52, 57, 24, 123, 98, 53, 48, 24, 124, 98, 53, 49, 24, 125, 98, 53, 50, 24, 126, 98, 53, 52, 24, 127, 98, 53, 53, 24, 128, 98, 54, 48, 24, 129, 98, 54, 49, 24, 130, 98, 54, 50, 24, 131, 98, 54, 51, 24, 132, 98, 54, 52, 24, 133, 161, 102, 114, 101, 100, 117, 99, 101, 163, 97, 48, 22, 98, 51, 50, 22, 97, 56, 22, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 176, 97, 49, 24, 62, 98, 49, 49, 24, 63, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 53, 50, 25, 1, 18, 98, 54, 48, 24, 73, 98, 54, 49, 24, 74, 98, 54, 50, 24, 75, 98, 54, 51, 24, 76, 98, 54, 52, 24, 77, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 171, 97, 49, 24, 103, 98, 49, 49, 24, 104, 98, 50, 51, 24, 105, 98, 50, 54, 24, 106, 98, 51, 55, 24, 114, 98, 51, 56, 24, 115, 98, 51, 57, 24, 116, 98, 52, 48, 24, 117, 98, 52, 49, 24, 118, 98, 52, 50, 24, 119, 98, 54, 52, 25, 1, 17, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 171, 97, 49, 24, 103, 98, 49, 49, 24, 104, 98, 50, 51, 24, 105, 98, 50, 54, 24, 106, 98, 51, 55, 24, 114, 98, 51, 56, 24, 115, 98, 51, 57, 24, 116, 98, 52, 48, 24, 117, 98, 52, 49, 24, 118, 98, 52, 50, 24, 119, 98, 54, 52, 25, 1, 16, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 171, 97, 49, 24, 103, 98, 49, 49, 24, 104, 98, 50, 51, 24, 105, 98, 50, 54, 24, 106, 98, 51, 55, 24, 114, 98, 51, 56, 24, 115, 98, 51, 57, 24, 116, 98, 52, 48, 24, 117, 98, 52, 49, 24, 118, 98, 52, 50, 24, 119, 98, 54, 52, 25, 1, 15, 161, 101, 115, 104, 105, 102, 116, 161, 98, 52, 50, 25, 1, 12, 161, 101, 115, 104, 105, 102, 116, 161, 98, 52, 50, 25, 1, 2, 161, 101, 115, 104, 105, 102, 116, 161, 97, 49, 24, 254, 161, 101, 115, 104, 105, 102, 116, 161, 97, 49, 24, 178, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 24, 33, 97, 56, 24, 33, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 24, 32, 97, 56, 24, 32, 163, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 24, 34, 97, 56, 24, 34, 101, 115, 104, 105, 102, 116, 176, 97, 49, 24, 103, 98, 49, 49, 24, 104, 98, 50, 51, 24, 105, 98, 50, 54, 24, 106, 98, 51, 55, 24, 114, 98, 51, 56, 24, 115, 98, 51, 57, 24, 116, 98, 52, 48, 24, 117, 98, 52, 49, 24, 118, 98, 52, 50, 24, 119, 98, 53, 50, 24, 177, 98, 54, 48, 24, 129, 98, 54, 49, 24, 130, 98, 54, 50, 24, 131, 98, 54, 51, 24, 132, 98, 54, 52, 24, 133, 161, 102, 114, 101, 100, 117, 99, 101, 173, 98, 49, 48, 24, 65, 98, 49, 49, 24, 65, 98, 49, 50, 24, 65, 98, 49, 51, 24, 65, 98, 49, 52, 24, 65, 98, 50, 49, 24, 65, 98, 50, 50, 24, 65, 98, 50, 52, 24, 65, 98, 50, 53, 24, 65, 98, 50, 55, 24, 65, 98, 50, 56, 24, 65, 97, 54, 24, 65, 97, 56, 24, 65, 161, 102, 114, 101, 100, 117, 99, 101, 173, 98, 49, 48, 24, 63, 98, 49, 49, 24, 63, 98, 49, 50, 24, 63, 98, 49, 51, 24, 63, 98, 49, 52, 24, 63, 98, 50, 49, 24, 63, 98, 50, 50, 24, 63, 98, 50, 52, 24, 63, 98, 50, 53, 24, 63, 98, 50, 55, 24, 63, 98, 50, 56, 24, 63, 97, 54, 24, 63, 97, 56, 24, 63, 161, 102, 114, 101, 100, 117, 99, 101, 173, 98, 49, 48, 24, 64, 98, 49, 49, 24, 64, 98, 49, 50, 24, 64, 98, 49, 51, 24, 64, 98, 49, 52, 24, 64, 98, 50, 49, 24, 64, 98, 50, 50, 24, 64, 98, 50, 52, 24, 64, 98, 50, 53, 24, 64, 98, 50, 55, 24, 64, 98, 50, 56, 24, 64, 97, 54, 24, 64, 97, 56, 24, 64, 161, 102, 114, 101, 100, 117, 99, 101, 173, 98, 49, 48, 24, 61, 98, 49, 49, 24, 61, 98, 49, 50, 24, 61, 98, 49, 51, 24, 61, 98, 49, 52, 24, 61, 98, 50, 49, 24, 61, 98, 50, 50, 24, 61, 98, 50, 52, 24, 61, 98, 50, 53, 24, 61, 98, 50, 55, 24, 61, 98, 50, 56, 24, 61, 97, 54, 24, 61, 97, 56, 24, 61, 161, 102, 114, 101, 100, 117, 99, 101, 173, 98, 49, 48, 24, 62, 98, 49, 49, 24, 62, 98, 49, 50, 24, 62, 98, 49, 51, 24, 62, 98, 49, 52, 24, 62, 98, 50, 49, 24, 62, 98, 50, 50, 24, 62, 98, 50, 52, 24, 62, 98, 50, 53, 24, 62, 98, 50, 55, 24, 62, 98, 50, 56, 24, 62, 97, 54, 24, 62, 97, 56, 24, 62, 161, 102, 114, 101, 100, 117, 99, 101, 173, 98, 49, 48, 24, 60, 98, 49, 49, 24, 60, 98, 49, 50, 24, 60, 98, 49, 51, 24, 60, 98, 49, 52, 24, 60, 98, 50, 49, 24, 60, 98, 50, 50, 24, 60, 98, 50, 52, 24, 60, 98, 50, 53, 24, 60, 98, 50, 55, 24, 60, 98, 50, 56, 24, 60, 97, 54, 24, 60, 97, 56, 24, 60, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 10, 97, 56, 10, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 3, 97, 56, 3, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 4, 97, 56, 4, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 5, 97, 56, 5, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 6, 97, 56, 6, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 7, 97, 56, 7, 162, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 8, 97, 56, 8, 101, 115, 104, 105, 102, 116, 161, 98, 50, 56, 24, 175, 161, 101, 115, 104, 105, 102, 116, 162, 97, 54, 24, 174, 97, 56, 24, 170, 162, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 15, 97, 56, 15, 101, 115, 104, 105, 102, 116, 164, 98, 51, 50, 24, 154, 98, 53, 54, 24, 155, 98, 53, 55, 24, 156, 98, 53, 56, 24, 157, 162, 102, 114, 101, 100, 117, 99, 101, 163, 98, 50, 56, 24, 40, 97, 54, 24, 40, 97, 56, 24, 40, 101, 115, 104, 105, 102, 116, 162, 98, 50, 49, 24, 150, 98, 50, 50, 24, 151, 162, 102, 114, 101, 100, 117, 99, 101, 165, 98, 50, 49, 24, 42, 98, 50, 50, 24, 42, 98, 50, 56, 24, 42, 97, 54, 24, 42, 97, 56, 24, 42, 101, 115, 104, 105, 102, 116, 162, 98, 49, 48, 24, 146, 98, 49, 49, 24, 147, 162, 102, 114, 101, 100, 117, 99, 101, 167, 98, 49, 48, 24, 45, 98, 49, 49, 24, 45, 98, 50, 49, 24, 45, 98, 50, 50, 24, 45, 98, 50, 56, 24, 45, 97, 54, 24, 45, 97, 56, 24, 45, 101, 115, 104, 105, 102, 116, 163, 98, 49, 50, 24, 140, 98, 49, 51, 24, 141, 98, 49, 52, 24, 142, 162, 102, 114, 101, 100, 117, 99, 101, 170, 98, 49, 48, 24, 48, 98, 49, 49, 24, 48, 98, 49, 50, 24, 48, 98, 49, 51, 24, 48, 98, 49, 52, 24, 48, 98, 50, 49, 24, 48, 98, 50, 50, 24, 48, 98, 50, 56, 24, 48, 97, 54, 24, 48, 97, 56, 24, 48, 101, 115, 104, 105, 102, 116, 163, 98, 50, 52, 24, 134, 98, 50, 53, 24, 135, 98, 50, 55, 24, 136, 161, 102, 114, 101, 100, 117, 99, 101, 173, 98, 49, 48, 24, 52, 98, 49, 49, 24, 52, 98, 49, 50, 24, 52, 98, 49, 51, 24, 52, 98, 49, 52, 24, 52, 98, 50, 49, 24, 52, 98, 50, 50, 24, 52, 98, 50, 52, 24, 52, 98, 50, 53, 24, 52, 98, 50, 55, 24, 52, 98, 50, 56, 24, 52, 97, 54, 24, 52, 97, 56, 24, 52, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 171, 97, 49, 24, 103, 98, 49, 49, 24, 104, 98, 50, 51, 24, 105, 98, 50, 54, 24, 106, 98, 51, 55, 24, 114, 98, 51, 56, 24, 115, 98, 51, 57, 24, 116, 98, 52, 48, 24, 117, 98, 52, 49, 24, 118, 98, 52, 50, 24, 119, 98, 54, 52, 24, 139, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 171, 97, 49, 24, 103, 98, 49, 49, 24, 104, 98, 50, 51, 24, 105, 98, 50, 54, 24, 106, 98, 51, 55, 24, 114, 98, 51, 56, 24, 115, 98, 51, 57, 24, 116, 98, 52, 48, 24, 117, 98, 52, 49, 24, 118, 98, 52, 50, 24, 119, 98, 54, 52, 24, 138, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 171, 97, 49, 24, 103, 98, 49, 49, 24, 104, 98, 50, 51, 24, 105, 98, 50, 54, 24, 106, 98, 51, 55, 24, 114, 98, 51, 56, 24, 115, 98, 51, 57, 24, 116, 98, 52, 48, 24, 117, 98, 52, 49, 24, 118, 98, 52, 50, 24, 119, 98, 54, 52, 24, 137, 161, 102, 114, 101, 100, 117, 99, 101, 173, 98, 49, 48, 24, 55, 98, 49, 49, 24, 55, 98, 49, 50, 24, 55, 98, 49, 51, 24, 55, 98, 49, 52, 24, 55, 98, 50, 49, 24, 55, 98, 50, 50, 24, 55, 98, 50, 52, 24, 55, 98, 50, 53, 24, 55, 98, 50, 55, 24, 55, 98, 50, 56, 24, 55, 97, 54, 24, 55, 97, 56, 24, 55, 161, 102, 114, 101, 100, 117, 99, 101, 173, 98, 49, 48, 24, 54, 98, 49, 49, 24, 54, 98, 49, 50, 24, 54, 98, 49, 51, 24, 54, 98, 49, 52, 24, 54, 98, 50, 49, 24, 54, 98, 50, 50, 24, 54, 98, 50, 52, 24, 54, 98, 50, 53, 24, 54, 98, 50, 55, 24, 54, 98, 50, 56, 24, 54, 97, 54, 24, 54, 97, 56, 24, 54, 161, 102, 114, 101, 100, 117, 99, 101, 173, 98, 49, 48, 24, 53, 98, 49, 49, 24, 53, 98, 49, 50, 24, 53, 98, 49, 51, 24, 53, 98, 49, 52, 24, 53, 98, 50, 49, 24, 53, 98, 50, 50, 24, 53, 98, 50, 52, 24, 53, 98, 50, 53, 24, 53, 98, 50, 55, 24, 53, 98, 50, 56, 24, 53, 97, 54, 24, 53, 97, 56, 24, 53, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 172, 97, 49, 24, 103, 98, 49, 49, 24, 104, 98, 50, 51, 24, 105, 98, 50, 54, 24, 106, 98, 51, 55, 24, 114, 98, 51, 56, 24, 115, 98, 51, 57, 24, 116, 98, 52, 48, 24, 117, 98, 52, 49, 24, 118, 98, 52, 50, 24, 119, 98, 54, 51, 24, 145, 98, 54, 52, 24, 133, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 172, 97, 49, 24, 103, 98, 49, 49, 24, 104, 98, 50, 51, 24, 105, 98, 50, 54, 24, 106, 98, 51, 55, 24, 114, 98, 51, 56, 24, 115, 98, 51, 57, 24, 116, 98, 52, 48, 24, 117, 98, 52, 49, 24, 118, 98, 52, 50, 24, 119, 98, 54, 51, 24, 144, 98, 54, 52, 24, 133, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 172, 97, 49, 24, 103, 98, 49, 49, 24, 104, 98, 50, 51, 24, 105, 98, 50, 54, 24, 106, 98, 51, 55, 24, 114, 98, 51, 56, 24, 115, 98, 51, 57, 24, 116, 98, 52, 48, 24, 117, 98, 52, 49, 24, 118, 98, 52, 50, 24, 119, 98, 54, 51, 24, 143, 98, 54, 52, 24, 133, 162, 102, 114, 101, 100, 117, 99, 101, 170, 98, 49, 48, 24, 51, 98, 49, 49, 24, 51, 98, 49, 50, 24, 51, 98, 49, 51, 24, 51, 98, 49, 52, 24, 51, 98, 50, 49, 24, 51, 98, 50, 50, 24, 51, 98, 50, 56, 24, 51, 97, 54, 24, 51, 97, 56, 24, 51, 101, 115, 104, 105, 102, 116, 163, 98, 50, 52, 24, 134, 98, 50, 53, 24, 135, 98, 50, 55, 24, 136, 162, 102, 114, 101, 100, 117, 99, 101, 170, 98, 49, 48, 24, 50, 98, 49, 49, 24, 50, 98, 49, 50, 24, 50, 98, 49, 51, 24, 50, 98, 49, 52, 24, 50, 98, 50, 49, 24, 50, 98, 50, 50, 24, 50, 98, 50, 56, 24, 50, 97, 54, 24, 50, 97, 56, 24, 50, 101, 115, 104, 105, 102, 116, 163, 98, 50, 52, 24, 134, 98, 50, 53, 24, 135, 98, 50, 55, 24, 136, 162, 102, 114, 101, 100, 117, 99, 101, 170, 98, 49, 48, 24, 49, 98, 49, 49, 24, 49, 98, 49, 50, 24, 49, 98, 49, 51, 24, 49, 98, 49, 52, 24, 49, 98, 50, 49, 24, 49, 98, 50, 50, 24, 49, 98, 50, 56, 24, 49, 97, 54, 24, 49, 97, 56, 24, 49, 101, 115, 104, 105, 102, 116, 163, 98, 50, 52, 24, 134, 98, 50, 53, 24, 135, 98, 50, 55, 24, 136, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 173, 97, 49, 24, 103, 98, 49, 49, 24, 104, 98, 50, 51, 24, 105, 98, 50, 54, 24, 106, 98, 51, 55, 24, 114, 98, 51, 56, 24, 115, 98, 51, 57, 24, 116, 98, 52, 48, 24, 117, 98, 52, 49, 24, 118, 98, 52, 50, 24, 119, 98, 54, 50, 24, 149, 98, 54, 51, 24, 132, 98, 54, 52, 24, 133, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 173, 97, 49, 24, 103, 98, 49, 49, 24, 104, 98, 50, 51, 24, 105, 98, 50, 54, 24, 106, 98, 51, 55, 24, 114, 98, 51, 56, 24, 115, 98, 51, 57, 24, 116, 98, 52, 48, 24, 117, 98, 52, 49, 24, 118, 98, 52, 50, 24, 119, 98, 54, 50, 24, 148, 98, 54, 51, 24, 132, 98, 54, 52, 24, 133, 162, 102, 114, 101, 100, 117, 99, 101, 167, 98, 49, 48, 24, 47, 98, 49, 49, 24, 47, 98, 50, 49, 24, 47, 98, 50, 50, 24, 47, 98, 50, 56, 24, 47, 97, 54, 24, 47, 97, 56, 24, 47, 101, 115, 104, 105, 102, 116, 163, 98, 49, 50, 24, 140, 98, 49, 51, 24, 141, 98, 49, 52, 24, 142, 162, 102, 114, 101, 100, 117, 99, 101, 167, 98, 49, 48, 24, 46, 98, 49, 49, 24, 46, 98, 50, 49, 24, 46, 98, 50, 50, 24, 46, 98, 50, 56, 24, 46, 97, 54, 24, 46, 97, 56, 24, 46, 101, 115, 104, 105, 102, 116, 163, 98, 49, 50, 24, 140, 98, 49, 51, 24, 141, 98, 49, 52, 24, 142, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 174, 97, 49, 24, 103, 98, 49, 49, 24, 104, 98, 50, 51, 24, 105, 98, 50, 54, 24, 106, 98, 51, 55, 24, 114, 98, 51, 56, 24, 115, 98, 51, 57, 24, 116, 98, 52, 48, 24, 117, 98, 52, 49, 24, 118, 98, 52, 50, 24, 119, 98, 54, 49, 24, 153, 98, 54, 50, 24, 131, 98, 54, 51, 24, 132, 98, 54, 52, 24, 133, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 174, 97, 49, 24, 103, 98, 49, 49, 24, 104, 98, 50, 51, 24, 105, 98, 50, 54, 24, 106, 98, 51, 55, 24, 114, 98, 51, 56, 24, 115, 98, 51, 57, 24, 116, 98, 52, 48, 24, 117, 98, 52, 49, 24, 118, 98, 52, 50, 24, 119, 98, 54, 49, 24, 152, 98, 54, 50, 24, 131, 98, 54, 51, 24, 132, 98, 54, 52, 24, 133, 162, 102, 114, 101, 100, 117, 99, 101, 165, 98, 50, 49, 24, 44, 98, 50, 50, 24, 44, 98, 50, 56, 24, 44, 97, 54, 24, 44, 97, 56, 24, 44, 101, 115, 104, 105, 102, 116, 162, 98, 49, 48, 24, 146, 98, 49, 49, 24, 147, 162, 102, 114, 101, 100, 117, 99, 101, 165, 98, 50, 49, 24, 43, 98, 50, 50, 24, 43, 98, 50, 56, 24, 43, 97, 54, 24, 43, 97, 56, 24, 43, 101, 115, 104, 105, 102, 116, 162, 98, 49, 48, 24, 146, 98, 49, 49, 24, 147, 161, 101, 115, 104, 105, 102, 116, 163, 98, 51, 49, 24, 161, 97, 53, 24, 160, 98, 53, 51, 24, 162, 162, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 16, 97, 56, 16, 101, 115, 104, 105, 102, 116, 163, 98, 51, 50, 24, 154, 98, 53, 55, 24, 158, 98, 53, 56, 24, 159, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 17, 97, 56, 17, 161, 102, 114, 101, 100, 117, 99, 101, 163, 98, 51, 50, 20, 97, 54, 20, 97, 56, 20, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 18, 97, 56, 18, 161, 102, 114, 101, 100, 117, 99, 101, 163, 98, 51, 50, 21, 97, 54, 21, 97, 56, 21, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 184, 31, 97, 49, 24, 103, 98, 49, 49, 24, 104, 98, 50, 51, 24, 105, 98, 50, 54, 24, 106, 98, 50, 57, 24, 107, 98, 51, 48, 24, 108, 98, 51, 49, 24, 109, 98, 51, 51, 24, 110, 98, 51, 52, 24, 111, 98, 51, 53, 24, 112, 98, 51, 54, 24, 113, 98, 51, 55, 24, 114, 98, 51, 56, 24, 115, 98, 51, 57, 24, 116, 98, 52, 48, 24, 117, 98, 52, 49, 24, 118, 98, 52, 50, 24, 119, 98, 52, 54, 24, 120, 98, 52, 55, 24, 121, 98, 52, 56, 24, 122, 98, 52, 57, 24, 123, 98, 53, 48, 24, 124, 98, 53, 49, 24, 125, 98, 53, 50, 24, 126, 98, 53, 52, 24, 172, 98, 53, 53, 24, 128, 98, 54, 48, 24, 129, 98, 54, 49, 24, 130, 98, 54, 50, 24, 131, 98, 54, 51, 24, 132, 98, 54, 52, 24, 133, 161, 101, 115, 104, 105, 102, 116, 161, 97, 49, 24, 163, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 23, 97, 56, 23, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 176, 97, 49, 24, 62, 98, 49, 49, 24, 63, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 53, 50, 24, 164, 98, 54, 48, 24, 73, 98, 54, 49, 24, 74, 98, 54, 50, 24, 75, 98, 54, 51, 24, 76, 98, 54, 52, 24, 77, 161, 101, 115, 104, 105, 102, 116, 162, 97, 50, 24, 165, 98, 50, 56, 24, 99, 161, 101, 115, 104, 105, 102, 116, 162, 97, 53, 24, 166, 98, 53, 51, 24, 167, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 184, 31, 97, 49, 24, 103, 98, 49, 49, 24, 104, 98, 50, 51, 24, 105, 98, 50, 54, 24, 106, 98, 50, 57, 24, 107, 98, 51, 48, 24, 108, 98, 51, 49, 24, 109, 98, 51, 51, 24, 110, 98, 51, 52, 24, 111, 98, 51, 53, 24, 112, 98, 51, 54, 24, 113, 98, 51, 55, 24, 114, 98, 51, 56, 24, 115, 98, 51, 57, 24, 116, 98, 52, 48, 24, 117, 98, 52, 49, 24, 118, 98, 52, 50, 24, 119, 98, 52, 54, 24, 120, 98, 52, 55, 24, 121, 98, 52, 56, 24, 122, 98, 52, 57, 24, 123, 98, 53, 48, 24, 124, 98, 53, 49, 24, 125, 98, 53, 50, 24, 126, 98, 53, 52, 24, 168, 98, 53, 53, 24, 128, 98, 54, 48, 24, 129, 98, 54, 49, 24, 130, 98, 54, 50, 24, 131, 98, 54, 51, 24, 132, 98, 54, 52, 24, 133, 161, 102, 114, 101, 100, 117, 99, 101, 163, 98, 51, 50, 22, 97, 54, 22, 97, 56, 22, 161, 101, 115, 104, 105, 102, 116, 162, 97, 54, 24, 169, 97, 56, 24, 170, 161, 102, 114, 101, 100, 117, 99, 101, 163, 98, 51, 50, 9, 97, 54, 9, 97, 56, 9, 163, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 11, 97, 56, 11, 101, 115, 104, 105, 102, 116, 184, 30, 97, 49, 24, 103, 98, 49, 49, 24, 104, 98, 50, 51, 24, 105, 98, 50, 54, 24, 106, 98, 50, 57, 24, 107, 98, 51, 48, 24, 108, 98, 51, 49, 24, 109, 98, 51, 51, 24, 110, 98, 51, 52, 24, 111, 98, 51, 53, 24, 112, 98, 51, 54, 24, 113, 98, 51, 55, 24, 114, 98, 51, 56, 24, 115, 98, 51, 57, 24, 116, 98, 52, 48, 24, 117, 98, 52, 49, 24, 118, 98, 52, 50, 24, 119, 98, 52, 54, 24, 171, 98, 52, 55, 24, 121, 98, 52, 56, 24, 122, 98, 52, 57, 24, 123, 98, 53, 48, 24, 124, 98, 53, 49, 24, 125, 98, 53, 50, 24, 126, 98, 53, 53, 24, 128, 98, 54, 48, 24, 129, 98, 54, 49, 24, 130, 98, 54, 50, 24, 131, 98, 54, 51, 24, 132, 98, 54, 52, 24, 133, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 12, 97, 56, 12, 161, 101, 115, 104, 105, 102, 116, 162, 97, 54, 24, 173, 97, 56, 24, 170, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 9, 97, 56, 9, 161, 102, 114, 101, 100, 117, 99, 101, 163, 97, 48, 9, 98, 51, 50, 9, 97, 56, 9, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 175, 97, 49, 24, 103, 98, 49, 49, 24, 104, 98, 50, 51, 24, 105, 98, 50, 54, 24, 106, 98, 51, 55, 24, 114, 98, 51, 56, 24, 115, 98, 51, 57, 24, 116, 98, 52, 48, 24, 117, 98, 52, 49, 24, 118, 98, 52, 50, 24, 119, 98, 54, 48, 24, 176, 98, 54, 49, 24, 130, 98, 54, 50, 24, 131, 98, 54, 51, 24, 132, 98, 54, 52, 24, 133, 162, 102, 114, 101, 100, 117, 99, 101, 163, 98, 50, 56, 24, 41, 97, 54, 24, 41, 97, 56, 24, 41, 101, 115, 104, 105, 102, 116, 162, 98, 50, 49, 24, 150, 98, 50, 50, 24, 151, 162, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 24, 35, 97, 56, 24, 35, 101, 115, 104, 105, 102, 116, 161, 98, 50, 56, 24, 175, 161, 101, 115, 104, 105, 102, 116, 163, 98, 50, 57, 24, 180, 98, 52, 55, 24, 181, 97, 56, 24, 179, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 177, 97, 49, 24, 183, 98, 49, 49, 24, 185, 98, 50, 51, 24, 186, 98, 50, 54, 24, 187, 98, 51, 55, 24, 188, 98, 51, 56, 24, 189, 98, 51, 57, 24, 190, 98, 52, 48, 24, 191, 98, 52, 49, 24, 192, 98, 52, 50, 24, 193, 98, 53, 50, 24, 242, 98, 54, 48, 24, 195, 98, 54, 49, 24, 196, 98, 54, 50, 24, 197, 98, 54, 51, 24, 198, 98, 54, 52, 24, 199, 97, 56, 24, 241, 161, 101, 115, 104, 105, 102, 116, 161, 98, 52, 50, 24, 238, 161, 101, 115, 104, 105, 102, 116, 161, 97, 56, 24, 182, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 177, 97, 49, 24, 183, 98, 49, 49, 24, 185, 98, 50, 51, 24, 186, 98, 50, 54, 24, 187, 98, 51, 55, 24, 188, 98, 51, 56, 24, 189, 98, 51, 57, 24, 190, 98, 52, 48, 24, 191, 98, 52, 49, 24, 192, 98, 52, 50, 24, 193, 98, 53, 50, 24, 194, 98, 54, 48, 24, 195, 98, 54, 49, 24, 196, 98, 54, 50, 24, 197, 98, 54, 51, 24, 198, 98, 54, 52, 24, 199, 97, 56, 24, 184, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 176, 97, 49, 24, 62, 98, 49, 49, 24, 63, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 53, 50, 24, 236, 98, 54, 48, 24, 73, 98, 54, 49, 24, 74, 98, 54, 50, 24, 75, 98, 54, 51, 24, 76, 98, 54, 52, 24, 77, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 177, 97, 49, 24, 62, 98, 49, 49, 24, 63, 97, 50, 24, 231, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 53, 50, 24, 232, 98, 54, 48, 24, 73, 98, 54, 49, 24, 74, 98, 54, 50, 24, 75, 98, 54, 51, 24, 76, 98, 54, 52, 24, 77, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 171, 97, 49, 24, 183, 98, 49, 49, 24, 185, 98, 50, 51, 24, 186, 98, 50, 54, 24, 187, 98, 51, 55, 24, 188, 98, 51, 56, 24, 189, 98, 51, 57, 24, 190, 98, 52, 48, 24, 191, 98, 52, 49, 24, 192, 98, 52, 50, 24, 193, 98, 54, 52, 24, 230, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 171, 97, 49, 24, 183, 98, 49, 49, 24, 185, 98, 50, 51, 24, 186, 98, 50, 54, 24, 187, 98, 51, 55, 24, 188, 98, 51, 56, 24, 189, 98, 51, 57, 24, 190, 98, 52, 48, 24, 191, 98, 52, 49, 24, 192, 98, 52, 50, 24, 193, 98, 54, 52, 24, 229, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 171, 97, 49, 24, 183, 98, 49, 49, 24, 185, 98, 50, 51, 24, 186, 98, 50, 54, 24, 187, 98, 51, 55, 24, 188, 98, 51, 56, 24, 189, 98, 51, 57, 24, 190, 98, 52, 48, 24, 191, 98, 52, 49, 24, 192, 98, 52, 50, 24, 193, 98, 54, 52, 24, 228, 161, 102, 114, 101, 100, 117, 99, 101, 172, 98, 49, 48, 24, 65, 98, 49, 49, 24, 65, 98, 49, 50, 24, 65, 98, 49, 51, 24, 65, 98, 49, 52, 24, 65, 98, 50, 49, 24, 65, 98, 50, 50, 24, 65, 98, 50, 52, 24, 65, 98, 50, 53, 24, 65, 98, 50, 55, 24, 65, 98, 50, 56, 24, 65, 97, 56, 24, 65, 161, 102, 114, 101, 100, 117, 99, 101, 172, 98, 49, 48, 24, 63, 98, 49, 49, 24, 63, 98, 49, 50, 24, 63, 98, 49, 51, 24, 63, 98, 49, 52, 24, 63, 98, 50, 49, 24, 63, 98, 50, 50, 24, 63, 98, 50, 52, 24, 63, 98, 50, 53, 24, 63, 98, 50, 55, 24, 63, 98, 50, 56, 24, 63, 97, 56, 24, 63, 161, 102, 114, 101, 100, 117, 99, 101, 172, 98, 49, 48, 24, 64, 98, 49, 49, 24, 64, 98, 49, 50, 24, 64, 98, 49, 51, 24, 64, 98, 49, 52, 24, 64, 98, 50, 49, 24, 64, 98, 50, 50, 24, 64, 98, 50, 52, 24, 64, 98, 50, 53, 24, 64, 98, 50, 55, 24, 64, 98, 50, 56, 24, 64, 97, 56, 24, 64, 161, 102, 114, 101, 100, 117, 99, 101, 172, 98, 49, 48, 24, 61, 98, 49, 49, 24, 61, 98, 49, 50, 24, 61, 98, 49, 51, 24, 61, 98, 49, 52, 24, 61, 98, 50, 49, 24, 61, 98, 50, 50, 24, 61, 98, 50, 52, 24, 61, 98, 50, 53, 24, 61, 98, 50, 55, 24, 61, 98, 50, 56, 24, 61, 97, 56, 24, 61, 161, 102, 114, 101, 100, 117, 99, 101, 172, 98, 49, 48, 24, 62, 98, 49, 49, 24, 62, 98, 49, 50, 24, 62, 98, 49, 51, 24, 62, 98, 49, 52, 24, 62, 98, 50, 49, 24, 62, 98, 50, 50, 24, 62, 98, 50, 52, 24, 62, 98, 50, 53, 24, 62, 98, 50, 55, 24, 62, 98, 50, 56, 24, 62, 97, 56, 24, 62, 161, 102, 114, 101, 100, 117, 99, 101, 172, 98, 49, 48, 24, 60, 98, 49, 49, 24, 60, 98, 49, 50, 24, 60, 98, 49, 51, 24, 60, 98, 49, 52, 24, 60, 98, 50, 49, 24, 60, 98, 50, 50, 24, 60, 98, 50, 52, 24, 60, 98, 50, 53, 24, 60, 98, 50, 55, 24, 60, 98, 50, 56, 24, 60, 97, 56, 24, 60, 161, 101, 115, 104, 105, 102, 116, 162, 98, 50, 56, 24, 221, 97, 56, 24, 220, 162, 102, 114, 101, 100, 117, 99, 101, 162, 98, 50, 56, 24, 40, 97, 56, 24, 40, 101, 115, 104, 105, 102, 116, 162, 98, 50, 49, 24, 216, 98, 50, 50, 24, 217, 162, 102, 114, 101, 100, 117, 99, 101, 164, 98, 50, 49, 24, 42, 98, 50, 50, 24, 42, 98, 50, 56, 24, 42, 97, 56, 24, 42, 101, 115, 104, 105, 102, 116, 162, 98, 49, 48, 24, 212, 98, 49, 49, 24, 213, 162, 102, 114, 101, 100, 117, 99, 101, 166, 98, 49, 48, 24, 45, 98, 49, 49, 24, 45, 98, 50, 49, 24, 45, 98, 50, 50, 24, 45, 98, 50, 56, 24, 45, 97, 56, 24, 45, 101, 115, 104, 105, 102, 116, 163, 98, 49, 50, 24, 206, 98, 49, 51, 24, 207, 98, 49, 52, 24, 208, 162, 102, 114, 101, 100, 117, 99, 101, 169, 98, 49, 48, 24, 48, 98, 49, 49, 24, 48, 98, 49, 50, 24, 48, 98, 49, 51, 24, 48, 98, 49, 52, 24, 48, 98, 50, 49, 24, 48, 98, 50, 50, 24, 48, 98, 50, 56, 24, 48, 97, 56, 24, 48, 101, 115, 104, 105, 102, 116, 163, 98, 50, 52, 24, 200, 98, 50, 53, 24, 201, 98, 50, 55, 24, 202, 161, 102, 114, 101, 100, 117, 99, 101, 172, 98, 49, 48, 24, 52, 98, 49, 49, 24, 52, 98, 49, 50, 24, 52, 98, 49, 51, 24, 52, 98, 49, 52, 24, 52, 98, 50, 49, 24, 52, 98, 50, 50, 24, 52, 98, 50, 52, 24, 52, 98, 50, 53, 24, 52, 98, 50, 55, 24, 52, 98, 50, 56, 24, 52, 97, 56, 24, 52, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 171, 97, 49, 24, 183, 98, 49, 49, 24, 185, 98, 50, 51, 24, 186, 98, 50, 54, 24, 187, 98, 51, 55, 24, 188, 98, 51, 56, 24, 189, 98, 51, 57, 24, 190, 98, 52, 48, 24, 191, 98, 52, 49, 24, 192, 98, 52, 50, 24, 193, 98, 54, 52, 24, 205, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 171, 97, 49, 24, 183, 98, 49, 49, 24, 185, 98, 50, 51, 24, 186, 98, 50, 54, 24, 187, 98, 51, 55, 24, 188, 98, 51, 56, 24, 189, 98, 51, 57, 24, 190, 98, 52, 48, 24, 191, 98, 52, 49, 24, 192, 98, 52, 50, 24, 193, 98, 54, 52, 24, 204, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 171, 97, 49, 24, 183, 98, 49, 49, 24, 185, 98, 50, 51, 24, 186, 98, 50, 54, 24, 187, 98, 51, 55, 24, 188, 98, 51, 56, 24, 189, 98, 51, 57, 24, 190, 98, 52, 48, 24, 191, 98, 52, 49, 24, 192, 98, 52, 50, 24, 193, 98, 54, 52, 24, 203, 161, 102, 114, 101, 100, 117, 99, 101, 172, 98, 49, 48, 24, 55, 98, 49, 49, 24, 55, 98, 49, 50, 24, 55, 98, 49, 51, 24, 55, 98, 49, 52, 24, 55, 98, 50, 49, 24, 55, 98, 50, 50, 24, 55, 98, 50, 52, 24, 55, 98, 50, 53, 24, 55, 98, 50, 55, 24, 55, 98, 50, 56, 24, 55, 97, 56, 24, 55, 161, 102, 114, 101, 100, 117, 99, 101, 172, 98, 49, 48, 24, 54, 98, 49, 49, 24, 54, 98, 49, 50, 24, 54, 98, 49, 51, 24, 54, 98, 49, 52, 24, 54, 98, 50, 49, 24, 54, 98, 50, 50, 24, 54, 98, 50, 52, 24, 54, 98, 50, 53, 24, 54, 98, 50, 55, 24, 54, 98, 50, 56, 24, 54, 97, 56, 24, 54, 161, 102, 114, 101, 100, 117, 99, 101, 172, 98, 49, 48, 24, 53, 98, 49, 49, 24, 53, 98, 49, 50, 24, 53, 98, 49, 51, 24, 53, 98, 49, 52, 24, 53, 98, 50, 49, 24, 53, 98, 50, 50, 24, 53, 98, 50, 52, 24, 53, 98, 50, 53, 24, 53, 98, 50, 55, 24, 53, 98, 50, 56, 24, 53, 97, 56, 24, 53, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 172, 97, 49, 24, 183, 98, 49, 49, 24, 185, 98, 50, 51, 24, 186, 98, 50, 54, 24, 187, 98, 51, 55, 24, 188, 98, 51, 56, 24, 189, 98, 51, 57, 24, 190, 98, 52, 48, 24, 191, 98, 52, 49, 24, 192, 98, 52, 50, 24, 193, 98, 54, 51, 24, 211, 98, 54, 52, 24, 199, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 172, 97, 49, 24, 183, 98, 49, 49, 24, 185, 98, 50, 51, 24, 186, 98, 50, 54, 24, 187, 98, 51, 55, 24, 188, 98, 51, 56, 24, 189, 98, 51, 57, 24, 190, 98, 52, 48, 24, 191, 98, 52, 49, 24, 192, 98, 52, 50, 24, 193, 98, 54, 51, 24, 210, 98, 54, 52, 24, 199, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 172, 97, 49, 24, 183, 98, 49, 49, 24, 185, 98, 50, 51, 24, 186, 98, 50, 54, 24, 187, 98, 51, 55, 24, 188, 98, 51, 56, 24, 189, 98, 51, 57, 24, 190, 98, 52, 48, 24, 191, 98, 52, 49, 24, 192, 98, 52, 50, 24, 193, 98, 54, 51, 24, 209, 98, 54, 52, 24, 199, 162, 102, 114, 101, 100, 117, 99, 101, 169, 98, 49, 48, 24, 51, 98, 49, 49, 24, 51, 98, 49, 50, 24, 51, 98, 49, 51, 24, 51, 98, 49, 52, 24, 51, 98, 50, 49, 24, 51, 98, 50, 50, 24, 51, 98, 50, 56, 24, 51, 97, 56, 24, 51, 101, 115, 104, 105, 102, 116, 163, 98, 50, 52, 24, 200, 98, 50, 53, 24, 201, 98, 50, 55, 24, 202, 162, 102, 114, 101, 100, 117, 99, 101, 169, 98, 49, 48, 24, 50, 98, 49, 49, 24, 50, 98, 49, 50, 24, 50, 98, 49, 51, 24, 50, 98, 49, 52, 24, 50, 98, 50, 49, 24, 50, 98, 50, 50, 24, 50, 98, 50, 56, 24, 50, 97, 56, 24, 50, 101, 115, 104, 105, 102, 116, 163, 98, 50, 52, 24, 200, 98, 50, 53, 24, 201, 98, 50, 55, 24, 202, 162, 102, 114, 101, 100, 117, 99, 101, 169, 98, 49, 48, 24, 49, 98, 49, 49, 24, 49, 98, 49, 50, 24, 49, 98, 49, 51, 24, 49, 98, 49, 52, 24, 49, 98, 50, 49, 24, 49, 98, 50, 50, 24, 49, 98, 50, 56, 24, 49, 97, 56, 24, 49, 101, 115, 104, 105, 102, 116, 163, 98, 50, 52, 24, 200, 98, 50, 53, 24, 201, 98, 50, 55, 24, 202, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 173, 97, 49, 24, 183, 98, 49, 49, 24, 185, 98, 50, 51, 24, 186, 98, 50, 54, 24, 187, 98, 51, 55, 24, 188, 98, 51, 56, 24, 189, 98, 51, 57, 24, 190, 98, 52, 48, 24, 191, 98, 52, 49, 24, 192, 98, 52, 50, 24, 193, 98, 54, 50, 24, 215, 98, 54, 51, 24, 198, 98, 54, 52, 24, 199, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 173, 97, 49, 24, 183, 98, 49, 49, 24, 185, 98, 50, 51, 24, 186, 98, 50, 54, 24, 187, 98, 51, 55, 24, 188, 98, 51, 56, 24, 189, 98, 51, 57, 24, 190, 98, 52, 48, 24, 191, 98, 52, 49, 24, 192, 98, 52, 50, 24, 193, 98, 54, 50, 24, 214, 98, 54, 51, 24, 198, 98, 54, 52, 24, 199, 162, 102, 114, 101, 100, 117, 99, 101, 166, 98, 49, 48, 24, 47, 98, 49, 49, 24, 47, 98, 50, 49, 24, 47, 98, 50, 50, 24, 47, 98, 50, 56, 24, 47, 97, 56, 24, 47, 101, 115, 104, 105, 102, 116, 163, 98, 49, 50, 24, 206, 98, 49, 51, 24, 207, 98, 49, 52, 24, 208, 162, 102, 114, 101, 100, 117, 99, 101, 166, 98, 49, 48, 24, 46, 98, 49, 49, 24, 46, 98, 50, 49, 24, 46, 98, 50, 50, 24, 46, 98, 50, 56, 24, 46, 97, 56, 24, 46, 101, 115, 104, 105, 102, 116, 163, 98, 49, 50, 24, 206, 98, 49, 51, 24, 207, 98, 49, 52, 24, 208, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 174, 97, 49, 24, 183, 98, 49, 49, 24, 185, 98, 50, 51, 24, 186, 98, 50, 54, 24, 187, 98, 51, 55, 24, 188, 98, 51, 56, 24, 189, 98, 51, 57, 24, 190, 98, 52, 48, 24, 191, 98, 52, 49, 24, 192, 98, 52, 50, 24, 193, 98, 54, 49, 24, 219, 98, 54, 50, 24, 197, 98, 54, 51, 24, 198, 98, 54, 52, 24, 199, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 174, 97, 49, 24, 183, 98, 49, 49, 24, 185, 98, 50, 51, 24, 186, 98, 50, 54, 24, 187, 98, 51, 55, 24, 188, 98, 51, 56, 24, 189, 98, 51, 57, 24, 190, 98, 52, 48, 24, 191, 98, 52, 49, 24, 192, 98, 52, 50, 24, 193, 98, 54, 49, 24, 218, 98, 54, 50, 24, 197, 98, 54, 51, 24, 198, 98, 54, 52, 24, 199, 162, 102, 114, 101, 100, 117, 99, 101, 164, 98, 50, 49, 24, 44, 98, 50, 50, 24, 44, 98, 50, 56, 24, 44, 97, 56, 24, 44, 101, 115, 104, 105, 102, 116, 162, 98, 49, 48, 24, 212, 98, 49, 49, 24, 213, 162, 102, 114, 101, 100, 117, 99, 101, 164, 98, 50, 49, 24, 43, 98, 50, 50, 24, 43, 98, 50, 56, 24, 43, 97, 56, 24, 43, 101, 115, 104, 105, 102, 116, 162, 98, 49, 48, 24, 212, 98, 49, 49, 24, 213, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 177, 97, 49, 24, 62, 98, 49, 49, 24, 63, 97, 50, 24, 223, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 53, 50, 24, 224, 98, 54, 48, 24, 73, 98, 54, 49, 24, 74, 98, 54, 50, 24, 75, 98, 54, 51, 24, 76, 98, 54, 52, 24, 77, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 175, 97, 49, 24, 183, 98, 49, 49, 24, 185, 98, 50, 51, 24, 186, 98, 50, 54, 24, 187, 98, 51, 55, 24, 188, 98, 51, 56, 24, 189, 98, 51, 57, 24, 190, 98, 52, 48, 24, 191, 98, 52, 49, 24, 192, 98, 52, 50, 24, 193, 98, 54, 48, 24, 222, 98, 54, 49, 24, 196, 98, 54, 50, 24, 197, 98, 54, 51, 24, 198, 98, 54, 52, 24, 199, 162, 102, 114, 101, 100, 117, 99, 101, 162, 98, 50, 56, 24, 41, 97, 56, 24, 41, 101, 115, 104, 105, 102, 116, 162, 98, 50, 49, 24, 216, 98, 50, 50, 24, 217, 161, 101, 115, 104, 105, 102, 116, 162, 97, 53, 24, 160, 98, 53, 51, 24, 227, 161, 101, 115, 104, 105, 102, 116, 162, 97, 50, 24, 225, 98, 50, 56, 24, 99, 161, 101, 115, 104, 105, 102, 116, 162, 97, 53, 24, 160, 98, 53, 51, 24, 226, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 24, 31, 97, 56, 24, 31, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 24, 27, 97, 56, 24, 27, 161, 102, 114, 101, 100, 117, 99, 101, 172, 98, 49, 48, 24, 58, 98, 49, 49, 24, 58, 98, 49, 50, 24, 58, 98, 49, 51, 24, 58, 98, 49, 52, 24, 58, 98, 50, 49, 24, 58, 98, 50, 50, 24, 58, 98, 50, 52, 24, 58, 98, 50, 53, 24, 58, 98, 50, 55, 24, 58, 98, 50, 56, 24, 58, 97, 56, 24, 58, 161, 102, 114, 101, 100, 117, 99, 101, 172, 98, 49, 48, 24, 57, 98, 49, 49, 24, 57, 98, 49, 50, 24, 57, 98, 49, 51, 24, 57, 98, 49, 52, 24, 57, 98, 50, 49, 24, 57, 98, 50, 50, 24, 57, 98, 50, 52, 24, 57, 98, 50, 53, 24, 57, 98, 50, 55, 24, 57, 98, 50, 56, 24, 57, 97, 56, 24, 57, 161, 102, 114, 101, 100, 117, 99, 101, 172, 98, 49, 48, 24, 56, 98, 49, 49, 24, 56, 98, 49, 50, 24, 56, 98, 49, 51, 24, 56, 98, 49, 52, 24, 56, 98, 50, 49, 24, 56, 98, 50, 50, 24, 56, 98, 50, 52, 24, 56, 98, 50, 53, 24, 56, 98, 50, 55, 24, 56, 98, 50, 56, 24, 56, 97, 56, 24, 56, 161, 101, 115, 104, 105, 102, 116, 162, 97, 53, 24, 160, 98, 53, 51, 24, 235, 161, 101, 115, 104, 105, 102, 116, 162, 97, 50, 24, 233, 98, 50, 56, 24, 99, 161, 101, 115, 104, 105, 102, 116, 162, 97, 53, 24, 160, 98, 53, 51, 24, 234, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 24, 29, 97, 56, 24, 29, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 24, 25, 97, 56, 24, 25, 161, 101, 115, 104, 105, 102, 116, 162, 97, 50, 24, 237, 98, 50, 56, 24, 99, 161, 102, 114, 101, 100, 117, 99, 101, 172, 98, 49, 48, 24, 59, 98, 49, 49, 24, 59, 98, 49, 50, 24, 59, 98, 49, 51, 24, 59, 98, 49, 52, 24, 59, 98, 50, 49, 24, 59, 98, 50, 50, 24, 59, 98, 50, 52, 24, 59, 98, 50, 53, 24, 59, 98, 50, 55, 24, 59, 98, 50, 56, 24, 59, 97, 56, 24, 59, 162, 102, 114, 101, 100, 117, 99, 101, 161, 97, 56, 13, 101, 115, 104, 105, 102, 116, 161, 98, 50, 56, 24, 239, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 176, 97, 49, 24, 183, 98, 49, 49, 24, 185, 98, 50, 51, 24, 186, 98, 50, 54, 24, 187, 98, 51, 55, 24, 188, 98, 51, 56, 24, 189, 98, 51, 57, 24, 190, 98, 52, 48, 24, 191, 98, 52, 49, 24, 192, 98, 52, 50, 24, 193, 98, 53, 50, 24, 240, 98, 54, 48, 24, 195, 98, 54, 49, 24, 196, 98, 54, 50, 24, 197, 98, 54, 51, 24, 198, 98, 54, 52, 24, 199, 162, 102, 114, 101, 100, 117, 99, 101, 161, 97, 56, 14, 101, 115, 104, 105, 102, 116, 161, 98, 50, 56, 24, 221, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 177, 97, 49, 24, 62, 98, 49, 49, 24, 63, 97, 50, 24, 249, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 53, 50, 24, 250, 98, 54, 48, 24, 73, 98, 54, 49, 24, 74, 98, 54, 50, 24, 75, 98, 54, 51, 24, 76, 98, 54, 52, 24, 77, 161, 101, 115, 104, 105, 102, 116, 162, 98, 50, 56, 24, 221, 97, 56, 24, 243, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 177, 97, 49, 24, 62, 98, 49, 49, 24, 63, 97, 50, 24, 244, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 53, 50, 24, 245, 98, 54, 48, 24, 73, 98, 54, 49, 24, 74, 98, 54, 50, 24, 75, 98, 54, 51, 24, 76, 98, 54, 52, 24, 77, 161, 101, 115, 104, 105, 102, 116, 162, 97, 53, 24, 160, 98, 53, 51, 24, 248, 161, 101, 115, 104, 105, 102, 116, 162, 97, 50, 24, 246, 98, 50, 56, 24, 99, 161, 101, 115, 104, 105, 102, 116, 162, 97, 53, 24, 160, 98, 53, 51, 24, 247, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 24, 30, 97, 56, 24, 30, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 24, 26, 97, 56, 24, 26, 161, 101, 115, 104, 105, 102, 116, 162, 97, 53, 24, 160, 98, 53, 51, 24, 253, 161, 101, 115, 104, 105, 102, 116, 162, 97, 50, 24, 251, 98, 50, 56, 24, 99, 161, 101, 115, 104, 105, 102, 116, 162, 97, 53, 24, 160, 98, 53, 51, 24, 252, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 24, 28, 97, 56, 24, 28, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 24, 24, 97, 56, 24, 24, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 176, 97, 49, 24, 62, 98, 49, 49, 24, 63, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 53, 50, 24, 255, 98, 54, 48, 24, 73, 98, 54, 49, 24, 74, 98, 54, 50, 24, 75, 98, 54, 51, 24, 76, 98, 54, 52, 24, 77, 161, 101, 115, 104, 105, 102, 116, 162, 97, 50, 25, 1, 0, 98, 50, 56, 24, 99, 161, 101, 115, 104, 105, 102, 116, 162, 97, 53, 24, 166, 98, 53, 51, 25, 1, 1, 161, 102, 114, 101, 100, 117, 99, 101, 163, 98, 51, 50, 19, 97, 54, 19, 97, 56, 19, 161, 101, 115, 104, 105, 102, 116, 161, 97, 49, 25, 1, 3, 161, 101, 115, 104, 105, 102, 116, 163, 97, 50, 25, 1, 4, 98, 52, 50, 25, 1, 5, 98, 53, 57, 25, 1, 6, 161, 101, 115, 104, 105, 102, 116, 162, 97, 53, 24, 160, 98, 53, 51, 25, 1, 11, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 50, 24, 38, 97, 55, 24, 38, 161, 101, 115, 104, 105, 102, 116, 162, 97, 50, 25, 1, 7, 97, 55, 25, 1, 8, 161, 101, 115, 104, 105, 102, 116, 162, 97, 53, 24, 160, 98, 53, 51, 25, 1, 10, 161, 101, 115, 104, 105, 102, 116, 161, 98, 52, 50, 25, 1, 9, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 50, 24, 39, 97, 55, 24, 39, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 24, 37, 97, 56, 24, 37, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 24, 36, 97, 56, 24, 36, 162, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 13, 97, 56, 13, 101, 115, 104, 105, 102, 116, 161, 98, 50, 56, 25, 1, 13, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 176, 97, 49, 24, 103, 98, 49, 49, 24, 104, 98, 50, 51, 24, 105, 98, 50, 54, 24, 106, 98, 51, 55, 24, 114, 98, 51, 56, 24, 115, 98, 51, 57, 24, 116, 98, 52, 48, 24, 117, 98, 52, 49, 24, 118, 98, 52, 50, 24, 119, 98, 53, 50, 25, 1, 14, 98, 54, 48, 24, 129, 98, 54, 49, 24, 130, 98, 54, 50, 24, 131, 98, 54, 51, 24, 132, 98, 54, 52, 24, 133, 162, 102, 114, 101, 100, 117, 99, 101, 162, 97, 54, 14, 97, 56, 14, 101, 115, 104, 105, 102, 116, 161, 98, 50, 56, 24, 175, 161, 102, 114, 101, 100, 117, 99, 101, 173, 98, 49, 48, 24, 58, 98, 49, 49, 24, 58, 98, 49, 50, 24, 58, 98, 49, 51, 24, 58, 98, 49, 52, 24, 58, 98, 50, 49, 24, 58, 98, 50, 50, 24, 58, 98, 50, 52, 24, 58, 98, 50, 53, 24, 58, 98, 50, 55, 24, 58, 98, 50, 56, 24, 58, 97, 54, 24, 58, 97, 56, 24, 58, 161, 102, 114, 101, 100, 117, 99, 101, 173, 98, 49, 48, 24, 57, 98, 49, 49, 24, 57, 98, 49, 50, 24, 57, 98, 49, 51, 24, 57, 98, 49, 52, 24, 57, 98, 50, 49, 24, 57, 98, 50, 50, 24, 57, 98, 50, 52, 24, 57, 98, 50, 53, 24, 57, 98, 50, 55, 24, 57, 98, 50, 56, 24, 57, 97, 54, 24, 57, 97, 56, 24, 57, 161, 102, 114, 101, 100, 117, 99, 101, 173, 98, 49, 48, 24, 56, 98, 49, 49, 24, 56, 98, 49, 50, 24, 56, 98, 49, 51, 24, 56, 98, 49, 52, 24, 56, 98, 50, 49, 24, 56, 98, 50, 50, 24, 56, 98, 50, 52, 24, 56, 98, 50, 53, 24, 56, 98, 50, 55, 24, 56, 98, 50, 56, 24, 56, 97, 54, 24, 56, 97, 56, 24, 56, 161, 101, 115, 104, 105, 102, 116, 162, 97, 50, 25, 1, 19, 98, 50, 56, 24, 99, 161, 102, 114, 101, 100, 117, 99, 101, 173, 98, 49, 48, 24, 59, 98, 49, 49, 24, 59, 98, 49, 50, 24, 59, 98, 49, 51, 24, 59, 98, 49, 52, 24, 59, 98, 50, 49, 24, 59, 98, 50, 50, 24, 59, 98, 50, 52, 24, 59, 98, 50, 53, 24, 59, 98, 50, 55, 24, 59, 98, 50, 56, 24, 59, 97, 54, 24, 59, 97, 56, 24, 59, 161, 102, 114, 101, 100, 117, 99, 101, 172, 98, 49, 48, 24, 58, 98, 49, 49, 24, 58, 98, 49, 50, 24, 58, 98, 49, 51, 24, 58, 98, 49, 52, 24, 58, 97, 50, 24, 58, 98, 50, 49, 24, 58, 98, 50, 50, 24, 58, 98, 50, 52, 24, 58, 98, 50, 53, 24, 58, 98, 50, 55, 24, 58, 98, 50, 56, 24, 58, 161, 102, 114, 101, 100, 117, 99, 101, 172, 98, 49, 48, 24, 57, 98, 49, 49, 24, 57, 98, 49, 50, 24, 57, 98, 49, 51, 24, 57, 98, 49, 52, 24, 57, 97, 50, 24, 57, 98, 50, 49, 24, 57, 98, 50, 50, 24, 57, 98, 50, 52, 24, 57, 98, 50, 53, 24, 57, 98, 50, 55, 24, 57, 98, 50, 56, 24, 57, 161, 102, 114, 101, 100, 117, 99, 101, 172, 98, 49, 48, 24, 56, 98, 49, 49, 24, 56, 98, 49, 50, 24, 56, 98, 49, 51, 24, 56, 98, 49, 52, 24, 56, 97, 50, 24, 56, 98, 50, 49, 24, 56, 98, 50, 50, 24, 56, 98, 50, 52, 24, 56, 98, 50, 53, 24, 56, 98, 50, 55, 24, 56, 98, 50, 56, 24, 56, 161, 101, 115, 104, 105, 102, 116, 162, 97, 50, 25, 1, 24, 98, 50, 56, 24, 99, 161, 102, 114, 101, 100, 117, 99, 101, 172, 98, 49, 48, 24, 59, 98, 49, 49, 24, 59, 98, 49, 50, 24, 59, 98, 49, 51, 24, 59, 98, 49, 52, 24, 59, 97, 50, 24, 59, 98, 50, 49, 24, 59, 98, 50, 50, 24, 59, 98, 50, 52, 24, 59, 98, 50, 53, 24, 59, 98, 50, 55, 24, 59, 98, 50, 56, 24, 59, 161, 101, 115, 104, 105, 102, 116, 162, 97, 54, 25, 1, 26, 97, 56, 24, 170, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 9, 97, 56, 9, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 175, 97, 49, 1, 98, 49, 49, 2, 98, 50, 51, 3, 98, 50, 54, 4, 98, 51, 55, 12, 98, 51, 56, 13, 98, 51, 57, 14, 98, 52, 48, 15, 98, 52, 49, 16, 98, 52, 50, 17, 98, 54, 48, 25, 1, 28, 98, 54, 49, 24, 28, 98, 54, 50, 24, 29, 98, 54, 51, 24, 30, 98, 54, 52, 24, 31, 162, 102, 114, 101, 100, 117, 99, 101, 163, 97, 48, 24, 41, 98, 50, 56, 24, 41, 97, 56, 24, 41, 101, 115, 104, 105, 102, 116, 162, 98, 50, 49, 24, 48, 98, 50, 50, 24, 49, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 184, 30, 97, 49, 1, 98, 49, 49, 2, 98, 50, 51, 3, 98, 50, 54, 4, 98, 50, 57, 5, 98, 51, 48, 6, 98, 51, 49, 7, 98, 51, 51, 8, 98, 51, 52, 9, 98, 51, 53, 10, 98, 51, 54, 11, 98, 51, 55, 12, 98, 51, 56, 13, 98, 51, 57, 14, 98, 52, 48, 15, 98, 52, 49, 16, 98, 52, 50, 17, 98, 52, 54, 25, 1, 30, 98, 52, 55, 20, 98, 52, 56, 21, 98, 52, 57, 22, 98, 53, 48, 23, 98, 53, 49, 24, 24, 98, 53, 50, 24, 25, 98, 53, 53, 24, 26, 98, 54, 48, 24, 27, 98, 54, 49, 24, 28, 98, 54, 50, 24, 29, 98, 54, 51, 24, 30, 98, 54, 52, 24, 31, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 2, 97, 56, 2, 162, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 24, 35, 97, 56, 24, 35, 101, 115, 104, 105, 102, 116, 161, 98, 50, 56, 25, 1, 27, 161, 101, 115, 104, 105, 102, 116, 163, 98, 50, 57, 24, 180, 98, 52, 55, 25, 1, 34, 97, 56, 25, 1, 33, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 177, 97, 49, 24, 183, 98, 49, 49, 24, 185, 98, 50, 51, 24, 186, 98, 50, 54, 24, 187, 98, 51, 55, 24, 188, 98, 51, 56, 24, 189, 98, 51, 57, 24, 190, 98, 52, 48, 24, 191, 98, 52, 49, 24, 192, 98, 52, 50, 24, 193, 98, 53, 50, 25, 1, 50, 98, 54, 48, 24, 195, 98, 54, 49, 24, 196, 98, 54, 50, 24, 197, 98, 54, 51, 24, 198, 98, 54, 52, 24, 199, 97, 56, 25, 1, 49, 161, 101, 115, 104, 105, 102, 116, 161, 97, 56, 25, 1, 35, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 177, 97, 49, 24, 183, 98, 49, 49, 24, 185, 98, 50, 51, 24, 186, 98, 50, 54, 24, 187, 98, 51, 55, 24, 188, 98, 51, 56, 24, 189, 98, 51, 57, 24, 190, 98, 52, 48, 24, 191, 98, 52, 49, 24, 192, 98, 52, 50, 24, 193, 98, 53, 50, 25, 1, 37, 98, 54, 48, 24, 195, 98, 54, 49, 24, 196, 98, 54, 50, 24, 197, 98, 54, 51, 24, 198, 98, 54, 52, 24, 199, 97, 56, 25, 1, 36, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 177, 97, 49, 24, 62, 98, 49, 49, 24, 63, 97, 50, 25, 1, 44, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 53, 50, 25, 1, 45, 98, 54, 48, 24, 73, 98, 54, 49, 24, 74, 98, 54, 50, 24, 75, 98, 54, 51, 24, 76, 98, 54, 52, 24, 77, 161, 101, 115, 104, 105, 102, 116, 162, 98, 50, 56, 24, 221, 97, 56, 25, 1, 38, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 177, 97, 49, 24, 62, 98, 49, 49, 24, 63, 97, 50, 25, 1, 39, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 53, 50, 25, 1, 40, 98, 54, 48, 24, 73, 98, 54, 49, 24, 74, 98, 54, 50, 24, 75, 98, 54, 51, 24, 76, 98, 54, 52, 24, 77, 161, 101, 115, 104, 105, 102, 116, 162, 97, 53, 24, 58, 98, 53, 51, 25, 1, 43, 161, 101, 115, 104, 105, 102, 116, 162, 97, 50, 25, 1, 41, 98, 50, 56, 24, 99, 161, 101, 115, 104, 105, 102, 116, 162, 97, 53, 24, 58, 98, 53, 51, 25, 1, 42, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 24, 31, 97, 56, 24, 31, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 24, 27, 97, 56, 24, 27, 161, 101, 115, 104, 105, 102, 116, 162, 97, 53, 24, 58, 98, 53, 51, 25, 1, 48, 161, 101, 115, 104, 105, 102, 116, 162, 97, 50, 25, 1, 46, 98, 50, 56, 24, 99, 161, 101, 115, 104, 105, 102, 116, 162, 97, 53, 24, 58, 98, 53, 51, 25, 1, 47, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 24, 29, 97, 56, 24, 29, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 24, 25, 97, 56, 24, 25, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 177, 97, 49, 24, 62, 98, 49, 49, 24, 63, 97, 50, 25, 1, 57, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 53, 50, 25, 1, 58, 98, 54, 48, 24, 73, 98, 54, 49, 24, 74, 98, 54, 50, 24, 75, 98, 54, 51, 24, 76, 98, 54, 52, 24, 77, 161, 101, 115, 104, 105, 102, 116, 162, 98, 50, 56, 24, 221, 97, 56, 25, 1, 51, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 177, 97, 49, 24, 62, 98, 49, 49, 24, 63, 97, 50, 25, 1, 52, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 53, 50, 25, 1, 53, 98, 54, 48, 24, 73, 98, 54, 49, 24, 74, 98, 54, 50, 24, 75, 98, 54, 51, 24, 76, 98, 54, 52, 24, 77, 161, 101, 115, 104, 105, 102, 116, 162, 97, 53, 24, 58, 98, 53, 51, 25, 1, 56, 161, 101, 115, 104, 105, 102, 116, 162, 97, 50, 25, 1, 54, 98, 50, 56, 24, 99, 161, 101, 115, 104, 105, 102, 116, 162, 97, 53, 24, 58, 98, 53, 51, 25, 1, 55, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 24, 30, 97, 56, 24, 30, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 24, 26, 97, 56, 24, 26, 161, 101, 115, 104, 105, 102, 116, 162, 97, 53, 24, 58, 98, 53, 51, 25, 1, 61, 161, 101, 115, 104, 105, 102, 116, 162, 97, 50, 25, 1, 59, 98, 50, 56, 24, 99, 161, 101, 115, 104, 105, 102, 116, 162, 97, 53, 24, 58, 98, 53, 51, 25, 1, 60, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 24, 28, 97, 56, 24, 28, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 24, 24, 97, 56, 24, 24, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 176, 97, 49, 24, 62, 98, 49, 49, 24, 63, 98, 50, 51, 24, 64, 98, 50, 54, 24, 65, 98, 51, 55, 24, 66, 98, 51, 56, 24, 67, 98, 51, 57, 24, 68, 98, 52, 48, 24, 69, 98, 52, 49, 24, 70, 98, 52, 50, 24, 71, 98, 53, 50, 25, 1, 63, 98, 54, 48, 24, 73, 98, 54, 49, 24, 74, 98, 54, 50, 24, 75, 98, 54, 51, 24, 76, 98, 54, 52, 24, 77, 161, 101, 115, 104, 105, 102, 116, 162, 97, 50, 25, 1, 64, 98, 50, 56, 24, 99, 161, 101, 115, 104, 105, 102, 116, 162, 97, 53, 24, 101, 98, 53, 51, 25, 1, 65, 161, 102, 114, 101, 100, 117, 99, 101, 163, 97, 48, 19, 98, 51, 50, 19, 97, 56, 19, 161, 101, 115, 104, 105, 102, 116, 161, 97, 49, 25, 1, 67, 161, 101, 115, 104, 105, 102, 116, 163, 97, 50, 25, 1, 68, 98, 52, 50, 25, 1, 5, 98, 53, 57, 25, 1, 69, 161, 101, 115, 104, 105, 102, 116, 162, 97, 53, 24, 58, 98, 53, 51, 25, 1, 72, 161, 101, 115, 104, 105, 102, 116, 162, 97, 50, 25, 1, 70, 97, 55, 25, 1, 8, 161, 101, 115, 104, 105, 102, 116, 162, 97, 53, 24, 58, 98, 53, 51, 25, 1, 71, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 24, 37, 97, 56, 24, 37, 161, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 24, 36, 97, 56, 24, 36, 162, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 13, 97, 56, 13, 101, 115, 104, 105, 102, 116, 161, 98, 50, 56, 25, 1, 74, 162, 104, 99, 111, 110, 116, 101, 120, 116, 115, 129, 1, 101, 115, 104, 105, 102, 116, 176, 97, 49, 1, 98, 49, 49, 2, 98, 50, 51, 3, 98, 50, 54, 4, 98, 51, 55, 12, 98, 51, 56, 13, 98, 51, 57, 14, 98, 52, 48, 15, 98, 52, 49, 16, 98, 52, 50, 17, 98, 53, 50, 25, 1, 75, 98, 54, 48, 24, 27, 98, 54, 49, 24, 28, 98, 54, 50, 24, 29, 98, 54, 51, 24, 30, 98, 54, 52, 24, 31, 162, 102, 114, 101, 100, 117, 99, 101, 162, 97, 48, 14, 97, 56, 14, 101, 115, 104, 105, 102, 116, 161, 98, 50, 56, 25, 1, 27, 161, 102, 114, 101, 100, 117, 99, 101, 173, 97, 48, 24, 58, 98, 49, 48, 24, 58, 98, 49, 49, 24, 58, 98, 49, 50, 24, 58, 98, 49, 51, 24, 58, 98, 49, 52, 24, 58, 98, 50, 49, 24, 58, 98, 50, 50, 24, 58, 98, 50, 52, 24, 58, 98, 50, 53, 24, 58, 98, 50, 55, 24, 58, 98, 50, 56, 24, 58, 97, 56, 24, 58, 161, 102, 114, 101, 100, 117, 99, 101, 173, 97, 48, 24, 57, 98, 49, 48, 24, 57, 98, 49, 49, 24, 57, 98, 49, 50, 24, 57, 98, 49, 51, 24, 57, 98, 49, 52, 24, 57, 98, 50, 49, 24, 57, 98, 50, 50, 24, 57, 98, 50, 52, 24, 57, 98, 50, 53, 24, 57, 98, 50, 55, 24, 57, 98, 50, 56, 24, 57, 97, 56, 24, 57, 161, 102, 114, 101, 100, 117, 99, 101, 173, 97, 48, 24, 56, 98, 49, 48, 24, 56, 98, 49, 49, 24, 56, 98, 49, 50, 24, 56, 98, 49, 51, 24, 56, 98, 49, 52, 24, 56, 98, 50, 49, 24, 56, 98, 50, 50, 24, 56, 98, 50, 52, 24, 56, 98, 50, 53, 24, 56, 98, 50, 55, 24, 56, 98, 50, 56, 24, 56, 97, 56, 24, 56, 161, 101, 115, 104, 105, 102, 116, 162, 97, 50, 25, 1, 80, 98, 50, 56, 24, 99, 161, 102, 114, 101, 100, 117, 99, 101, 173, 97, 48, 24, 59, 98, 49, 48, 24, 59, 98, 49, 49, 24, 59, 98, 49, 50, 24, 59, 98, 49, 51, 24, 59, 98, 49, 52, 24, 59, 98, 50, 49, 24, 59, 98, 50, 50, 24, 59, 98, 50, 52, 24, 59, 98, 50, 53, 24, 59, 98, 50, 55, 24, 59, 98, 50, 56, 24, 59, 97, 56, 24, 59
+  alignas(8) static constexpr uint8_t kImage[] = {
+    65, 76, 73, 79, 84, 72, 83, 89, 1, 0, 0, 0, 4, 3, 2, 1,
+    48, 0, 0, 0, 46, 0, 0, 0, 232, 0, 0, 0, 0, 0, 0, 0,
+    97, 16, 0, 0, 0, 0, 0, 0, 80, 17, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 80, 18, 0, 0, 0, 0, 0, 0,
+    8, 0, 0, 0, 0, 0, 0, 0, 88, 18, 0, 0, 0, 0, 0, 0,
+    64, 63, 0, 0, 0, 0, 0, 0, 152, 81, 0, 0, 0, 0, 0, 0,
+    96, 1, 0, 0, 0, 0, 0, 0, 248, 82, 0, 0, 0, 0, 0, 0,
+    128, 16, 0, 0, 0, 0, 0, 0, 120, 99, 0, 0, 0, 0, 0, 0,
+    88, 0, 0, 0, 0, 0, 0, 0, 208, 99, 0, 0, 0, 0, 0, 0,
+    68, 5, 0, 0, 0, 0, 0, 0, 24, 105, 0, 0, 0, 0, 0, 0,
+    68, 5, 0, 0, 0, 0, 0, 0, 96, 110, 0, 0, 0, 0, 0, 0,
+    134, 21, 0, 0, 0, 0, 0, 0, 232, 131, 0, 0, 0, 0, 0, 0,
+    12, 43, 0, 0, 0, 0, 0, 0, 248, 174, 0, 0, 0, 0, 0, 0,
+    72, 5, 0, 0, 0, 0, 0, 0, 64, 180, 0, 0, 0, 0, 0, 0,
+    88, 0, 0, 0, 0, 0, 0, 0, 164, 104, 102, 111, 114, 109, 117, 108,
+    97, 115, 152, 66, 162, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116,
+    114, 100, 112, 108, 97, 121, 98, 105, 100, 24, 45, 100, 104, 101, 97, 100,
+    24, 44, 162, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 101,
+    115, 116, 109, 116, 115, 98, 105, 100, 24, 46, 100, 104, 101, 97, 100, 24,
+    45, 162, 100, 98, 111, 100, 121, 131, 162, 100, 97, 116, 116, 114, 99, 46,
+    46, 46, 98, 105, 100, 24, 45, 161, 98, 105, 100, 8, 162, 100, 97, 116,
+    116, 114, 101, 115, 116, 109, 116, 115, 98, 105, 100, 24, 46, 100, 104, 101,
+    97, 100, 24, 45, 162, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116,
+    114, 103, 100, 101, 99, 108, 97, 114, 101, 98, 105, 100, 24, 47, 100, 104,
+    101, 97, 100, 24, 46, 162, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116,
+    116, 114, 102, 98, 114, 97, 110, 99, 104, 98, 105, 100, 24, 48, 100, 104,
+    101, 97, 100, 24, 46, 162, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116,
+    116, 114, 103, 105, 116, 101, 114, 97, 116, 101, 98, 105, 100, 24, 49, 100,
+    104, 101, 97, 100, 24, 46, 162, 100, 98, 111, 100, 121, 129, 162, 100, 97,
+    116, 116, 114, 103, 99, 111, 110, 116, 114, 111, 108, 98, 105, 100, 24, 50,
+    100, 104, 101, 97, 100, 24, 46, 162, 100, 98, 111, 100, 121, 129, 162, 100,
+    97, 116, 116, 114, 104, 102, 117, 110, 99, 116, 105, 111, 110, 98, 105, 100,
+    24, 51, 100, 104, 101, 97, 100, 24, 46, 162, 100, 98, 111, 100, 121, 129,
+    162, 100, 97, 116, 116, 114, 106, 101, 120, 112, 114, 101, 115, 115, 105, 111,
+    110, 98, 105, 100, 24, 52, 100, 104, 101, 97, 100, 24, 46, 162, 100, 98,
+    111, 100, 121, 131, 161, 98, 105, 100, 5, 162, 100, 97, 116, 116, 114, 99,
+    46, 46, 46, 98, 105, 100, 24, 54, 161, 98, 105, 100, 6, 100, 104, 101,
+    97, 100, 24, 53, 162, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116,
+    114, 101, 115, 116, 109, 116, 115, 98, 105, 100, 24, 46, 100, 104, 101, 97,
+    100, 24, 54, 162, 100, 98, 111, 100, 121, 130, 162, 100, 97, 116, 116, 114,
+    99, 46, 46, 46, 98, 105, 100, 24, 54, 161, 98, 105, 100, 8, 100, 104,
+    101, 97, 100, 24, 54, 162, 100, 98, 111, 100, 121, 131, 162, 100, 97, 116,
+    116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 54, 161, 98, 105, 100, 8,
+    162, 100, 97, 116, 116, 114, 101, 115, 116, 109, 116, 115, 98, 105, 100, 24,
+    46, 100, 104, 101, 97, 100, 24, 54, 162, 100, 98, 111, 100, 121, 130, 161,
+    98, 105, 100, 24, 29, 162, 100, 97, 116, 116, 114, 100, 110, 97, 109, 101,
+    98, 105, 100, 24, 42, 100, 104, 101, 97, 100, 24, 47, 162, 100, 98, 111,
+    100, 121, 132, 161, 98, 105, 100, 24, 29, 162, 100, 97, 116, 116, 114, 100,
+    110, 97, 109, 101, 98, 105, 100, 24, 42, 161, 98, 105, 100, 24, 28, 162,
+    100, 97, 116, 116, 114, 100, 105, 110, 105, 116, 98, 105, 100, 24, 52, 100,
+    104, 101, 97, 100, 24, 47, 162, 100, 98, 111, 100, 121, 129, 162, 100, 97,
+    116, 116, 114, 103, 98, 114, 97, 110, 99, 104, 115, 98, 105, 100, 24, 55,
+    100, 104, 101, 97, 100, 24, 48, 162, 100, 98, 111, 100, 121, 130, 162, 100,
+    97, 116, 116, 114, 103, 98, 114, 97, 110, 99, 104, 115, 98, 105, 100, 24,
+    55, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 56,
+    100, 104, 101, 97, 100, 24, 48, 162, 100, 98, 111, 100, 121, 130, 162, 100,
+    97, 116, 116, 114, 103, 98, 114, 97, 110, 99, 104, 115, 98, 105, 100, 24,
+    55, 162, 100, 97, 116, 116, 114, 103, 98, 114, 97, 110, 99, 104, 115, 98,
+    105, 100, 24, 57, 100, 104, 101, 97, 100, 24, 48, 162, 100, 98, 111, 100,
+    121, 131, 162, 100, 97, 116, 116, 114, 103, 98, 114, 97, 110, 99, 104, 115,
+    98, 105, 100, 24, 55, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98,
+    105, 100, 24, 56, 162, 100, 97, 116, 116, 114, 103, 98, 114, 97, 110, 99,
+    104, 115, 98, 105, 100, 24, 57, 100, 104, 101, 97, 100, 24, 48, 162, 100,
+    98, 111, 100, 121, 133, 161, 98, 105, 100, 24, 31, 161, 98, 105, 100, 1,
+    162, 100, 97, 116, 116, 114, 105, 99, 111, 110, 100, 105, 116, 105, 111, 110,
+    98, 105, 100, 24, 52, 161, 98, 105, 100, 2, 162, 100, 97, 116, 116, 114,
+    99, 46, 46, 46, 98, 105, 100, 24, 53, 100, 104, 101, 97, 100, 24, 55,
+    162, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 103, 98, 114,
+    97, 110, 99, 104, 115, 98, 105, 100, 24, 58, 100, 104, 101, 97, 100, 24,
+    56, 162, 100, 98, 111, 100, 121, 130, 162, 100, 97, 116, 116, 114, 99, 46,
+    46, 46, 98, 105, 100, 24, 56, 162, 100, 97, 116, 116, 114, 103, 98, 114,
+    97, 110, 99, 104, 115, 98, 105, 100, 24, 58, 100, 104, 101, 97, 100, 24,
+    56, 162, 100, 98, 111, 100, 121, 134, 161, 98, 105, 100, 24, 32, 161, 98,
+    105, 100, 24, 31, 161, 98, 105, 100, 1, 162, 100, 97, 116, 116, 114, 105,
+    99, 111, 110, 100, 105, 116, 105, 111, 110, 98, 105, 100, 24, 52, 161, 98,
+    105, 100, 2, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100,
+    24, 53, 100, 104, 101, 97, 100, 24, 58, 162, 100, 98, 111, 100, 121, 130,
+    161, 98, 105, 100, 24, 32, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46,
+    98, 105, 100, 24, 53, 100, 104, 101, 97, 100, 24, 57, 162, 100, 98, 111,
+    100, 121, 134, 161, 98, 105, 100, 24, 33, 161, 98, 105, 100, 1, 161, 98,
+    105, 100, 8, 161, 98, 105, 100, 8, 161, 98, 105, 100, 2, 162, 100, 97,
+    116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 53, 100, 104, 101, 97,
+    100, 24, 49, 162, 100, 98, 111, 100, 121, 135, 161, 98, 105, 100, 24, 33,
+    161, 98, 105, 100, 1, 162, 100, 97, 116, 116, 114, 100, 105, 110, 105, 116,
+    98, 105, 100, 24, 47, 161, 98, 105, 100, 8, 161, 98, 105, 100, 8, 161,
+    98, 105, 100, 2, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105,
+    100, 24, 53, 100, 104, 101, 97, 100, 24, 49, 162, 100, 98, 111, 100, 121,
+    135, 161, 98, 105, 100, 24, 33, 161, 98, 105, 100, 1, 161, 98, 105, 100,
+    8, 162, 100, 97, 116, 116, 114, 100, 99, 111, 110, 100, 98, 105, 100, 24,
+    52, 161, 98, 105, 100, 8, 161, 98, 105, 100, 2, 162, 100, 97, 116, 116,
+    114, 99, 46, 46, 46, 98, 105, 100, 24, 53, 100, 104, 101, 97, 100, 24,
+    49, 162, 100, 98, 111, 100, 121, 136, 161, 98, 105, 100, 24, 33, 161, 98,
+    105, 100, 1, 162, 100, 97, 116, 116, 114, 100, 105, 110, 105, 116, 98, 105,
+    100, 24, 47, 161, 98, 105, 100, 8, 162, 100, 97, 116, 116, 114, 100, 99,
+    111, 110, 100, 98, 105, 100, 24, 52, 161, 98, 105, 100, 8, 161, 98, 105,
+    100, 2, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24,
+    53, 100, 104, 101, 97, 100, 24, 49, 162, 100, 98, 111, 100, 121, 135, 161,
+    98, 105, 100, 24, 33, 161, 98, 105, 100, 1, 161, 98, 105, 100, 8, 161,
+    98, 105, 100, 8, 162, 100, 97, 116, 116, 114, 100, 99, 116, 114, 108, 98,
+    105, 100, 24, 52, 161, 98, 105, 100, 2, 162, 100, 97, 116, 116, 114, 99,
+    46, 46, 46, 98, 105, 100, 24, 53, 100, 104, 101, 97, 100, 24, 49, 162,
+    100, 98, 111, 100, 121, 136, 161, 98, 105, 100, 24, 33, 161, 98, 105, 100,
+    1, 162, 100, 97, 116, 116, 114, 100, 105, 110, 105, 116, 98, 105, 100, 24,
+    47, 161, 98, 105, 100, 8, 161, 98, 105, 100, 8, 162, 100, 97, 116, 116,
+    114, 100, 99, 116, 114, 108, 98, 105, 100, 24, 52, 161, 98, 105, 100, 2,
+    162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 53, 100,
+    104, 101, 97, 100, 24, 49, 162, 100, 98, 111, 100, 121, 136, 161, 98, 105,
+    100, 24, 33, 161, 98, 105, 100, 1, 161, 98, 105, 100, 8, 162, 100, 97,
+    116, 116, 114, 100, 99, 111, 110, 100, 98, 105, 100, 24, 52, 161, 98, 105,
+    100, 8, 162, 100, 97, 116, 116, 114, 100, 99, 116, 114, 108, 98, 105, 100,
+    24, 52, 161, 98, 105, 100, 2, 162, 100, 97, 116, 116, 114, 99, 46, 46,
+    46, 98, 105, 100, 24, 53, 100, 104, 101, 97, 100, 24, 49, 162, 100, 98,
+    111, 100, 121, 137, 161, 98, 105, 100, 24, 33, 161, 98, 105, 100, 1, 162,
+    100, 97, 116, 116, 114, 100, 105, 110, 105, 116, 98, 105, 100, 24, 47, 161,
+    98, 105, 100, 8, 162, 100, 97, 116, 116, 114, 100, 99, 111, 110, 100, 98,
+    105, 100, 24, 52, 161, 98, 105, 100, 8, 162, 100, 97, 116, 116, 114, 100,
+    99, 116, 114, 108, 98, 105, 100, 24, 52, 161, 98, 105, 100, 2, 162, 100,
+    97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 53, 100, 104, 101,
+    97, 100, 24, 49, 163, 100, 98, 111, 100, 121, 129, 161, 98, 105, 100, 24,
+    35, 100, 102, 111, 114, 109, 101, 98, 114, 101, 97, 107, 100, 104, 101, 97,
+    100, 24, 50, 163, 100, 98, 111, 100, 121, 129, 161, 98, 105, 100, 24, 34,
+    100, 102, 111, 114, 109, 104, 99, 111, 110, 116, 105, 110, 117, 101, 100, 104,
+    101, 97, 100, 24, 50, 163, 100, 98, 111, 100, 121, 129, 161, 98, 105, 100,
+    24, 36, 100, 102, 111, 114, 109, 102, 114, 101, 116, 117, 114, 110, 100, 104,
+    101, 97, 100, 24, 50, 163, 100, 98, 111, 100, 121, 130, 161, 98, 105, 100,
+    24, 36, 162, 100, 97, 116, 116, 114, 100, 101, 120, 112, 114, 98, 105, 100,
+    24, 52, 100, 102, 111, 114, 109, 102, 114, 101, 116, 117, 114, 110, 100, 104,
+    101, 97, 100, 24, 50, 162, 100, 98, 111, 100, 121, 133, 161, 98, 105, 100,
+    24, 30, 162, 100, 97, 116, 116, 114, 100, 110, 97, 109, 101, 98, 105, 100,
+    24, 42, 161, 98, 105, 100, 1, 161, 98, 105, 100, 2, 162, 100, 97, 116,
+    116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 53, 100, 104, 101, 97, 100,
+    24, 51, 162, 100, 98, 111, 100, 121, 134, 161, 98, 105, 100, 24, 30, 162,
+    100, 97, 116, 116, 114, 100, 110, 97, 109, 101, 98, 105, 100, 24, 42, 161,
+    98, 105, 100, 1, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105,
+    100, 24, 59, 161, 98, 105, 100, 2, 162, 100, 97, 116, 116, 114, 99, 46,
+    46, 46, 98, 105, 100, 24, 53, 100, 104, 101, 97, 100, 24, 51, 162, 100,
+    98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 102, 112, 97, 114, 97,
+    109, 115, 98, 105, 100, 24, 42, 100, 104, 101, 97, 100, 24, 59, 162, 100,
+    98, 111, 100, 121, 131, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98,
+    105, 100, 24, 59, 161, 98, 105, 100, 7, 162, 100, 97, 116, 116, 114, 102,
+    112, 97, 114, 97, 109, 115, 98, 105, 100, 24, 42, 100, 104, 101, 97, 100,
+    24, 59, 162, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 99,
+    46, 46, 46, 98, 105, 100, 24, 60, 100, 104, 101, 97, 100, 24, 52, 163,
+    100, 98, 111, 100, 121, 131, 162, 100, 97, 116, 116, 114, 99, 108, 104, 115,
+    98, 105, 100, 24, 52, 162, 100, 97, 116, 116, 114, 98, 111, 112, 98, 105,
+    100, 24, 28, 162, 100, 97, 116, 116, 114, 99, 114, 104, 115, 98, 105, 100,
+    24, 60, 100, 102, 111, 114, 109, 102, 98, 105, 110, 97, 114, 121, 100, 104,
+    101, 97, 100, 24, 52, 162, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116,
+    116, 114, 99, 46, 46, 46, 98, 105, 100, 24, 61, 100, 104, 101, 97, 100,
+    24, 60, 163, 100, 98, 111, 100, 121, 131, 162, 100, 97, 116, 116, 114, 99,
+    108, 104, 115, 98, 105, 100, 24, 60, 162, 100, 97, 116, 116, 114, 98, 111,
+    112, 98, 105, 100, 21, 162, 100, 97, 116, 116, 114, 99, 114, 104, 115, 98,
+    105, 100, 24, 61, 100, 102, 111, 114, 109, 102, 98, 105, 110, 97, 114, 121,
+    100, 104, 101, 97, 100, 24, 60, 163, 100, 98, 111, 100, 121, 131, 162, 100,
+    97, 116, 116, 114, 99, 108, 104, 115, 98, 105, 100, 24, 60, 162, 100, 97,
+    116, 116, 114, 98, 111, 112, 98, 105, 100, 22, 162, 100, 97, 116, 116, 114,
+    99, 114, 104, 115, 98, 105, 100, 24, 61, 100, 102, 111, 114, 109, 102, 98,
+    105, 110, 97, 114, 121, 100, 104, 101, 97, 100, 24, 60, 162, 100, 98, 111,
+    100, 121, 129, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46, 98, 105, 100,
+    24, 62, 100, 104, 101, 97, 100, 24, 61, 163, 100, 98, 111, 100, 121, 131,
+    162, 100, 97, 116, 116, 114, 99, 108, 104, 115, 98, 105, 100, 24, 61, 162,
+    100, 97, 116, 116, 114, 98, 111, 112, 98, 105, 100, 10, 162, 100, 97, 116,
+    116, 114, 99, 114, 104, 115, 98, 105, 100, 24, 62, 100, 102, 111, 114, 109,
+    102, 98, 105, 110, 97, 114, 121, 100, 104, 101, 97, 100, 24, 61, 163, 100,
+    98, 111, 100, 121, 131, 162, 100, 97, 116, 116, 114, 99, 108, 104, 115, 98,
+    105, 100, 24, 61, 162, 100, 97, 116, 116, 114, 98, 111, 112, 98, 105, 100,
+    11, 162, 100, 97, 116, 116, 114, 99, 114, 104, 115, 98, 105, 100, 24, 62,
+    100, 102, 111, 114, 109, 102, 98, 105, 110, 97, 114, 121, 100, 104, 101, 97,
+    100, 24, 61, 162, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114,
+    99, 46, 46, 46, 98, 105, 100, 24, 63, 100, 104, 101, 97, 100, 24, 62,
+    163, 100, 98, 111, 100, 121, 131, 162, 100, 97, 116, 116, 114, 99, 108, 104,
+    115, 98, 105, 100, 24, 62, 162, 100, 97, 116, 116, 114, 98, 111, 112, 98,
+    105, 100, 12, 162, 100, 97, 116, 116, 114, 99, 114, 104, 115, 98, 105, 100,
+    24, 63, 100, 102, 111, 114, 109, 102, 98, 105, 110, 97, 114, 121, 100, 104,
+    101, 97, 100, 24, 62, 163, 100, 98, 111, 100, 121, 131, 162, 100, 97, 116,
+    116, 114, 99, 108, 104, 115, 98, 105, 100, 24, 62, 162, 100, 97, 116, 116,
+    114, 98, 111, 112, 98, 105, 100, 13, 162, 100, 97, 116, 116, 114, 99, 114,
+    104, 115, 98, 105, 100, 24, 63, 100, 102, 111, 114, 109, 102, 98, 105, 110,
+    97, 114, 121, 100, 104, 101, 97, 100, 24, 62, 163, 100, 98, 111, 100, 121,
+    131, 162, 100, 97, 116, 116, 114, 99, 108, 104, 115, 98, 105, 100, 24, 62,
+    162, 100, 97, 116, 116, 114, 98, 111, 112, 98, 105, 100, 14, 162, 100, 97,
+    116, 116, 114, 99, 114, 104, 115, 98, 105, 100, 24, 63, 100, 102, 111, 114,
+    109, 102, 98, 105, 110, 97, 114, 121, 100, 104, 101, 97, 100, 24, 62, 162,
+    100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 99, 46, 46, 46,
+    98, 105, 100, 24, 64, 100, 104, 101, 97, 100, 24, 63, 163, 100, 98, 111,
+    100, 121, 131, 162, 100, 97, 116, 116, 114, 99, 108, 104, 115, 98, 105, 100,
+    24, 63, 162, 100, 97, 116, 116, 114, 98, 111, 112, 98, 105, 100, 24, 24,
+    162, 100, 97, 116, 116, 114, 99, 114, 104, 115, 98, 105, 100, 24, 64, 100,
+    102, 111, 114, 109, 102, 98, 105, 110, 97, 114, 121, 100, 104, 101, 97, 100,
+    24, 63, 163, 100, 98, 111, 100, 121, 131, 162, 100, 97, 116, 116, 114, 99,
+    108, 104, 115, 98, 105, 100, 24, 63, 162, 100, 97, 116, 116, 114, 98, 111,
+    112, 98, 105, 100, 24, 25, 162, 100, 97, 116, 116, 114, 99, 114, 104, 115,
+    98, 105, 100, 24, 64, 100, 102, 111, 114, 109, 102, 98, 105, 110, 97, 114,
+    121, 100, 104, 101, 97, 100, 24, 63, 163, 100, 98, 111, 100, 121, 131, 162,
+    100, 97, 116, 116, 114, 99, 108, 104, 115, 98, 105, 100, 24, 63, 162, 100,
+    97, 116, 116, 114, 98, 111, 112, 98, 105, 100, 24, 27, 162, 100, 97, 116,
+    116, 114, 99, 114, 104, 115, 98, 105, 100, 24, 64, 100, 102, 111, 114, 109,
+    102, 98, 105, 110, 97, 114, 121, 100, 104, 101, 97, 100, 24, 63, 163, 100,
+    98, 111, 100, 121, 130, 162, 100, 97, 116, 116, 114, 98, 111, 112, 98, 105,
+    100, 11, 162, 100, 97, 116, 116, 114, 99, 114, 104, 115, 98, 105, 100, 24,
+    64, 100, 102, 111, 114, 109, 100, 109, 111, 110, 111, 100, 104, 101, 97, 100,
+    24, 64, 163, 100, 98, 111, 100, 121, 130, 162, 100, 97, 116, 116, 114, 98,
+    111, 112, 98, 105, 100, 23, 162, 100, 97, 116, 116, 114, 99, 114, 104, 115,
+    98, 105, 100, 24, 64, 100, 102, 111, 114, 109, 100, 109, 111, 110, 111, 100,
+    104, 101, 97, 100, 24, 64, 163, 100, 98, 111, 100, 121, 130, 162, 100, 97,
+    116, 116, 114, 98, 111, 112, 98, 105, 100, 24, 26, 162, 100, 97, 116, 116,
+    114, 99, 114, 104, 115, 98, 105, 100, 24, 64, 100, 102, 111, 114, 109, 100,
+    109, 111, 110, 111, 100, 104, 101, 97, 100, 24, 64, 163, 100, 98, 111, 100,
+    121, 131, 161, 98, 105, 100, 1, 162, 100, 97, 116, 116, 114, 100, 101, 120,
+    112, 114, 98, 105, 100, 24, 52, 161, 98, 105, 100, 2, 100, 102, 111, 114,
+    109, 99, 115, 117, 98, 100, 104, 101, 97, 100, 24, 64, 163, 100, 98, 111,
+    100, 121, 129, 162, 100, 97, 116, 116, 114, 100, 110, 97, 109, 101, 98, 105,
+    100, 24, 42, 100, 102, 111, 114, 109, 99, 118, 97, 114, 100, 104, 101, 97,
+    100, 24, 64, 163, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114,
+    102, 115, 116, 114, 105, 110, 103, 98, 105, 100, 24, 40, 100, 102, 111, 114,
+    109, 101, 118, 97, 108, 117, 101, 100, 104, 101, 97, 100, 24, 64, 163, 100,
+    98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 102, 110, 117, 109, 98,
+    101, 114, 98, 105, 100, 24, 41, 100, 102, 111, 114, 109, 101, 118, 97, 108,
+    117, 101, 100, 104, 101, 97, 100, 24, 64, 163, 100, 98, 111, 100, 121, 129,
+    162, 100, 97, 116, 116, 114, 103, 98, 111, 111, 108, 101, 97, 110, 98, 105,
+    100, 24, 38, 100, 102, 111, 114, 109, 101, 118, 97, 108, 117, 101, 100, 104,
+    101, 97, 100, 24, 64, 163, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116,
+    116, 114, 103, 98, 111, 111, 108, 101, 97, 110, 98, 105, 100, 24, 39, 100,
+    102, 111, 114, 109, 101, 118, 97, 108, 117, 101, 100, 104, 101, 97, 100, 24,
+    64, 163, 100, 98, 111, 100, 121, 129, 162, 100, 97, 116, 116, 114, 100, 110,
+    117, 108, 108, 98, 105, 100, 24, 37, 100, 102, 111, 114, 109, 101, 118, 97,
+    108, 117, 101, 100, 104, 101, 97, 100, 24, 64, 103, 105, 103, 110, 111, 114,
+    101, 115, 129, 24, 43, 99, 108, 101, 120, 162, 104, 99, 111, 110, 116, 101,
+    120, 116, 115, 130, 100, 112, 108, 97, 121, 100, 106, 115, 111, 110, 101, 116,
+    101, 114, 109, 115, 152, 44, 161, 100, 110, 97, 109, 101, 101, 60, 69, 79,
+    70, 62, 161, 100, 110, 97, 109, 101, 100, 84, 95, 76, 80, 161, 100, 110,
+    97, 109, 101, 100, 84, 95, 82, 80, 161, 100, 110, 97, 109, 101, 100, 84,
+    95, 76, 73, 161, 100, 110, 97, 109, 101, 100, 84, 95, 82, 73, 161, 100,
+    110, 97, 109, 101, 100, 84, 95, 76, 83, 161, 100, 110, 97, 109, 101, 100,
+    84, 95, 82, 83, 161, 100, 110, 97, 109, 101, 103, 84, 95, 67, 79, 77,
+    77, 65, 161, 100, 110, 97, 109, 101, 102, 84, 95, 83, 69, 77, 73, 161,
+    100, 110, 97, 109, 101, 101, 84, 95, 68, 79, 84, 161, 100, 110, 97, 109,
+    101, 101, 84, 95, 65, 68, 68, 161, 100, 110, 97, 109, 101, 101, 84, 95,
+    83, 85, 66, 161, 100, 110, 97, 109, 101, 101, 84, 95, 77, 85, 76, 161,
+    100, 110, 97, 109, 101, 101, 84, 95, 68, 73, 86, 161, 100, 110, 97, 109,
+    101, 101, 84, 95, 77, 79, 76, 161, 100, 110, 97, 109, 101, 100, 84, 95,
+    76, 84, 161, 100, 110, 97, 109, 101, 100, 84, 95, 71, 84, 161, 100, 110,
+    97, 109, 101, 100, 84, 95, 76, 69, 161, 100, 110, 97, 109, 101, 100, 84,
+    95, 71, 69, 161, 100, 110, 97, 109, 101, 100, 84, 95, 69, 81, 161, 100,
+    110, 97, 109, 101, 100, 84, 95, 78, 69, 161, 100, 110, 97, 109, 101, 101,
+    84, 95, 65, 78, 68, 161, 100, 110, 97, 109, 101, 100, 84, 95, 79, 82,
+    161, 100, 110, 97, 109, 101, 101, 84, 95, 78, 79, 84, 161, 100, 110, 97,
+    109, 101, 104, 84, 95, 66, 73, 84, 65, 78, 68, 161, 100, 110, 97, 109,
+    101, 103, 84, 95, 66, 73, 84, 79, 82, 161, 100, 110, 97, 109, 101, 104,
+    84, 95, 66, 73, 84, 78, 79, 84, 161, 100, 110, 97, 109, 101, 104, 84,
+    95, 66, 73, 84, 88, 79, 82, 161, 100, 110, 97, 109, 101, 104, 84, 95,
+    65, 83, 83, 73, 71, 78, 161, 100, 110, 97, 109, 101, 101, 84, 95, 76,
+    69, 84, 161, 100, 110, 97, 109, 101, 100, 84, 95, 70, 78, 161, 100, 110,
+    97, 109, 101, 100, 84, 95, 73, 70, 161, 100, 110, 97, 109, 101, 102, 84,
+    95, 69, 76, 83, 69, 161, 100, 110, 97, 109, 101, 101, 84, 95, 70, 79,
+    82, 161, 100, 110, 97, 109, 101, 106, 84, 95, 67, 79, 78, 84, 73, 78,
+    85, 69, 161, 100, 110, 97, 109, 101, 103, 84, 95, 66, 82, 69, 65, 75,
+    161, 100, 110, 97, 109, 101, 104, 84, 95, 82, 69, 84, 85, 82, 78, 162,
+    103, 101, 110, 116, 114, 105, 101, 115, 129, 1, 100, 110, 97, 109, 101, 102,
+    84, 95, 78, 85, 76, 76, 162, 103, 101, 110, 116, 114, 105, 101, 115, 129,
+    1, 100, 110, 97, 109, 101, 102, 84, 95, 84, 82, 85, 69, 162, 103, 101,
+    110, 116, 114, 105, 101, 115, 129, 1, 100, 110, 97, 109, 101, 103, 84, 95,
+    70, 65, 76, 83, 69, 162, 103, 101, 110, 116, 114, 105, 101, 115, 129, 1,
+    100, 110, 97, 109, 101, 104, 84, 95, 83, 84, 82, 73, 78, 71, 161, 100,
+    110, 97, 109, 101, 104, 84, 95, 78, 85, 77, 66, 69, 82, 161, 100, 110,
+    97, 109, 101, 100, 84, 95, 73, 68, 161, 100, 110, 97, 109, 101, 103, 84,
+    95, 83, 80, 65, 67, 69, 101, 110, 116, 114, 109, 115, 149, 98, 83, 39,
+    100, 112, 108, 97, 121, 100, 115, 116, 109, 116, 103, 100, 101, 99, 108, 97,
+    114, 101, 102, 98, 114, 97, 110, 99, 104, 103, 105, 116, 101, 114, 97, 116,
+    101, 103, 99, 111, 110, 116, 114, 111, 108, 104, 102, 117, 110, 99, 116, 105,
+    111, 110, 106, 101, 120, 112, 114, 101, 115, 115, 105, 111, 110, 101, 98, 108,
+    111, 99, 107, 101, 115, 116, 109, 116, 115, 98, 105, 102, 103, 101, 108, 115,
+    101, 105, 102, 115, 100, 101, 108, 115, 101, 102, 101, 108, 115, 101, 105, 102,
+    102, 112, 97, 114, 97, 109, 115, 105, 112, 114, 105, 111, 114, 105, 116, 121,
+    52, 105, 112, 114, 105, 111, 114, 105, 116, 121, 51, 105, 112, 114, 105, 111,
+    114, 105, 116, 121, 50, 105, 112, 114, 105, 111, 114, 105, 116, 121, 49, 105,
+    112, 114, 105, 111, 114, 105, 116, 121, 48, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 2, 2, 2, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 4, 5, 1, 1, 6, 7, 1, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 1, 18, 19, 20, 21, 1,
+    1, 22, 22, 22, 22, 23, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 24, 25, 26, 27, 22,
+    1, 28, 29, 30, 22, 31, 32, 22, 22, 33, 22, 34, 35, 22, 36, 37,
+    22, 22, 38, 39, 40, 41, 22, 22, 22, 22, 22, 42, 43, 44, 45, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 3, 0, 0, 0,
+    4, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 7, 0, 0, 0,
+    8, 0, 0, 0, 9, 0, 0, 0, 10, 0, 0, 0, 11, 0, 0, 0,
+    12, 0, 0, 0, 13, 0, 0, 0, 14, 0, 0, 0, 15, 0, 0, 0,
+    16, 0, 0, 0, 17, 0, 0, 0, 18, 0, 0, 0, 19, 0, 0, 0,
+    20, 0, 0, 0, 21, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    23, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 25, 0, 0, 0,
+    22, 0, 0, 0, 26, 0, 0, 0, 27, 0, 0, 0, 28, 0, 0, 0,
+    87, 0, 0, 0, 30, 0, 0, 0, 22, 0, 0, 0, 31, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 33, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 35, 0, 0, 0, 36, 0, 0, 0,
+    37, 0, 0, 0, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 0, 0, 3, 0, 0, 0, 4, 0, 0, 0, 5, 0, 0, 0,
+    6, 0, 0, 0, 7, 0, 0, 0, 8, 0, 0, 0, 9, 0, 0, 0,
+    10, 0, 0, 0, 11, 0, 0, 0, 12, 0, 0, 0, 13, 0, 0, 0,
+    14, 0, 0, 0, 15, 0, 0, 0, 16, 0, 0, 0, 17, 0, 0, 0,
+    18, 0, 0, 0, 19, 0, 0, 0, 20, 0, 0, 0, 21, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 23, 0, 0, 0, 0, 0, 0, 0,
+    24, 0, 0, 0, 25, 0, 0, 0, 22, 0, 0, 0, 26, 0, 0, 0,
+    27, 0, 0, 0, 28, 0, 0, 0, 29, 0, 0, 0, 30, 0, 0, 0,
+    22, 0, 0, 0, 31, 0, 0, 0, 32, 0, 0, 0, 22, 0, 0, 0,
+    33, 0, 0, 0, 22, 0, 0, 0, 34, 0, 0, 0, 22, 0, 0, 0,
+    35, 0, 0, 0, 36, 0, 0, 0, 37, 0, 0, 0, 38, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 86, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0,
+    5, 0, 0, 0, 84, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0,
+    5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0,
+    5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0,
+    5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0,
+    5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0,
+    5, 0, 0, 0, 85, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0,
+    5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0,
+    5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0,
+    5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0,
+    5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0,
+    5, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    78, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 78, 0, 0, 0, 0, 0, 0, 0,
+    17, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    77, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 76, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    71, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 64, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 61, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    54, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    55, 0, 0, 0, 56, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 53, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 51, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 48, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 43, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    40, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 41, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 42, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    44, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 45, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 46, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 47, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 49, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 50, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    52, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 58, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    57, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 59, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 60, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 62, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 63, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 65, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    66, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 67, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    68, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 69, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 70, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 72, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 73, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 74, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 82, 0, 0, 0, 82, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 0, 0, 0,
+    0, 0, 0, 0, 80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    81, 0, 0, 0, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 81, 0, 0, 0, 81, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    81, 0, 0, 0, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 82, 0, 0, 0, 82, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0,
+    5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0,
+    5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0,
+    5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0,
+    5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0,
+    5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0,
+    5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0,
+    5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0,
+    5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0,
+    5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0,
+    5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0,
+    5, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    55, 0, 0, 0, 56, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 43, 0, 0, 0, 23, 0, 0, 0, 255, 255, 255, 255,
+    14, 0, 0, 0, 24, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0,
+    12, 0, 0, 0, 10, 0, 0, 0, 7, 0, 0, 0, 11, 0, 0, 0,
+    9, 0, 0, 0, 13, 0, 0, 0, 41, 0, 0, 0, 41, 0, 0, 0,
+    8, 0, 0, 0, 15, 0, 0, 0, 28, 0, 0, 0, 16, 0, 0, 0,
+    42, 0, 0, 0, 3, 0, 0, 0, 4, 0, 0, 0, 27, 0, 0, 0,
+    42, 0, 0, 0, 42, 0, 0, 0, 42, 0, 0, 0, 42, 0, 0, 0,
+    42, 0, 0, 0, 42, 0, 0, 0, 42, 0, 0, 0, 42, 0, 0, 0,
+    42, 0, 0, 0, 5, 0, 0, 0, 25, 0, 0, 0, 6, 0, 0, 0,
+    26, 0, 0, 0, 22, 0, 0, 0, 42, 0, 0, 0, 42, 0, 0, 0,
+    38, 0, 0, 0, 42, 0, 0, 0, 42, 0, 0, 0, 42, 0, 0, 0,
+    42, 0, 0, 0, 36, 0, 0, 0, 42, 0, 0, 0, 42, 0, 0, 0,
+    37, 0, 0, 0, 42, 0, 0, 0, 29, 0, 0, 0, 31, 0, 0, 0,
+    42, 0, 0, 0, 30, 0, 0, 0, 42, 0, 0, 0, 33, 0, 0, 0,
+    42, 0, 0, 0, 42, 0, 0, 0, 39, 0, 0, 0, 42, 0, 0, 0,
+    42, 0, 0, 0, 32, 0, 0, 0, 42, 0, 0, 0, 42, 0, 0, 0,
+    42, 0, 0, 0, 42, 0, 0, 0, 42, 0, 0, 0, 42, 0, 0, 0,
+    34, 0, 0, 0, 42, 0, 0, 0, 42, 0, 0, 0, 42, 0, 0, 0,
+    35, 0, 0, 0, 18, 0, 0, 0, 19, 0, 0, 0, 17, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 41, 0, 0, 0,
+    41, 0, 0, 0, 21, 0, 0, 0, 40, 0, 0, 0, 255, 255, 255, 255,
+    20, 0, 0, 0, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 6, 1, 9, 10, 11, 12, 13, 32,
+    0, 0, 0, 0, 0, 0, 0, 0, 255, 193, 255, 255, 254, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 10, 34, 92, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 4, 0, 0, 4, 0, 0, 0,
+    0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    42, 0, 0, 0, 201, 2, 0, 0, 253, 7, 0, 0, 18, 8, 0, 0,
+    39, 8, 0, 0, 32, 0, 0, 0, 69, 0, 0, 0, 3, 0, 0, 0,
+    6, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 53, 1, 0, 0,
+    1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0,
+    1, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0,
+    1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0,
+    1, 0, 0, 0, 17, 0, 0, 0, 167, 1, 0, 0, 46, 8, 0, 0,
+    242, 4, 0, 0, 96, 10, 0, 0, 5, 5, 0, 0, 1, 0, 0, 0,
+    72, 8, 0, 0, 93, 8, 0, 0, 114, 8, 0, 0, 1, 0, 0, 0,
+    1, 0, 0, 0, 1, 0, 0, 0, 74, 6, 0, 0, 106, 6, 0, 0,
+    138, 6, 0, 0, 28, 5, 0, 0, 51, 5, 0, 0, 74, 5, 0, 0,
+    66, 5, 0, 0, 99, 5, 0, 0, 115, 10, 0, 0, 134, 10, 0, 0,
+    31, 4, 0, 0, 73, 4, 0, 0, 166, 5, 0, 0, 139, 8, 0, 0,
+    35, 1, 0, 0, 12, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0,
+    1, 0, 0, 0, 1, 0, 0, 0, 84, 0, 0, 0, 20, 0, 0, 0,
+    1, 0, 0, 0, 207, 2, 0, 0, 249, 2, 0, 0, 147, 8, 0, 0,
+    168, 8, 0, 0, 189, 8, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0,
+    1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0,
+    26, 0, 0, 0, 98, 1, 0, 0, 168, 1, 0, 0, 139, 10, 0, 0,
+    171, 6, 0, 0, 1, 0, 0, 0, 222, 8, 0, 0, 243, 8, 0, 0,
+    8, 9, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0,
+    186, 6, 0, 0, 193, 6, 0, 0, 228, 6, 0, 0, 250, 6, 0, 0,
+    18, 7, 0, 0, 39, 7, 0, 0, 108, 5, 0, 0, 141, 5, 0, 0,
+    161, 10, 0, 0, 166, 10, 0, 0, 79, 4, 0, 0, 121, 4, 0, 0,
+    200, 1, 0, 0, 232, 1, 0, 0, 4, 0, 0, 0, 191, 3, 0, 0,
+    198, 1, 0, 0, 126, 0, 0, 0, 1, 0, 0, 0, 255, 2, 0, 0,
+    41, 9, 0, 0, 62, 9, 0, 0, 83, 9, 0, 0, 70, 0, 0, 0,
+    98, 0, 0, 0, 55, 0, 0, 0, 152, 0, 0, 0, 1, 0, 0, 0,
+    1, 0, 0, 0, 95, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0,
+    1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0,
+    1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0,
+    1, 0, 0, 0, 1, 0, 0, 0, 102, 1, 0, 0, 7, 0, 0, 0,
+    34, 2, 0, 0, 166, 1, 0, 0, 105, 5, 0, 0, 213, 4, 0, 0,
+    59, 1, 0, 0, 1, 0, 0, 0, 116, 9, 0, 0, 137, 9, 0, 0,
+    158, 9, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0,
+    33, 7, 0, 0, 67, 7, 0, 0, 75, 7, 0, 0, 185, 5, 0, 0,
+    208, 5, 0, 0, 231, 5, 0, 0, 223, 5, 0, 0, 0, 6, 0, 0,
+    80, 6, 0, 0, 112, 6, 0, 0, 127, 4, 0, 0, 169, 4, 0, 0,
+    147, 5, 0, 0, 6, 6, 0, 0, 58, 1, 0, 0, 91, 1, 0, 0,
+    1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0,
+    168, 0, 0, 0, 153, 0, 0, 0, 1, 0, 0, 0, 41, 3, 0, 0,
+    198, 0, 0, 0, 14, 0, 0, 0, 210, 0, 0, 0, 1, 0, 0, 0,
+    8, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    16, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 233, 3, 0, 0,
+    99, 8, 0, 0, 165, 1, 0, 0, 99, 1, 0, 0, 101, 1, 0, 0,
+    140, 0, 0, 0, 10, 0, 0, 0, 143, 1, 0, 0, 47, 3, 0, 0,
+    175, 1, 0, 0, 191, 9, 0, 0, 212, 9, 0, 0, 233, 9, 0, 0,
+    1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0,
+    1, 0, 0, 0, 1, 0, 0, 0, 101, 0, 0, 0, 11, 2, 0, 0,
+    48, 6, 0, 0, 144, 6, 0, 0, 132, 7, 0, 0, 1, 0, 0, 0,
+    10, 10, 0, 0, 31, 10, 0, 0, 52, 10, 0, 0, 1, 0, 0, 0,
+    1, 0, 0, 0, 1, 0, 0, 0, 110, 7, 0, 0, 154, 7, 0, 0,
+    160, 7, 0, 0, 217, 7, 0, 0, 238, 7, 0, 0, 3, 8, 0, 0,
+    9, 6, 0, 0, 42, 6, 0, 0, 198, 7, 0, 0, 78, 8, 0, 0,
+    175, 4, 0, 0, 217, 4, 0, 0, 154, 8, 0, 0, 214, 8, 0, 0,
+    207, 1, 0, 0, 239, 3, 0, 0, 41, 2, 0, 0, 15, 1, 0, 0,
+    240, 0, 0, 0, 45, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0,
+    1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 69, 1, 0, 0,
+    11, 1, 0, 0, 72, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0,
+    21, 1, 0, 0, 1, 0, 0, 0, 143, 0, 0, 0, 89, 3, 0, 0,
+    184, 0, 0, 0, 239, 1, 0, 0, 185, 0, 0, 0, 15, 2, 0, 0,
+    251, 1, 0, 0, 50, 1, 0, 0, 253, 1, 0, 0, 1, 0, 0, 0,
+    1, 0, 0, 0, 29, 2, 0, 0, 8, 2, 0, 0, 32, 2, 0, 0,
+    1, 0, 0, 0, 1, 0, 0, 0, 95, 3, 0, 0, 59, 2, 0, 0,
+    55, 2, 0, 0, 1, 0, 0, 0, 182, 0, 0, 0, 57, 0, 0, 0,
+    76, 2, 0, 0, 1, 0, 0, 0, 25, 0, 0, 0, 79, 2, 0, 0,
+    154, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0,
+    223, 1, 0, 0, 137, 3, 0, 0, 255, 1, 0, 0, 1, 0, 0, 0,
+    1, 0, 0, 0, 1, 0, 0, 0, 86, 2, 0, 0, 1, 0, 0, 0,
+    1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 108, 2, 0, 0,
+    1, 0, 0, 0, 90, 0, 0, 0, 1, 0, 0, 0, 25, 4, 0, 0,
+    249, 8, 0, 0, 252, 0, 0, 0, 1, 0, 0, 0, 58, 0, 0, 0,
+    121, 1, 0, 0, 57, 2, 0, 0, 135, 0, 0, 0, 63, 2, 0, 0,
+    105, 2, 0, 0, 226, 0, 0, 0, 111, 2, 0, 0, 88, 2, 0, 0,
+    128, 2, 0, 0, 106, 2, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0,
+    130, 2, 0, 0, 156, 2, 0, 0, 133, 2, 0, 0, 1, 0, 0, 0,
+    1, 0, 0, 0, 153, 2, 0, 0, 227, 0, 0, 0, 159, 2, 0, 0,
+    134, 2, 0, 0, 160, 2, 0, 0, 172, 2, 0, 0, 1, 0, 0, 0,
+    1, 0, 0, 0, 173, 2, 0, 0, 178, 2, 0, 0, 176, 2, 0, 0,
+    1, 0, 0, 0, 1, 0, 0, 0, 143, 3, 0, 0, 208, 2, 0, 0,
+    184, 2, 0, 0, 1, 0, 0, 0, 183, 0, 0, 0, 99, 0, 0, 0,
+    198, 2, 0, 0, 190, 1, 0, 0, 199, 2, 0, 0, 1, 0, 0, 0,
+    1, 0, 0, 0, 100, 0, 0, 0, 185, 3, 0, 0, 142, 0, 0, 0,
+    1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 226, 2, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 33, 0, 0, 0,
+    32, 0, 0, 0, 255, 255, 255, 255, 65, 0, 0, 0, 63, 0, 0, 0,
+    64, 0, 0, 0, 61, 0, 0, 0, 62, 0, 0, 0, 60, 0, 0, 0,
+    255, 255, 255, 255, 1, 0, 0, 0, 3, 0, 0, 0, 4, 0, 0, 0,
+    5, 0, 0, 0, 6, 0, 0, 0, 7, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 52, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 55, 0, 0, 0, 54, 0, 0, 0, 53, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    17, 0, 0, 0, 20, 0, 0, 0, 18, 0, 0, 0, 21, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 23, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    65, 0, 0, 0, 63, 0, 0, 0, 64, 0, 0, 0, 61, 0, 0, 0,
+    62, 0, 0, 0, 60, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 52, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 55, 0, 0, 0,
+    54, 0, 0, 0, 53, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    22, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 33, 0, 0, 0, 32, 0, 0, 0, 255, 255, 255, 255,
+    65, 0, 0, 0, 63, 0, 0, 0, 64, 0, 0, 0, 61, 0, 0, 0,
+    62, 0, 0, 0, 60, 0, 0, 0, 10, 0, 0, 0, 3, 0, 0, 0,
+    4, 0, 0, 0, 5, 0, 0, 0, 6, 0, 0, 0, 7, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 52, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 55, 0, 0, 0,
+    54, 0, 0, 0, 53, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 17, 0, 0, 0, 20, 0, 0, 0,
+    18, 0, 0, 0, 21, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    23, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 22, 0, 0, 0, 255, 255, 255, 255, 9, 0, 0, 0,
+    255, 255, 255, 255, 12, 0, 0, 0, 255, 255, 255, 255, 9, 0, 0, 0,
+    9, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 65, 0, 0, 0, 63, 0, 0, 0,
+    64, 0, 0, 0, 61, 0, 0, 0, 62, 0, 0, 0, 60, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 52, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 55, 0, 0, 0, 54, 0, 0, 0, 53, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    31, 0, 0, 0, 27, 0, 0, 0, 58, 0, 0, 0, 57, 0, 0, 0,
+    56, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    29, 0, 0, 0, 25, 0, 0, 0, 255, 255, 255, 255, 59, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 30, 0, 0, 0, 26, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 28, 0, 0, 0, 24, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 19, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 38, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 39, 0, 0, 0,
+    37, 0, 0, 0, 36, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 58, 0, 0, 0, 57, 0, 0, 0, 56, 0, 0, 0,
+    255, 255, 255, 255, 59, 0, 0, 0, 58, 0, 0, 0, 57, 0, 0, 0,
+    56, 0, 0, 0, 255, 255, 255, 255, 59, 0, 0, 0, 255, 255, 255, 255,
+    9, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    2, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    31, 0, 0, 0, 27, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 29, 0, 0, 0, 25, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 30, 0, 0, 0, 26, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 28, 0, 0, 0, 24, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 19, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 37, 0, 0, 0, 36, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 58, 0, 0, 0, 57, 0, 0, 0,
+    56, 0, 0, 0, 255, 255, 255, 255, 59, 0, 0, 0, 0, 0, 0, 0,
+    255, 255, 1, 0, 0, 0, 255, 255, 1, 0, 255, 255, 6, 0, 1, 0,
+    8, 0, 5, 0, 8, 0, 11, 0, 0, 0, 6, 0, 6, 0, 8, 0,
+    8, 0, 0, 0, 8, 0, 5, 0, 8, 0, 1, 0, 6, 0, 23, 0,
+    8, 0, 8, 0, 26, 0, 2, 0, 2, 0, 29, 0, 30, 0, 31, 0,
+    7, 0, 33, 0, 34, 0, 35, 0, 36, 0, 37, 0, 38, 0, 39, 0,
+    40, 0, 41, 0, 42, 0, 1, 0, 32, 0, 28, 0, 46, 0, 47, 0,
+    48, 0, 49, 0, 50, 0, 51, 0, 52, 0, 11, 0, 28, 0, 55, 0,
+    1, 0, 53, 0, 0, 0, 2, 0, 60, 0, 61, 0, 62, 0, 63, 0,
+    64, 0, 23, 0, 8, 0, 53, 0, 26, 0, 57, 0, 58, 0, 29, 0,
+    30, 0, 31, 0, 42, 0, 33, 0, 34, 0, 35, 0, 36, 0, 37, 0,
+    38, 0, 39, 0, 40, 0, 41, 0, 42, 0, 1, 0, 28, 0, 45, 0,
+    46, 0, 47, 0, 48, 0, 49, 0, 50, 0, 51, 0, 52, 0, 11, 0,
+    6, 0, 55, 0, 8, 0, 42, 0, 0, 0, 2, 0, 60, 0, 61, 0,
+    62, 0, 63, 0, 64, 0, 23, 0, 8, 0, 8, 0, 26, 0, 42, 0,
+    42, 0, 29, 0, 30, 0, 31, 0, 59, 0, 33, 0, 34, 0, 35, 0,
+    36, 0, 37, 0, 38, 0, 39, 0, 40, 0, 41, 0, 42, 0, 1, 0,
+    28, 0, 28, 0, 46, 0, 47, 0, 48, 0, 49, 0, 50, 0, 51, 0,
+    52, 0, 11, 0, 54, 0, 55, 0, 42, 0, 42, 0, 0, 0, 8, 0,
+    60, 0, 61, 0, 62, 0, 63, 0, 64, 0, 23, 0, 8, 0, 8, 0,
+    26, 0, 1, 0, 1, 0, 29, 0, 30, 0, 31, 0, 59, 0, 33, 0,
+    34, 0, 35, 0, 36, 0, 37, 0, 38, 0, 39, 0, 40, 0, 41, 0,
+    42, 0, 1, 0, 28, 0, 28, 0, 46, 0, 47, 0, 48, 0, 49, 0,
+    50, 0, 51, 0, 52, 0, 11, 0, 54, 0, 55, 0, 42, 0, 1, 0,
+    1, 0, 255, 255, 60, 0, 61, 0, 62, 0, 63, 0, 64, 0, 23, 0,
+    8, 0, 8, 0, 26, 0, 255, 255, 42, 0, 29, 0, 30, 0, 31, 0,
+    2, 0, 33, 0, 34, 0, 35, 0, 36, 0, 37, 0, 38, 0, 39, 0,
+    40, 0, 41, 0, 42, 0, 1, 0, 28, 0, 28, 0, 46, 0, 47, 0,
+    48, 0, 49, 0, 50, 0, 51, 0, 52, 0, 11, 0, 54, 0, 55, 0,
+    255, 255, 255, 255, 28, 0, 255, 255, 60, 0, 61, 0, 62, 0, 63, 0,
+    64, 0, 23, 0, 8, 0, 8, 0, 26, 0, 255, 255, 255, 255, 29, 0,
+    30, 0, 31, 0, 2, 0, 33, 0, 34, 0, 35, 0, 36, 0, 37, 0,
+    38, 0, 39, 0, 40, 0, 41, 0, 42, 0, 1, 0, 28, 0, 28, 0,
+    46, 0, 47, 0, 48, 0, 49, 0, 50, 0, 51, 0, 52, 0, 11, 0,
+    54, 0, 55, 0, 255, 255, 255, 255, 28, 0, 2, 0, 60, 0, 61, 0,
+    62, 0, 63, 0, 64, 0, 23, 0, 5, 0, 255, 255, 26, 0, 2, 0,
+    255, 255, 29, 0, 30, 0, 31, 0, 255, 255, 33, 0, 34, 0, 35, 0,
+    36, 0, 37, 0, 38, 0, 39, 0, 40, 0, 41, 0, 42, 0, 28, 0,
+    5, 0, 255, 255, 46, 0, 47, 0, 48, 0, 49, 0, 50, 0, 51, 0,
+    52, 0, 28, 0, 5, 0, 55, 0, 2, 0, 0, 0, 1, 0, 255, 255,
+    60, 0, 61, 0, 62, 0, 63, 0, 64, 0, 8, 0, 255, 255, 5, 0,
+    11, 0, 6, 0, 31, 0, 8, 0, 53, 0, 10, 0, 11, 0, 12, 0,
+    13, 0, 14, 0, 5, 0, 255, 255, 23, 0, 5, 0, 28, 0, 26, 0,
+    21, 0, 22, 0, 255, 255, 24, 0, 25, 0, 255, 255, 27, 0, 28, 0,
+    53, 0, 31, 0, 37, 0, 38, 0, 39, 0, 40, 0, 41, 0, 42, 0,
+    1, 0, 6, 0, 53, 0, 8, 0, 2, 0, 6, 0, 1, 0, 8, 0,
+    255, 255, 52, 0, 11, 0, 8, 0, 6, 0, 8, 0, 8, 0, 53, 0,
+    11, 0, 60, 0, 61, 0, 62, 0, 63, 0, 64, 0, 23, 0, 21, 0,
+    22, 0, 26, 0, 53, 0, 32, 0, 23, 0, 53, 0, 28, 0, 26, 0,
+    29, 0, 8, 0, 28, 0, 255, 255, 37, 0, 38, 0, 39, 0, 40, 0,
+    41, 0, 42, 0, 37, 0, 38, 0, 39, 0, 40, 0, 41, 0, 42, 0,
+    1, 0, 255, 255, 47, 0, 52, 0, 57, 0, 58, 0, 29, 0, 8, 0,
+    255, 255, 52, 0, 11, 0, 60, 0, 61, 0, 62, 0, 63, 0, 64, 0,
+    255, 255, 60, 0, 61, 0, 62, 0, 63, 0, 64, 0, 23, 0, 0, 0,
+    47, 0, 26, 0, 2, 0, 6, 0, 6, 0, 8, 0, 8, 0, 8, 0,
+    1, 0, 2, 0, 10, 0, 11, 0, 37, 0, 38, 0, 39, 0, 40, 0,
+    41, 0, 42, 0, 11, 0, 21, 0, 22, 0, 21, 0, 22, 0, 255, 255,
+    2, 0, 28, 0, 28, 0, 52, 0, 28, 0, 7, 0, 23, 0, 32, 0,
+    2, 0, 26, 0, 2, 0, 60, 0, 61, 0, 62, 0, 63, 0, 64, 0,
+    1, 0, 2, 0, 10, 0, 11, 0, 37, 0, 38, 0, 39, 0, 40, 0,
+    41, 0, 42, 0, 11, 0, 21, 0, 22, 0, 21, 0, 22, 0, 56, 0,
+    57, 0, 58, 0, 28, 0, 52, 0, 28, 0, 6, 0, 23, 0, 8, 0,
+    255, 255, 26, 0, 2, 0, 60, 0, 61, 0, 62, 0, 63, 0, 64, 0,
+    1, 0, 2, 0, 10, 0, 11, 0, 37, 0, 38, 0, 39, 0, 40, 0,
+    41, 0, 42, 0, 11, 0, 28, 0, 255, 255, 21, 0, 22, 0, 255, 255,
+    5, 0, 255, 255, 5, 0, 52, 0, 28, 0, 6, 0, 23, 0, 8, 0,
+    255, 255, 26, 0, 2, 0, 60, 0, 61, 0, 62, 0, 63, 0, 64, 0,
+    1, 0, 2, 0, 255, 255, 8, 0, 37, 0, 38, 0, 39, 0, 40, 0,
+    41, 0, 42, 0, 11, 0, 28, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    21, 0, 22, 0, 5, 0, 52, 0, 28, 0, 5, 0, 23, 0, 28, 0,
+    6, 0, 26, 0, 8, 0, 60, 0, 61, 0, 62, 0, 63, 0, 64, 0,
+    53, 0, 8, 0, 53, 0, 255, 255, 37, 0, 38, 0, 39, 0, 40, 0,
+    41, 0, 42, 0, 1, 0, 255, 255, 5, 0, 2, 0, 21, 0, 22, 0,
+    1, 0, 8, 0, 32, 0, 52, 0, 11, 0, 28, 0, 255, 255, 8, 0,
+    255, 255, 255, 255, 11, 0, 60, 0, 61, 0, 62, 0, 63, 0, 64, 0,
+    23, 0, 5, 0, 53, 0, 26, 0, 5, 0, 53, 0, 23, 0, 28, 0,
+    2, 0, 26, 0, 56, 0, 57, 0, 58, 0, 5, 0, 37, 0, 38, 0,
+    39, 0, 40, 0, 41, 0, 42, 0, 37, 0, 38, 0, 39, 0, 40, 0,
+    41, 0, 42, 0, 1, 0, 2, 0, 53, 0, 52, 0, 2, 0, 5, 0,
+    1, 0, 2, 0, 28, 0, 52, 0, 11, 0, 60, 0, 61, 0, 62, 0,
+    63, 0, 64, 0, 11, 0, 60, 0, 61, 0, 62, 0, 63, 0, 64, 0,
+    23, 0, 53, 0, 2, 0, 26, 0, 53, 0, 255, 255, 23, 0, 5, 0,
+    28, 0, 26, 0, 5, 0, 5, 0, 255, 255, 53, 0, 37, 0, 38, 0,
+    39, 0, 40, 0, 41, 0, 42, 0, 37, 0, 38, 0, 39, 0, 40, 0,
+    41, 0, 42, 0, 1, 0, 2, 0, 28, 0, 52, 0, 2, 0, 53, 0,
+    1, 0, 2, 0, 2, 0, 52, 0, 11, 0, 60, 0, 61, 0, 62, 0,
+    63, 0, 64, 0, 11, 0, 60, 0, 61, 0, 62, 0, 63, 0, 64, 0,
+    23, 0, 5, 0, 5, 0, 26, 0, 2, 0, 5, 0, 23, 0, 53, 0,
+    28, 0, 26, 0, 53, 0, 53, 0, 28, 0, 5, 0, 37, 0, 38, 0,
+    39, 0, 40, 0, 41, 0, 42, 0, 37, 0, 38, 0, 39, 0, 40, 0,
+    41, 0, 42, 0, 1, 0, 5, 0, 5, 0, 52, 0, 28, 0, 255, 255,
+    1, 0, 255, 255, 2, 0, 52, 0, 11, 0, 60, 0, 61, 0, 62, 0,
+    63, 0, 64, 0, 11, 0, 60, 0, 61, 0, 62, 0, 63, 0, 64, 0,
+    23, 0, 53, 0, 53, 0, 26, 0, 2, 0, 53, 0, 23, 0, 255, 255,
+    255, 255, 26, 0, 255, 255, 255, 255, 28, 0, 53, 0, 37, 0, 38, 0,
+    39, 0, 40, 0, 41, 0, 42, 0, 37, 0, 38, 0, 39, 0, 40, 0,
+    41, 0, 42, 0, 1, 0, 53, 0, 53, 0, 52, 0, 28, 0, 255, 255,
+    1, 0, 255, 255, 255, 255, 52, 0, 11, 0, 60, 0, 61, 0, 62, 0,
+    63, 0, 64, 0, 11, 0, 60, 0, 61, 0, 62, 0, 63, 0, 64, 0,
+    23, 0, 255, 255, 255, 255, 26, 0, 255, 255, 255, 255, 23, 0, 255, 255,
+    255, 255, 26, 0, 255, 255, 255, 255, 255, 255, 255, 255, 37, 0, 38, 0,
+    39, 0, 40, 0, 41, 0, 42, 0, 37, 0, 38, 0, 39, 0, 40, 0,
+    41, 0, 42, 0, 1, 0, 255, 255, 255, 255, 52, 0, 255, 255, 255, 255,
+    1, 0, 255, 255, 255, 255, 52, 0, 11, 0, 60, 0, 61, 0, 62, 0,
+    63, 0, 64, 0, 11, 0, 60, 0, 61, 0, 62, 0, 63, 0, 64, 0,
+    23, 0, 255, 255, 255, 255, 26, 0, 255, 255, 255, 255, 23, 0, 255, 255,
+    255, 255, 26, 0, 255, 255, 255, 255, 255, 255, 255, 255, 37, 0, 38, 0,
+    39, 0, 40, 0, 41, 0, 42, 0, 37, 0, 38, 0, 39, 0, 40, 0,
+    41, 0, 42, 0, 1, 0, 255, 255, 255, 255, 52, 0, 255, 255, 255, 255,
+    1, 0, 255, 255, 255, 255, 52, 0, 11, 0, 60, 0, 61, 0, 62, 0,
+    63, 0, 64, 0, 11, 0, 60, 0, 61, 0, 62, 0, 63, 0, 64, 0,
+    23, 0, 255, 255, 255, 255, 26, 0, 255, 255, 255, 255, 23, 0, 255, 255,
+    255, 255, 26, 0, 255, 255, 255, 255, 255, 255, 255, 255, 37, 0, 38, 0,
+    39, 0, 40, 0, 41, 0, 42, 0, 37, 0, 38, 0, 39, 0, 40, 0,
+    41, 0, 42, 0, 1, 0, 255, 255, 255, 255, 52, 0, 255, 255, 255, 255,
+    1, 0, 255, 255, 255, 255, 52, 0, 11, 0, 60, 0, 61, 0, 62, 0,
+    63, 0, 64, 0, 11, 0, 60, 0, 61, 0, 62, 0, 63, 0, 64, 0,
+    23, 0, 255, 255, 255, 255, 26, 0, 255, 255, 255, 255, 23, 0, 255, 255,
+    255, 255, 26, 0, 255, 255, 255, 255, 255, 255, 255, 255, 37, 0, 38, 0,
+    39, 0, 40, 0, 41, 0, 42, 0, 37, 0, 38, 0, 39, 0, 40, 0,
+    41, 0, 42, 0, 1, 0, 255, 255, 255, 255, 52, 0, 255, 255, 255, 255,
+    1, 0, 255, 255, 255, 255, 52, 0, 11, 0, 60, 0, 61, 0, 62, 0,
+    63, 0, 64, 0, 11, 0, 60, 0, 61, 0, 62, 0, 63, 0, 64, 0,
+    23, 0, 255, 255, 255, 255, 26, 0, 255, 255, 255, 255, 23, 0, 255, 255,
+    255, 255, 26, 0, 255, 255, 255, 255, 255, 255, 255, 255, 37, 0, 38, 0,
+    39, 0, 40, 0, 41, 0, 42, 0, 37, 0, 38, 0, 39, 0, 40, 0,
+    41, 0, 42, 0, 1, 0, 255, 255, 255, 255, 52, 0, 255, 255, 255, 255,
+    1, 0, 255, 255, 255, 255, 255, 255, 11, 0, 60, 0, 61, 0, 62, 0,
+    63, 0, 64, 0, 11, 0, 60, 0, 61, 0, 62, 0, 63, 0, 64, 0,
+    23, 0, 255, 255, 255, 255, 26, 0, 255, 255, 255, 255, 23, 0, 255, 255,
+    255, 255, 26, 0, 255, 255, 255, 255, 255, 255, 255, 255, 37, 0, 38, 0,
+    39, 0, 40, 0, 41, 0, 42, 0, 37, 0, 38, 0, 39, 0, 40, 0,
+    41, 0, 42, 0, 1, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    1, 0, 255, 255, 255, 255, 255, 255, 11, 0, 60, 0, 61, 0, 62, 0,
+    63, 0, 64, 0, 11, 0, 60, 0, 61, 0, 62, 0, 63, 0, 64, 0,
+    23, 0, 255, 255, 255, 255, 26, 0, 255, 255, 255, 255, 23, 0, 255, 255,
+    255, 255, 26, 0, 255, 255, 255, 255, 255, 255, 255, 255, 37, 0, 38, 0,
+    39, 0, 40, 0, 41, 0, 42, 0, 37, 0, 38, 0, 39, 0, 40, 0,
+    41, 0, 42, 0, 1, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    1, 0, 255, 255, 255, 255, 255, 255, 11, 0, 60, 0, 61, 0, 62, 0,
+    63, 0, 64, 0, 11, 0, 255, 255, 61, 0, 62, 0, 63, 0, 64, 0,
+    23, 0, 255, 255, 255, 255, 26, 0, 255, 255, 255, 255, 23, 0, 255, 255,
+    255, 255, 26, 0, 255, 255, 255, 255, 255, 255, 255, 255, 37, 0, 38, 0,
+    39, 0, 40, 0, 41, 0, 42, 0, 37, 0, 38, 0, 39, 0, 40, 0,
+    41, 0, 42, 0, 1, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    1, 0, 255, 255, 255, 255, 255, 255, 11, 0, 255, 255, 61, 0, 62, 0,
+    63, 0, 64, 0, 11, 0, 255, 255, 61, 0, 62, 0, 63, 0, 64, 0,
+    23, 0, 255, 255, 255, 255, 26, 0, 255, 255, 255, 255, 23, 0, 255, 255,
+    255, 255, 26, 0, 255, 255, 255, 255, 255, 255, 255, 255, 37, 0, 38, 0,
+    39, 0, 40, 0, 41, 0, 42, 0, 37, 0, 38, 0, 39, 0, 40, 0,
+    41, 0, 42, 0, 1, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    1, 0, 255, 255, 255, 255, 255, 255, 11, 0, 255, 255, 61, 0, 62, 0,
+    63, 0, 64, 0, 11, 0, 255, 255, 61, 0, 62, 0, 63, 0, 64, 0,
+    23, 0, 255, 255, 255, 255, 26, 0, 255, 255, 255, 255, 23, 0, 255, 255,
+    255, 255, 26, 0, 255, 255, 255, 255, 255, 255, 255, 255, 37, 0, 38, 0,
+    39, 0, 40, 0, 41, 0, 42, 0, 37, 0, 38, 0, 39, 0, 40, 0,
+    41, 0, 42, 0, 1, 0, 6, 0, 255, 255, 8, 0, 255, 255, 10, 0,
+    11, 0, 12, 0, 13, 0, 14, 0, 11, 0, 255, 255, 61, 0, 62, 0,
+    63, 0, 64, 0, 21, 0, 22, 0, 61, 0, 62, 0, 63, 0, 64, 0,
+    23, 0, 28, 0, 0, 0, 26, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 8, 0, 255, 255, 10, 0, 11, 0, 37, 0, 38, 0,
+    39, 0, 40, 0, 41, 0, 42, 0, 255, 255, 0, 0, 255, 255, 21, 0,
+    22, 0, 255, 255, 255, 255, 255, 255, 255, 255, 8, 0, 28, 0, 10, 0,
+    11, 0, 12, 0, 13, 0, 14, 0, 255, 255, 255, 255, 61, 0, 62, 0,
+    63, 0, 64, 0, 21, 0, 22, 0, 0, 0, 24, 0, 25, 0, 255, 255,
+    27, 0, 28, 0, 255, 255, 255, 255, 8, 0, 255, 255, 10, 0, 11, 0,
+    12, 0, 13, 0, 14, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 21, 0, 22, 0, 0, 0, 24, 0, 25, 0, 255, 255, 27, 0,
+    28, 0, 255, 255, 255, 255, 8, 0, 255, 255, 10, 0, 11, 0, 12, 0,
+    13, 0, 14, 0, 255, 255, 1, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    21, 0, 22, 0, 0, 0, 24, 0, 25, 0, 11, 0, 27, 0, 28, 0,
+    255, 255, 255, 255, 8, 0, 255, 255, 10, 0, 11, 0, 12, 0, 13, 0,
+    14, 0, 23, 0, 255, 255, 255, 255, 26, 0, 255, 255, 255, 255, 21, 0,
+    22, 0, 255, 255, 24, 0, 25, 0, 1, 0, 27, 0, 28, 0, 37, 0,
+    38, 0, 39, 0, 40, 0, 41, 0, 42, 0, 1, 0, 11, 0, 6, 0,
+    255, 255, 8, 0, 255, 255, 10, 0, 11, 0, 255, 255, 255, 255, 11, 0,
+    255, 255, 255, 255, 23, 0, 255, 255, 255, 255, 26, 0, 21, 0, 22, 0,
+    62, 0, 63, 0, 64, 0, 23, 0, 255, 255, 28, 0, 26, 0, 255, 255,
+    37, 0, 38, 0, 39, 0, 40, 0, 41, 0, 42, 0, 1, 0, 255, 255,
+    255, 255, 37, 0, 38, 0, 39, 0, 40, 0, 41, 0, 42, 0, 255, 255,
+    11, 0, 6, 0, 255, 255, 8, 0, 255, 255, 10, 0, 11, 0, 255, 255,
+    255, 255, 62, 0, 63, 0, 64, 0, 23, 0, 255, 255, 0, 0, 26, 0,
+    21, 0, 22, 0, 62, 0, 63, 0, 64, 0, 255, 255, 8, 0, 28, 0,
+    10, 0, 11, 0, 37, 0, 38, 0, 39, 0, 40, 0, 41, 0, 42, 0,
+    255, 255, 255, 255, 255, 255, 21, 0, 22, 0, 255, 255, 255, 255, 6, 0,
+    255, 255, 8, 0, 28, 0, 10, 0, 11, 0, 12, 0, 13, 0, 14, 0,
+    255, 255, 255, 255, 255, 255, 62, 0, 63, 0, 64, 0, 21, 0, 22, 0,
+    255, 255, 24, 0, 25, 0, 255, 255, 27, 0, 28, 0, 6, 0, 255, 255,
+    8, 0, 255, 255, 10, 0, 11, 0, 12, 0, 13, 0, 14, 0, 255, 255,
+    1, 0, 255, 255, 255, 255, 255, 255, 255, 255, 21, 0, 22, 0, 255, 255,
+    24, 0, 25, 0, 11, 0, 27, 0, 28, 0, 6, 0, 255, 255, 8, 0,
+    255, 255, 10, 0, 11, 0, 12, 0, 13, 0, 14, 0, 23, 0, 255, 255,
+    255, 255, 26, 0, 255, 255, 255, 255, 21, 0, 22, 0, 255, 255, 24, 0,
+    25, 0, 1, 0, 27, 0, 28, 0, 37, 0, 38, 0, 39, 0, 40, 0,
+    41, 0, 42, 0, 1, 0, 11, 0, 6, 0, 255, 255, 8, 0, 255, 255,
+    10, 0, 11, 0, 255, 255, 255, 255, 11, 0, 255, 255, 255, 255, 23, 0,
+    255, 255, 255, 255, 26, 0, 21, 0, 22, 0, 62, 0, 63, 0, 64, 0,
+    23, 0, 255, 255, 28, 0, 26, 0, 255, 255, 37, 0, 38, 0, 39, 0,
+    40, 0, 41, 0, 42, 0, 1, 0, 255, 255, 255, 255, 37, 0, 38, 0,
+    39, 0, 40, 0, 41, 0, 42, 0, 255, 255, 11, 0, 255, 255, 255, 255,
+    8, 0, 255, 255, 10, 0, 11, 0, 255, 255, 255, 255, 62, 0, 63, 0,
+    64, 0, 23, 0, 255, 255, 255, 255, 26, 0, 21, 0, 22, 0, 62, 0,
+    63, 0, 64, 0, 255, 255, 1, 0, 28, 0, 255, 255, 255, 255, 37, 0,
+    38, 0, 39, 0, 40, 0, 41, 0, 42, 0, 11, 0, 6, 0, 255, 255,
+    8, 0, 255, 255, 10, 0, 11, 0, 12, 0, 13, 0, 14, 0, 255, 255,
+    255, 255, 23, 0, 255, 255, 255, 255, 26, 0, 21, 0, 22, 0, 255, 255,
+    62, 0, 63, 0, 64, 0, 1, 0, 28, 0, 255, 255, 255, 255, 37, 0,
+    38, 0, 39, 0, 40, 0, 41, 0, 42, 0, 11, 0, 6, 0, 255, 255,
+    8, 0, 255, 255, 10, 0, 11, 0, 12, 0, 13, 0, 14, 0, 255, 255,
+    255, 255, 23, 0, 255, 255, 255, 255, 26, 0, 21, 0, 22, 0, 255, 255,
+    255, 255, 63, 0, 64, 0, 1, 0, 28, 0, 255, 255, 255, 255, 37, 0,
+    38, 0, 39, 0, 40, 0, 41, 0, 42, 0, 11, 0, 255, 255, 255, 255,
+    8, 0, 255, 255, 10, 0, 11, 0, 12, 0, 13, 0, 14, 0, 255, 255,
+    255, 255, 23, 0, 255, 255, 255, 255, 26, 0, 21, 0, 22, 0, 255, 255,
+    255, 255, 63, 0, 64, 0, 255, 255, 28, 0, 2, 0, 255, 255, 37, 0,
+    38, 0, 39, 0, 40, 0, 41, 0, 42, 0, 10, 0, 11, 0, 12, 0,
+    13, 0, 14, 0, 255, 255, 1, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    21, 0, 22, 0, 1, 0, 24, 0, 25, 0, 11, 0, 27, 0, 28, 0,
+    255, 255, 63, 0, 64, 0, 255, 255, 11, 0, 255, 255, 255, 255, 255, 255,
+    255, 255, 23, 0, 255, 255, 255, 255, 26, 0, 255, 255, 255, 255, 255, 255,
+    23, 0, 255, 255, 255, 255, 26, 0, 255, 255, 255, 255, 255, 255, 37, 0,
+    38, 0, 39, 0, 40, 0, 41, 0, 42, 0, 1, 0, 37, 0, 38, 0,
+    39, 0, 40, 0, 41, 0, 42, 0, 255, 255, 255, 255, 255, 255, 11, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 63, 0, 64, 0, 23, 0, 2, 0, 255, 255, 26, 0, 255, 255,
+    63, 0, 64, 0, 255, 255, 255, 255, 10, 0, 11, 0, 12, 0, 13, 0,
+    14, 0, 37, 0, 38, 0, 39, 0, 40, 0, 41, 0, 42, 0, 21, 0,
+    22, 0, 255, 255, 24, 0, 25, 0, 2, 0, 27, 0, 28, 0, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 10, 0, 11, 0, 12, 0, 13, 0,
+    14, 0, 255, 255, 1, 0, 63, 0, 64, 0, 255, 255, 255, 255, 21, 0,
+    22, 0, 2, 0, 24, 0, 25, 0, 11, 0, 27, 0, 28, 0, 255, 255,
+    255, 255, 10, 0, 11, 0, 12, 0, 13, 0, 14, 0, 255, 255, 255, 255,
+    23, 0, 255, 255, 255, 255, 26, 0, 21, 0, 22, 0, 255, 255, 24, 0,
+    25, 0, 255, 255, 27, 0, 28, 0, 1, 0, 255, 255, 37, 0, 38, 0,
+    39, 0, 40, 0, 41, 0, 42, 0, 1, 0, 255, 255, 11, 0, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 11, 0, 255, 255,
+    255, 255, 255, 255, 23, 0, 255, 255, 255, 255, 26, 0, 255, 255, 255, 255,
+    63, 0, 64, 0, 23, 0, 255, 255, 255, 255, 26, 0, 255, 255, 255, 255,
+    37, 0, 38, 0, 39, 0, 40, 0, 41, 0, 42, 0, 255, 255, 1, 0,
+    37, 0, 38, 0, 39, 0, 40, 0, 41, 0, 42, 0, 255, 255, 255, 255,
+    255, 255, 11, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 63, 0, 64, 0, 255, 255, 23, 0, 255, 255, 255, 255,
+    26, 0, 255, 255, 63, 0, 64, 0, 8, 0, 255, 255, 10, 0, 11, 0,
+    12, 0, 13, 0, 14, 0, 37, 0, 38, 0, 39, 0, 40, 0, 41, 0,
+    42, 0, 21, 0, 22, 0, 1, 0, 24, 0, 25, 0, 255, 255, 27, 0,
+    28, 0, 1, 0, 255, 255, 255, 255, 255, 255, 11, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 11, 0, 255, 255, 63, 0, 64, 0, 255, 255,
+    255, 255, 23, 0, 255, 255, 255, 255, 26, 0, 255, 255, 255, 255, 23, 0,
+    255, 255, 255, 255, 26, 0, 255, 255, 255, 255, 255, 255, 255, 255, 37, 0,
+    38, 0, 39, 0, 40, 0, 41, 0, 42, 0, 37, 0, 38, 0, 39, 0,
+    40, 0, 41, 0, 42, 0, 255, 255, 255, 255, 255, 255, 8, 0, 255, 255,
+    10, 0, 11, 0, 12, 0, 13, 0, 14, 0, 255, 255, 255, 255, 255, 255,
+    255, 255, 63, 0, 64, 0, 21, 0, 22, 0, 255, 255, 255, 255, 63, 0,
+    64, 0, 8, 0, 28, 0, 10, 0, 11, 0, 12, 0, 13, 0, 14, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 21, 0, 22, 0,
+    255, 255, 24, 0, 25, 0, 255, 255, 27, 0, 28, 0, 8, 0, 255, 255,
+    10, 0, 11, 0, 12, 0, 13, 0, 14, 0, 255, 255, 1, 0, 255, 255,
+    255, 255, 255, 255, 255, 255, 21, 0, 22, 0, 255, 255, 24, 0, 25, 0,
+    11, 0, 27, 0, 28, 0, 8, 0, 255, 255, 10, 0, 11, 0, 12, 0,
+    13, 0, 14, 0, 255, 255, 1, 0, 23, 0, 255, 255, 255, 255, 26, 0,
+    21, 0, 22, 0, 255, 255, 24, 0, 25, 0, 11, 0, 27, 0, 28, 0,
+    255, 255, 255, 255, 37, 0, 38, 0, 39, 0, 40, 0, 41, 0, 42, 0,
+    1, 0, 23, 0, 255, 255, 255, 255, 26, 0, 255, 255, 0, 0, 255, 255,
+    255, 255, 255, 255, 11, 0, 255, 255, 255, 255, 255, 255, 8, 0, 37, 0,
+    38, 0, 39, 0, 40, 0, 41, 0, 42, 0, 64, 0, 23, 0, 255, 255,
+    255, 255, 26, 0, 255, 255, 21, 0, 22, 0, 255, 255, 255, 255, 255, 255,
+    255, 255, 1, 0, 28, 0, 255, 255, 37, 0, 38, 0, 39, 0, 40, 0,
+    41, 0, 42, 0, 64, 0, 11, 0, 255, 255, 255, 255, 8, 0, 255, 255,
+    10, 0, 11, 0, 12, 0, 13, 0, 14, 0, 255, 255, 1, 0, 23, 0,
+    255, 255, 255, 255, 26, 0, 21, 0, 22, 0, 255, 255, 255, 255, 64, 0,
+    11, 0, 6, 0, 28, 0, 8, 0, 255, 255, 37, 0, 38, 0, 39, 0,
+    40, 0, 41, 0, 42, 0, 1, 0, 23, 0, 255, 255, 255, 255, 26, 0,
+    21, 0, 22, 0, 255, 255, 255, 255, 255, 255, 11, 0, 255, 255, 28, 0,
+    255, 255, 255, 255, 37, 0, 38, 0, 39, 0, 40, 0, 41, 0, 42, 0,
+    64, 0, 23, 0, 255, 255, 0, 0, 26, 0, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 8, 0, 1, 0, 10, 0, 11, 0, 37, 0,
+    38, 0, 39, 0, 40, 0, 41, 0, 42, 0, 64, 0, 11, 0, 255, 255,
+    21, 0, 22, 0, 8, 0, 255, 255, 10, 0, 11, 0, 255, 255, 28, 0,
+    255, 255, 1, 0, 23, 0, 255, 255, 255, 255, 26, 0, 255, 255, 21, 0,
+    22, 0, 255, 255, 64, 0, 11, 0, 255, 255, 255, 255, 28, 0, 255, 255,
+    37, 0, 38, 0, 39, 0, 40, 0, 41, 0, 42, 0, 1, 0, 23, 0,
+    255, 255, 255, 255, 26, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    11, 0, 255, 255, 255, 255, 255, 255, 255, 255, 37, 0, 38, 0, 39, 0,
+    40, 0, 41, 0, 42, 0, 64, 0, 23, 0, 255, 255, 255, 255, 26, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 8, 0, 1, 0,
+    10, 0, 11, 0, 37, 0, 38, 0, 39, 0, 40, 0, 41, 0, 42, 0,
+    64, 0, 11, 0, 255, 255, 21, 0, 22, 0, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 28, 0, 255, 255, 1, 0, 23, 0, 255, 255, 255, 255,
+    26, 0, 0, 0, 255, 255, 255, 255, 255, 255, 64, 0, 11, 0, 255, 255,
+    255, 255, 8, 0, 255, 255, 37, 0, 38, 0, 39, 0, 40, 0, 41, 0,
+    42, 0, 1, 0, 23, 0, 255, 255, 255, 255, 26, 0, 21, 0, 22, 0,
+    255, 255, 255, 255, 255, 255, 11, 0, 255, 255, 28, 0, 255, 255, 255, 255,
+    37, 0, 38, 0, 39, 0, 40, 0, 41, 0, 42, 0, 64, 0, 23, 0,
+    255, 255, 255, 255, 26, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 1, 0, 255, 255, 255, 255, 37, 0, 38, 0, 39, 0,
+    40, 0, 41, 0, 42, 0, 64, 0, 11, 0, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 0,
+    23, 0, 255, 255, 255, 255, 26, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    64, 0, 11, 0, 255, 255, 255, 255, 255, 255, 255, 255, 37, 0, 38, 0,
+    39, 0, 40, 0, 41, 0, 42, 0, 1, 0, 23, 0, 255, 255, 255, 255,
+    26, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 11, 0, 255, 255,
+    255, 255, 255, 255, 255, 255, 37, 0, 38, 0, 39, 0, 40, 0, 41, 0,
+    42, 0, 64, 0, 23, 0, 255, 255, 255, 255, 26, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 0, 255, 255, 255, 255,
+    37, 0, 38, 0, 39, 0, 40, 0, 41, 0, 42, 0, 64, 0, 11, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 1, 0, 23, 0, 255, 255, 255, 255, 26, 0, 255, 255,
+    255, 255, 255, 255, 255, 255, 64, 0, 11, 0, 255, 255, 255, 255, 255, 255,
+    255, 255, 37, 0, 38, 0, 39, 0, 40, 0, 41, 0, 42, 0, 1, 0,
+    23, 0, 255, 255, 255, 255, 26, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 11, 0, 255, 255, 255, 255, 255, 255, 255, 255, 37, 0, 38, 0,
+    39, 0, 40, 0, 41, 0, 42, 0, 64, 0, 23, 0, 255, 255, 255, 255,
+    26, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    1, 0, 255, 255, 255, 255, 37, 0, 38, 0, 39, 0, 40, 0, 41, 0,
+    42, 0, 64, 0, 11, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 0, 23, 0, 255, 255,
+    255, 255, 26, 0, 255, 255, 255, 255, 255, 255, 255, 255, 64, 0, 11, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 37, 0, 38, 0, 39, 0, 40, 0,
+    41, 0, 42, 0, 1, 0, 23, 0, 255, 255, 255, 255, 26, 0, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 11, 0, 255, 255, 255, 255, 255, 255,
+    255, 255, 37, 0, 38, 0, 39, 0, 40, 0, 41, 0, 42, 0, 64, 0,
+    23, 0, 255, 255, 255, 255, 26, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 1, 0, 255, 255, 255, 255, 37, 0, 38, 0,
+    39, 0, 40, 0, 41, 0, 42, 0, 64, 0, 11, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    1, 0, 23, 0, 255, 255, 255, 255, 26, 0, 255, 255, 255, 255, 255, 255,
+    255, 255, 64, 0, 11, 0, 255, 255, 255, 255, 255, 255, 255, 255, 37, 0,
+    38, 0, 39, 0, 40, 0, 41, 0, 42, 0, 1, 0, 23, 0, 255, 255,
+    255, 255, 26, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 11, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 37, 0, 38, 0, 39, 0, 40, 0,
+    41, 0, 42, 0, 64, 0, 23, 0, 255, 255, 255, 255, 26, 0, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 37, 0, 38, 0, 39, 0, 40, 0, 41, 0, 42, 0, 64, 0,
+    0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    8, 0, 255, 255, 10, 0, 11, 0, 12, 0, 13, 0, 14, 0, 255, 255,
+    255, 255, 255, 255, 255, 255, 0, 0, 64, 0, 21, 0, 22, 0, 255, 255,
+    255, 255, 255, 255, 255, 255, 8, 0, 28, 0, 10, 0, 11, 0, 12, 0,
+    13, 0, 14, 0, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 255, 255,
+    21, 0, 22, 0, 255, 255, 255, 255, 255, 255, 2, 0, 8, 0, 28, 0,
+    10, 0, 11, 0, 12, 0, 13, 0, 14, 0, 10, 0, 11, 0, 12, 0,
+    13, 0, 14, 0, 255, 255, 21, 0, 22, 0, 255, 255, 255, 255, 255, 255,
+    21, 0, 22, 0, 28, 0, 2, 0, 255, 255, 255, 255, 255, 255, 28, 0,
+    2, 0, 255, 255, 255, 255, 10, 0, 11, 0, 12, 0, 13, 0, 14, 0,
+    10, 0, 11, 0, 12, 0, 13, 0, 14, 0, 255, 255, 21, 0, 22, 0,
+    255, 255, 255, 255, 255, 255, 21, 0, 22, 0, 28, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 28, 0, 0, 0, 255, 255, 255, 255, 103, 0, 0, 0,
+    0, 0, 0, 128, 255, 255, 255, 255, 62, 1, 0, 0, 255, 255, 255, 255,
+    11, 0, 0, 128, 32, 1, 0, 0, 11, 0, 0, 128, 101, 0, 0, 0,
+    29, 1, 0, 0, 104, 0, 0, 0, 16, 0, 0, 128, 174, 0, 0, 0,
+    169, 0, 0, 0, 170, 0, 0, 0, 170, 0, 0, 0, 8, 0, 0, 128,
+    182, 0, 0, 0, 166, 0, 0, 0, 16, 0, 0, 128, 61, 0, 0, 0,
+    173, 0, 0, 0, 105, 0, 0, 0, 170, 0, 0, 0, 8, 0, 0, 128,
+    106, 0, 0, 0, 7, 1, 0, 0, 98, 0, 0, 0, 107, 0, 0, 0,
+    108, 0, 0, 0, 109, 0, 0, 0, 8, 1, 0, 0, 110, 0, 0, 0,
+    111, 0, 0, 0, 112, 0, 0, 0, 113, 0, 0, 0, 114, 0, 0, 0,
+    115, 0, 0, 0, 116, 0, 0, 0, 117, 0, 0, 0, 118, 0, 0, 0,
+    119, 0, 0, 0, 1, 0, 0, 0, 52, 0, 0, 0, 27, 1, 0, 0,
+    171, 0, 0, 0, 121, 0, 0, 0, 122, 0, 0, 0, 123, 0, 0, 0,
+    124, 0, 0, 0, 125, 0, 0, 0, 126, 0, 0, 0, 2, 0, 0, 0,
+    99, 0, 0, 0, 128, 0, 0, 0, 254, 0, 0, 0, 102, 0, 0, 0,
+    35, 0, 0, 128, 4, 1, 0, 0, 129, 0, 0, 0, 130, 0, 0, 0,
+    131, 0, 0, 0, 132, 0, 0, 0, 133, 0, 0, 0, 3, 0, 0, 0,
+    35, 0, 0, 128, 167, 0, 0, 0, 4, 0, 0, 0, 56, 0, 0, 0,
+    57, 0, 0, 0, 5, 0, 0, 0, 6, 0, 0, 0, 7, 0, 0, 0,
+    73, 1, 0, 0, 8, 0, 0, 0, 9, 0, 0, 0, 10, 0, 0, 0,
+    11, 0, 0, 0, 12, 0, 0, 0, 13, 0, 0, 0, 14, 0, 0, 0,
+    15, 0, 0, 0, 16, 0, 0, 0, 17, 0, 0, 0, 103, 0, 0, 0,
+    27, 1, 0, 0, 18, 0, 0, 0, 19, 0, 0, 0, 20, 0, 0, 0,
+    21, 0, 0, 0, 22, 0, 0, 0, 23, 0, 0, 0, 24, 0, 0, 0,
+    25, 0, 0, 0, 104, 0, 0, 0, 26, 1, 0, 0, 26, 0, 0, 0,
+    170, 0, 0, 0, 5, 1, 0, 0, 13, 0, 0, 128, 68, 1, 0, 0,
+    27, 0, 0, 0, 28, 0, 0, 0, 29, 0, 0, 0, 30, 0, 0, 0,
+    31, 0, 0, 0, 105, 0, 0, 0, 13, 0, 0, 128, 220, 0, 0, 0,
+    106, 0, 0, 0, 66, 1, 0, 0, 12, 1, 0, 0, 107, 0, 0, 0,
+    108, 0, 0, 0, 109, 0, 0, 0, 6, 1, 0, 0, 110, 0, 0, 0,
+    111, 0, 0, 0, 112, 0, 0, 0, 113, 0, 0, 0, 114, 0, 0, 0,
+    115, 0, 0, 0, 116, 0, 0, 0, 117, 0, 0, 0, 118, 0, 0, 0,
+    119, 0, 0, 0, 103, 0, 0, 0, 74, 1, 0, 0, 221, 0, 0, 0,
+    120, 0, 0, 0, 121, 0, 0, 0, 122, 0, 0, 0, 123, 0, 0, 0,
+    124, 0, 0, 0, 125, 0, 0, 0, 126, 0, 0, 0, 104, 0, 0, 0,
+    25, 1, 0, 0, 128, 0, 0, 0, 2, 1, 0, 0, 5, 1, 0, 0,
+    14, 0, 0, 128, 35, 1, 0, 0, 129, 0, 0, 0, 130, 0, 0, 0,
+    131, 0, 0, 0, 132, 0, 0, 0, 133, 0, 0, 0, 105, 0, 0, 0,
+    14, 0, 0, 128, 13, 0, 0, 128, 106, 0, 0, 0, 178, 0, 0, 0,
+    163, 0, 0, 0, 107, 0, 0, 0, 108, 0, 0, 0, 109, 0, 0, 0,
+    69, 1, 0, 0, 110, 0, 0, 0, 111, 0, 0, 0, 112, 0, 0, 0,
+    113, 0, 0, 0, 114, 0, 0, 0, 115, 0, 0, 0, 116, 0, 0, 0,
+    117, 0, 0, 0, 118, 0, 0, 0, 119, 0, 0, 0, 103, 0, 0, 0,
+    27, 1, 0, 0, 239, 0, 0, 0, 120, 0, 0, 0, 121, 0, 0, 0,
+    122, 0, 0, 0, 123, 0, 0, 0, 124, 0, 0, 0, 125, 0, 0, 0,
+    126, 0, 0, 0, 104, 0, 0, 0, 127, 0, 0, 0, 128, 0, 0, 0,
+    238, 0, 0, 0, 3, 1, 0, 0, 67, 1, 0, 0, 255, 255, 255, 255,
+    129, 0, 0, 0, 130, 0, 0, 0, 131, 0, 0, 0, 132, 0, 0, 0,
+    133, 0, 0, 0, 105, 0, 0, 0, 14, 0, 0, 128, 243, 0, 0, 0,
+    106, 0, 0, 0, 255, 255, 255, 255, 9, 1, 0, 0, 107, 0, 0, 0,
+    108, 0, 0, 0, 109, 0, 0, 0, 165, 0, 0, 0, 110, 0, 0, 0,
+    111, 0, 0, 0, 112, 0, 0, 0, 113, 0, 0, 0, 114, 0, 0, 0,
+    115, 0, 0, 0, 116, 0, 0, 0, 117, 0, 0, 0, 118, 0, 0, 0,
+    119, 0, 0, 0, 103, 0, 0, 0, 221, 0, 0, 0, 221, 0, 0, 0,
+    120, 0, 0, 0, 121, 0, 0, 0, 122, 0, 0, 0, 123, 0, 0, 0,
+    124, 0, 0, 0, 125, 0, 0, 0, 126, 0, 0, 0, 104, 0, 0, 0,
+    172, 0, 0, 0, 128, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    99, 0, 0, 0, 255, 255, 255, 255, 129, 0, 0, 0, 130, 0, 0, 0,
+    131, 0, 0, 0, 132, 0, 0, 0, 133, 0, 0, 0, 105, 0, 0, 0,
+    38, 1, 0, 0, 51, 1, 0, 0, 106, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 107, 0, 0, 0, 108, 0, 0, 0, 109, 0, 0, 0,
+    225, 0, 0, 0, 110, 0, 0, 0, 111, 0, 0, 0, 112, 0, 0, 0,
+    113, 0, 0, 0, 114, 0, 0, 0, 115, 0, 0, 0, 116, 0, 0, 0,
+    117, 0, 0, 0, 118, 0, 0, 0, 119, 0, 0, 0, 1, 0, 0, 0,
+    221, 0, 0, 0, 221, 0, 0, 0, 120, 0, 0, 0, 121, 0, 0, 0,
+    122, 0, 0, 0, 123, 0, 0, 0, 124, 0, 0, 0, 125, 0, 0, 0,
+    126, 0, 0, 0, 2, 0, 0, 0, 168, 0, 0, 0, 128, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 99, 0, 0, 0, 233, 0, 0, 0,
+    129, 0, 0, 0, 130, 0, 0, 0, 131, 0, 0, 0, 132, 0, 0, 0,
+    133, 0, 0, 0, 3, 0, 0, 0, 160, 0, 0, 0, 255, 255, 255, 255,
+    4, 0, 0, 0, 237, 0, 0, 0, 255, 255, 255, 255, 5, 0, 0, 0,
+    6, 0, 0, 0, 7, 0, 0, 0, 255, 255, 255, 255, 8, 0, 0, 0,
+    9, 0, 0, 0, 10, 0, 0, 0, 11, 0, 0, 0, 12, 0, 0, 0,
+    13, 0, 0, 0, 14, 0, 0, 0, 15, 0, 0, 0, 16, 0, 0, 0,
+    17, 0, 0, 0, 99, 0, 0, 0, 58, 0, 0, 0, 255, 255, 255, 255,
+    30, 1, 0, 0, 20, 0, 0, 0, 21, 0, 0, 0, 22, 0, 0, 0,
+    23, 0, 0, 0, 24, 0, 0, 0, 25, 0, 0, 0, 99, 0, 0, 0,
+    160, 0, 0, 0, 26, 0, 0, 0, 246, 0, 0, 0, 34, 0, 0, 128,
+    1, 0, 0, 0, 255, 255, 255, 255, 27, 0, 0, 0, 28, 0, 0, 0,
+    29, 0, 0, 0, 30, 0, 0, 0, 31, 0, 0, 0, 34, 0, 0, 128,
+    255, 255, 255, 255, 160, 0, 0, 0, 2, 0, 0, 0, 48, 0, 0, 128,
+    59, 0, 0, 0, 48, 0, 0, 128, 227, 0, 0, 0, 48, 0, 0, 128,
+    48, 0, 0, 128, 48, 0, 0, 128, 48, 0, 0, 128, 48, 0, 0, 128,
+    160, 0, 0, 0, 255, 255, 255, 255, 3, 0, 0, 0, 160, 0, 0, 0,
+    99, 0, 0, 0, 4, 0, 0, 0, 48, 0, 0, 128, 48, 0, 0, 128,
+    255, 255, 255, 255, 134, 0, 0, 0, 135, 0, 0, 0, 255, 255, 255, 255,
+    136, 0, 0, 0, 48, 0, 0, 128, 60, 0, 0, 0, 161, 0, 0, 0,
+    12, 0, 0, 0, 13, 0, 0, 0, 14, 0, 0, 0, 15, 0, 0, 0,
+    16, 0, 0, 0, 17, 0, 0, 0, 103, 0, 0, 0, 16, 0, 0, 128,
+    226, 0, 0, 0, 16, 0, 0, 128, 40, 0, 0, 128, 34, 0, 0, 128,
+    183, 0, 0, 0, 34, 0, 0, 128, 255, 255, 255, 255, 31, 1, 0, 0,
+    104, 0, 0, 0, 179, 0, 0, 0, 8, 0, 0, 128, 241, 0, 0, 0,
+    8, 0, 0, 128, 162, 0, 0, 0, 185, 0, 0, 0, 27, 0, 0, 0,
+    28, 0, 0, 0, 29, 0, 0, 0, 30, 0, 0, 0, 31, 0, 0, 0,
+    105, 0, 0, 0, 94, 0, 0, 0, 95, 0, 0, 0, 106, 0, 0, 0,
+    235, 0, 0, 0, 154, 0, 0, 0, 186, 0, 0, 0, 234, 0, 0, 0,
+    40, 0, 0, 128, 187, 0, 0, 0, 180, 0, 0, 0, 33, 1, 0, 0,
+    175, 0, 0, 0, 255, 255, 255, 255, 114, 0, 0, 0, 115, 0, 0, 0,
+    116, 0, 0, 0, 117, 0, 0, 0, 118, 0, 0, 0, 119, 0, 0, 0,
+    188, 0, 0, 0, 189, 0, 0, 0, 190, 0, 0, 0, 191, 0, 0, 0,
+    192, 0, 0, 0, 193, 0, 0, 0, 183, 0, 0, 0, 255, 255, 255, 255,
+    181, 0, 0, 0, 177, 0, 0, 0, 158, 0, 0, 0, 159, 0, 0, 0,
+    180, 0, 0, 0, 184, 0, 0, 0, 255, 255, 255, 255, 242, 0, 0, 0,
+    185, 0, 0, 0, 129, 0, 0, 0, 130, 0, 0, 0, 131, 0, 0, 0,
+    132, 0, 0, 0, 133, 0, 0, 0, 255, 255, 255, 255, 195, 0, 0, 0,
+    196, 0, 0, 0, 197, 0, 0, 0, 198, 0, 0, 0, 199, 0, 0, 0,
+    186, 0, 0, 0, 15, 0, 0, 128, 34, 1, 0, 0, 187, 0, 0, 0,
+    42, 0, 0, 128, 35, 0, 0, 128, 40, 0, 0, 128, 35, 0, 0, 128,
+    40, 0, 0, 128, 15, 0, 0, 128, 62, 0, 0, 0, 231, 0, 0, 0,
+    90, 0, 0, 0, 91, 0, 0, 0, 188, 0, 0, 0, 189, 0, 0, 0,
+    190, 0, 0, 0, 191, 0, 0, 0, 192, 0, 0, 0, 193, 0, 0, 0,
+    63, 0, 0, 0, 150, 0, 0, 0, 151, 0, 0, 0, 42, 0, 0, 128,
+    42, 0, 0, 128, 255, 255, 255, 255, 70, 1, 0, 0, 175, 0, 0, 0,
+    40, 0, 0, 128, 194, 0, 0, 0, 42, 0, 0, 128, 8, 1, 0, 0,
+    64, 0, 0, 0, 52, 0, 0, 0, 41, 0, 0, 128, 65, 0, 0, 0,
+    44, 0, 0, 128, 195, 0, 0, 0, 196, 0, 0, 0, 197, 0, 0, 0,
+    198, 0, 0, 0, 199, 0, 0, 0, 62, 0, 0, 0, 223, 0, 0, 0,
+    90, 0, 0, 0, 91, 0, 0, 0, 66, 0, 0, 0, 67, 0, 0, 0,
+    68, 0, 0, 0, 69, 0, 0, 0, 70, 0, 0, 0, 71, 0, 0, 0,
+    63, 0, 0, 0, 94, 0, 0, 0, 95, 0, 0, 0, 44, 0, 0, 128,
+    44, 0, 0, 128, 53, 0, 0, 0, 54, 0, 0, 0, 55, 0, 0, 0,
+    41, 0, 0, 128, 232, 0, 0, 0, 44, 0, 0, 128, 13, 0, 0, 128,
+    64, 0, 0, 0, 13, 0, 0, 128, 255, 255, 255, 255, 65, 0, 0, 0,
+    43, 0, 0, 128, 73, 0, 0, 0, 74, 0, 0, 0, 75, 0, 0, 0,
+    76, 0, 0, 0, 77, 0, 0, 0, 62, 0, 0, 0, 249, 0, 0, 0,
+    90, 0, 0, 0, 91, 0, 0, 0, 66, 0, 0, 0, 67, 0, 0, 0,
+    68, 0, 0, 0, 69, 0, 0, 0, 70, 0, 0, 0, 71, 0, 0, 0,
+    63, 0, 0, 0, 13, 1, 0, 0, 255, 255, 255, 255, 43, 0, 0, 128,
+    43, 0, 0, 128, 255, 255, 255, 255, 160, 0, 0, 0, 255, 255, 255, 255,
+    160, 0, 0, 0, 224, 0, 0, 0, 43, 0, 0, 128, 14, 0, 0, 128,
+    64, 0, 0, 0, 14, 0, 0, 128, 255, 255, 255, 255, 65, 0, 0, 0,
+    251, 0, 0, 0, 73, 0, 0, 0, 74, 0, 0, 0, 75, 0, 0, 0,
+    76, 0, 0, 0, 77, 0, 0, 0, 62, 0, 0, 0, 244, 0, 0, 0,
+    255, 255, 255, 255, 40, 0, 0, 128, 66, 0, 0, 0, 67, 0, 0, 0,
+    68, 0, 0, 0, 69, 0, 0, 0, 70, 0, 0, 0, 71, 0, 0, 0,
+    63, 0, 0, 0, 175, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 216, 0, 0, 0, 217, 0, 0, 0,
+    160, 0, 0, 0, 250, 0, 0, 0, 99, 0, 0, 0, 160, 0, 0, 0,
+    64, 0, 0, 0, 40, 0, 0, 128, 15, 0, 0, 128, 65, 0, 0, 0,
+    15, 0, 0, 128, 73, 0, 0, 0, 74, 0, 0, 0, 75, 0, 0, 0,
+    76, 0, 0, 0, 77, 0, 0, 0, 248, 0, 0, 0, 41, 0, 0, 128,
+    247, 0, 0, 0, 255, 255, 255, 255, 66, 0, 0, 0, 67, 0, 0, 0,
+    68, 0, 0, 0, 69, 0, 0, 0, 70, 0, 0, 0, 71, 0, 0, 0,
+    183, 0, 0, 0, 255, 255, 255, 255, 166, 0, 0, 0, 0, 1, 0, 0,
+    216, 0, 0, 0, 217, 0, 0, 0, 183, 0, 0, 0, 49, 1, 0, 0,
+    154, 0, 0, 0, 245, 0, 0, 0, 185, 0, 0, 0, 41, 0, 0, 128,
+    255, 255, 255, 255, 36, 1, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    185, 0, 0, 0, 73, 0, 0, 0, 74, 0, 0, 0, 75, 0, 0, 0,
+    76, 0, 0, 0, 77, 0, 0, 0, 186, 0, 0, 0, 160, 0, 0, 0,
+    253, 0, 0, 0, 187, 0, 0, 0, 160, 0, 0, 0, 252, 0, 0, 0,
+    186, 0, 0, 0, 99, 0, 0, 0, 19, 1, 0, 0, 187, 0, 0, 0,
+    155, 0, 0, 0, 156, 0, 0, 0, 157, 0, 0, 0, 58, 0, 0, 0,
+    188, 0, 0, 0, 189, 0, 0, 0, 190, 0, 0, 0, 191, 0, 0, 0,
+    192, 0, 0, 0, 193, 0, 0, 0, 188, 0, 0, 0, 189, 0, 0, 0,
+    190, 0, 0, 0, 191, 0, 0, 0, 192, 0, 0, 0, 193, 0, 0, 0,
+    62, 0, 0, 0, 44, 1, 0, 0, 1, 1, 0, 0, 50, 1, 0, 0,
+    24, 1, 0, 0, 58, 0, 0, 0, 62, 0, 0, 0, 39, 1, 0, 0,
+    99, 0, 0, 0, 37, 1, 0, 0, 63, 0, 0, 0, 195, 0, 0, 0,
+    196, 0, 0, 0, 197, 0, 0, 0, 198, 0, 0, 0, 199, 0, 0, 0,
+    63, 0, 0, 0, 195, 0, 0, 0, 196, 0, 0, 0, 197, 0, 0, 0,
+    198, 0, 0, 0, 199, 0, 0, 0, 64, 0, 0, 0, 11, 1, 0, 0,
+    41, 1, 0, 0, 65, 0, 0, 0, 10, 1, 0, 0, 255, 255, 255, 255,
+    64, 0, 0, 0, 58, 0, 0, 0, 99, 0, 0, 0, 65, 0, 0, 0,
+    58, 0, 0, 0, 58, 0, 0, 0, 255, 255, 255, 255, 43, 1, 0, 0,
+    66, 0, 0, 0, 67, 0, 0, 0, 68, 0, 0, 0, 69, 0, 0, 0,
+    70, 0, 0, 0, 71, 0, 0, 0, 66, 0, 0, 0, 67, 0, 0, 0,
+    68, 0, 0, 0, 69, 0, 0, 0, 70, 0, 0, 0, 71, 0, 0, 0,
+    62, 0, 0, 0, 57, 1, 0, 0, 99, 0, 0, 0, 45, 1, 0, 0,
+    46, 1, 0, 0, 42, 1, 0, 0, 62, 0, 0, 0, 52, 1, 0, 0,
+    54, 1, 0, 0, 40, 1, 0, 0, 63, 0, 0, 0, 73, 0, 0, 0,
+    74, 0, 0, 0, 75, 0, 0, 0, 76, 0, 0, 0, 77, 0, 0, 0,
+    63, 0, 0, 0, 73, 0, 0, 0, 74, 0, 0, 0, 75, 0, 0, 0,
+    76, 0, 0, 0, 77, 0, 0, 0, 64, 0, 0, 0, 58, 0, 0, 0,
+    58, 0, 0, 0, 65, 0, 0, 0, 59, 1, 0, 0, 58, 0, 0, 0,
+    64, 0, 0, 0, 48, 1, 0, 0, 99, 0, 0, 0, 65, 0, 0, 0,
+    47, 1, 0, 0, 56, 1, 0, 0, 99, 0, 0, 0, 101, 0, 0, 0,
+    66, 0, 0, 0, 67, 0, 0, 0, 68, 0, 0, 0, 69, 0, 0, 0,
+    70, 0, 0, 0, 71, 0, 0, 0, 66, 0, 0, 0, 67, 0, 0, 0,
+    68, 0, 0, 0, 69, 0, 0, 0, 70, 0, 0, 0, 71, 0, 0, 0,
+    62, 0, 0, 0, 58, 0, 0, 0, 58, 0, 0, 0, 58, 1, 0, 0,
+    99, 0, 0, 0, 255, 255, 255, 255, 62, 0, 0, 0, 255, 255, 255, 255,
+    64, 1, 0, 0, 53, 1, 0, 0, 63, 0, 0, 0, 73, 0, 0, 0,
+    74, 0, 0, 0, 75, 0, 0, 0, 76, 0, 0, 0, 77, 0, 0, 0,
+    63, 0, 0, 0, 73, 0, 0, 0, 74, 0, 0, 0, 75, 0, 0, 0,
+    76, 0, 0, 0, 77, 0, 0, 0, 64, 0, 0, 0, 55, 1, 0, 0,
+    61, 1, 0, 0, 65, 0, 0, 0, 80, 1, 0, 0, 60, 1, 0, 0,
+    64, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 65, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 99, 0, 0, 0, 65, 1, 0, 0,
+    66, 0, 0, 0, 67, 0, 0, 0, 68, 0, 0, 0, 69, 0, 0, 0,
+    70, 0, 0, 0, 71, 0, 0, 0, 66, 0, 0, 0, 67, 0, 0, 0,
+    68, 0, 0, 0, 69, 0, 0, 0, 70, 0, 0, 0, 71, 0, 0, 0,
+    62, 0, 0, 0, 72, 1, 0, 0, 71, 1, 0, 0, 79, 1, 0, 0,
+    99, 0, 0, 0, 255, 255, 255, 255, 62, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 72, 0, 0, 0, 63, 0, 0, 0, 73, 0, 0, 0,
+    74, 0, 0, 0, 75, 0, 0, 0, 76, 0, 0, 0, 77, 0, 0, 0,
+    63, 0, 0, 0, 73, 0, 0, 0, 74, 0, 0, 0, 75, 0, 0, 0,
+    76, 0, 0, 0, 77, 0, 0, 0, 64, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 65, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    64, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 65, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    66, 0, 0, 0, 67, 0, 0, 0, 68, 0, 0, 0, 69, 0, 0, 0,
+    70, 0, 0, 0, 71, 0, 0, 0, 66, 0, 0, 0, 67, 0, 0, 0,
+    68, 0, 0, 0, 69, 0, 0, 0, 70, 0, 0, 0, 71, 0, 0, 0,
+    62, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 23, 1, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 62, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 18, 1, 0, 0, 63, 0, 0, 0, 73, 0, 0, 0,
+    74, 0, 0, 0, 75, 0, 0, 0, 76, 0, 0, 0, 77, 0, 0, 0,
+    63, 0, 0, 0, 73, 0, 0, 0, 74, 0, 0, 0, 75, 0, 0, 0,
+    76, 0, 0, 0, 77, 0, 0, 0, 64, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 65, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    64, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 65, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    66, 0, 0, 0, 67, 0, 0, 0, 68, 0, 0, 0, 69, 0, 0, 0,
+    70, 0, 0, 0, 71, 0, 0, 0, 66, 0, 0, 0, 67, 0, 0, 0,
+    68, 0, 0, 0, 69, 0, 0, 0, 70, 0, 0, 0, 71, 0, 0, 0,
+    183, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 164, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 62, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 236, 0, 0, 0, 185, 0, 0, 0, 73, 0, 0, 0,
+    74, 0, 0, 0, 75, 0, 0, 0, 76, 0, 0, 0, 77, 0, 0, 0,
+    63, 0, 0, 0, 73, 0, 0, 0, 74, 0, 0, 0, 75, 0, 0, 0,
+    76, 0, 0, 0, 77, 0, 0, 0, 186, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 187, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    64, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 65, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    188, 0, 0, 0, 189, 0, 0, 0, 190, 0, 0, 0, 191, 0, 0, 0,
+    192, 0, 0, 0, 193, 0, 0, 0, 66, 0, 0, 0, 67, 0, 0, 0,
+    68, 0, 0, 0, 69, 0, 0, 0, 70, 0, 0, 0, 71, 0, 0, 0,
+    103, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 240, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 62, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 0, 0, 0, 104, 0, 0, 0, 195, 0, 0, 0,
+    196, 0, 0, 0, 197, 0, 0, 0, 198, 0, 0, 0, 199, 0, 0, 0,
+    63, 0, 0, 0, 73, 0, 0, 0, 74, 0, 0, 0, 75, 0, 0, 0,
+    76, 0, 0, 0, 77, 0, 0, 0, 105, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 106, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    64, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 65, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    114, 0, 0, 0, 115, 0, 0, 0, 116, 0, 0, 0, 117, 0, 0, 0,
+    118, 0, 0, 0, 119, 0, 0, 0, 66, 0, 0, 0, 67, 0, 0, 0,
+    68, 0, 0, 0, 69, 0, 0, 0, 70, 0, 0, 0, 71, 0, 0, 0,
+    1, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 14, 1, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 62, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 63, 1, 0, 0, 2, 0, 0, 0, 129, 0, 0, 0,
+    130, 0, 0, 0, 131, 0, 0, 0, 132, 0, 0, 0, 133, 0, 0, 0,
+    63, 0, 0, 0, 73, 0, 0, 0, 74, 0, 0, 0, 75, 0, 0, 0,
+    76, 0, 0, 0, 77, 0, 0, 0, 3, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 4, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    64, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 65, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    12, 0, 0, 0, 13, 0, 0, 0, 14, 0, 0, 0, 15, 0, 0, 0,
+    16, 0, 0, 0, 17, 0, 0, 0, 66, 0, 0, 0, 67, 0, 0, 0,
+    68, 0, 0, 0, 69, 0, 0, 0, 70, 0, 0, 0, 71, 0, 0, 0,
+    103, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 75, 1, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 183, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 104, 0, 0, 0, 27, 0, 0, 0,
+    28, 0, 0, 0, 29, 0, 0, 0, 30, 0, 0, 0, 31, 0, 0, 0,
+    185, 0, 0, 0, 100, 0, 0, 0, 74, 0, 0, 0, 75, 0, 0, 0,
+    76, 0, 0, 0, 77, 0, 0, 0, 105, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 106, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    186, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 187, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    114, 0, 0, 0, 115, 0, 0, 0, 116, 0, 0, 0, 117, 0, 0, 0,
+    118, 0, 0, 0, 119, 0, 0, 0, 188, 0, 0, 0, 189, 0, 0, 0,
+    190, 0, 0, 0, 191, 0, 0, 0, 192, 0, 0, 0, 193, 0, 0, 0,
+    1, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 1, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 2, 0, 0, 0, 176, 0, 0, 0,
+    130, 0, 0, 0, 131, 0, 0, 0, 132, 0, 0, 0, 133, 0, 0, 0,
+    2, 0, 0, 0, 222, 0, 0, 0, 196, 0, 0, 0, 197, 0, 0, 0,
+    198, 0, 0, 0, 199, 0, 0, 0, 3, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 4, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    3, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 4, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    12, 0, 0, 0, 13, 0, 0, 0, 14, 0, 0, 0, 15, 0, 0, 0,
+    16, 0, 0, 0, 17, 0, 0, 0, 12, 0, 0, 0, 13, 0, 0, 0,
+    14, 0, 0, 0, 15, 0, 0, 0, 16, 0, 0, 0, 17, 0, 0, 0,
+    1, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 62, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 2, 0, 0, 0, 28, 1, 0, 0,
+    28, 0, 0, 0, 29, 0, 0, 0, 30, 0, 0, 0, 31, 0, 0, 0,
+    63, 0, 0, 0, 255, 255, 255, 255, 51, 0, 0, 0, 29, 0, 0, 0,
+    30, 0, 0, 0, 31, 0, 0, 0, 3, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 4, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    64, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 65, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    12, 0, 0, 0, 13, 0, 0, 0, 14, 0, 0, 0, 15, 0, 0, 0,
+    16, 0, 0, 0, 17, 0, 0, 0, 66, 0, 0, 0, 67, 0, 0, 0,
+    68, 0, 0, 0, 69, 0, 0, 0, 70, 0, 0, 0, 71, 0, 0, 0,
+    62, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 103, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 63, 0, 0, 0, 255, 255, 255, 255,
+    50, 0, 0, 0, 29, 0, 0, 0, 30, 0, 0, 0, 31, 0, 0, 0,
+    104, 0, 0, 0, 255, 255, 255, 255, 97, 0, 0, 0, 75, 0, 0, 0,
+    76, 0, 0, 0, 77, 0, 0, 0, 64, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 65, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    105, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 106, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    66, 0, 0, 0, 67, 0, 0, 0, 68, 0, 0, 0, 69, 0, 0, 0,
+    70, 0, 0, 0, 71, 0, 0, 0, 114, 0, 0, 0, 115, 0, 0, 0,
+    116, 0, 0, 0, 117, 0, 0, 0, 118, 0, 0, 0, 119, 0, 0, 0,
+    103, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 183, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 104, 0, 0, 0, 255, 255, 255, 255,
+    96, 0, 0, 0, 75, 0, 0, 0, 76, 0, 0, 0, 77, 0, 0, 0,
+    185, 0, 0, 0, 255, 255, 255, 255, 153, 0, 0, 0, 131, 0, 0, 0,
+    132, 0, 0, 0, 133, 0, 0, 0, 105, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 106, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    186, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 187, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    114, 0, 0, 0, 115, 0, 0, 0, 116, 0, 0, 0, 117, 0, 0, 0,
+    118, 0, 0, 0, 119, 0, 0, 0, 188, 0, 0, 0, 189, 0, 0, 0,
+    190, 0, 0, 0, 191, 0, 0, 0, 192, 0, 0, 0, 193, 0, 0, 0,
+    183, 0, 0, 0, 45, 0, 0, 128, 255, 255, 255, 255, 45, 0, 0, 128,
+    255, 255, 255, 255, 45, 0, 0, 128, 45, 0, 0, 128, 140, 0, 0, 0,
+    141, 0, 0, 0, 142, 0, 0, 0, 185, 0, 0, 0, 255, 255, 255, 255,
+    152, 0, 0, 0, 131, 0, 0, 0, 132, 0, 0, 0, 133, 0, 0, 0,
+    45, 0, 0, 128, 45, 0, 0, 128, 219, 0, 0, 0, 197, 0, 0, 0,
+    198, 0, 0, 0, 199, 0, 0, 0, 186, 0, 0, 0, 45, 0, 0, 128,
+    42, 0, 0, 128, 187, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    42, 0, 0, 128, 255, 255, 255, 255, 44, 0, 0, 0, 45, 0, 0, 0,
+    188, 0, 0, 0, 189, 0, 0, 0, 190, 0, 0, 0, 191, 0, 0, 0,
+    192, 0, 0, 0, 193, 0, 0, 0, 255, 255, 255, 255, 48, 0, 0, 128,
+    255, 255, 255, 255, 42, 0, 0, 128, 42, 0, 0, 128, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 0, 128,
+    42, 0, 0, 128, 48, 0, 0, 128, 48, 0, 0, 128, 48, 0, 0, 128,
+    48, 0, 0, 128, 48, 0, 0, 128, 255, 255, 255, 255, 255, 255, 255, 255,
+    218, 0, 0, 0, 197, 0, 0, 0, 198, 0, 0, 0, 199, 0, 0, 0,
+    48, 0, 0, 128, 48, 0, 0, 128, 51, 0, 0, 128, 32, 0, 0, 0,
+    33, 0, 0, 0, 255, 255, 255, 255, 34, 0, 0, 0, 48, 0, 0, 128,
+    255, 255, 255, 255, 255, 255, 255, 255, 51, 0, 0, 128, 255, 255, 255, 255,
+    51, 0, 0, 128, 51, 0, 0, 128, 51, 0, 0, 128, 51, 0, 0, 128,
+    51, 0, 0, 128, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 51, 0, 0, 128,
+    51, 0, 0, 128, 50, 0, 0, 128, 32, 0, 0, 0, 33, 0, 0, 0,
+    255, 255, 255, 255, 34, 0, 0, 0, 51, 0, 0, 128, 255, 255, 255, 255,
+    255, 255, 255, 255, 50, 0, 0, 128, 255, 255, 255, 255, 50, 0, 0, 128,
+    50, 0, 0, 128, 50, 0, 0, 128, 50, 0, 0, 128, 50, 0, 0, 128,
+    255, 255, 255, 255, 1, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 50, 0, 0, 128, 50, 0, 0, 128,
+    49, 0, 0, 128, 32, 0, 0, 0, 33, 0, 0, 0, 2, 0, 0, 0,
+    34, 0, 0, 0, 50, 0, 0, 128, 255, 255, 255, 255, 255, 255, 255, 255,
+    49, 0, 0, 128, 255, 255, 255, 255, 49, 0, 0, 128, 49, 0, 0, 128,
+    49, 0, 0, 128, 49, 0, 0, 128, 49, 0, 0, 128, 3, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 4, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 49, 0, 0, 128, 49, 0, 0, 128, 255, 255, 255, 255,
+    32, 0, 0, 0, 33, 0, 0, 0, 1, 0, 0, 0, 34, 0, 0, 0,
+    49, 0, 0, 128, 12, 0, 0, 0, 13, 0, 0, 0, 14, 0, 0, 0,
+    15, 0, 0, 0, 16, 0, 0, 0, 17, 0, 0, 0, 62, 0, 0, 0,
+    2, 0, 0, 0, 42, 0, 0, 128, 255, 255, 255, 255, 42, 0, 0, 128,
+    255, 255, 255, 255, 146, 0, 0, 0, 147, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 63, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    3, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 4, 0, 0, 0,
+    42, 0, 0, 128, 42, 0, 0, 128, 47, 0, 0, 0, 30, 0, 0, 0,
+    31, 0, 0, 0, 64, 0, 0, 0, 255, 255, 255, 255, 42, 0, 0, 128,
+    65, 0, 0, 0, 255, 255, 255, 255, 12, 0, 0, 0, 13, 0, 0, 0,
+    14, 0, 0, 0, 15, 0, 0, 0, 16, 0, 0, 0, 17, 0, 0, 0,
+    62, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 66, 0, 0, 0,
+    67, 0, 0, 0, 68, 0, 0, 0, 69, 0, 0, 0, 70, 0, 0, 0,
+    71, 0, 0, 0, 255, 255, 255, 255, 63, 0, 0, 0, 44, 0, 0, 128,
+    255, 255, 255, 255, 44, 0, 0, 128, 255, 255, 255, 255, 146, 0, 0, 0,
+    147, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 46, 0, 0, 0,
+    30, 0, 0, 0, 31, 0, 0, 0, 64, 0, 0, 0, 255, 255, 255, 255,
+    44, 0, 0, 128, 65, 0, 0, 0, 44, 0, 0, 128, 44, 0, 0, 128,
+    93, 0, 0, 0, 76, 0, 0, 0, 77, 0, 0, 0, 255, 255, 255, 255,
+    44, 0, 0, 128, 44, 0, 0, 128, 44, 0, 0, 0, 45, 0, 0, 0,
+    66, 0, 0, 0, 67, 0, 0, 0, 68, 0, 0, 0, 69, 0, 0, 0,
+    70, 0, 0, 0, 71, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 44, 0, 0, 128, 44, 0, 0, 128, 255, 255, 255, 255,
+    255, 255, 255, 255, 51, 0, 0, 128, 255, 255, 255, 255, 51, 0, 0, 128,
+    44, 0, 0, 128, 51, 0, 0, 128, 51, 0, 0, 128, 51, 0, 0, 128,
+    51, 0, 0, 128, 51, 0, 0, 128, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 92, 0, 0, 0, 76, 0, 0, 0, 77, 0, 0, 0,
+    51, 0, 0, 128, 51, 0, 0, 128, 255, 255, 255, 255, 134, 0, 0, 0,
+    135, 0, 0, 0, 255, 255, 255, 255, 136, 0, 0, 0, 51, 0, 0, 128,
+    50, 0, 0, 128, 255, 255, 255, 255, 50, 0, 0, 128, 255, 255, 255, 255,
+    50, 0, 0, 128, 50, 0, 0, 128, 50, 0, 0, 128, 50, 0, 0, 128,
+    50, 0, 0, 128, 255, 255, 255, 255, 103, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 50, 0, 0, 128,
+    50, 0, 0, 128, 255, 255, 255, 255, 134, 0, 0, 0, 135, 0, 0, 0,
+    104, 0, 0, 0, 136, 0, 0, 0, 50, 0, 0, 128, 49, 0, 0, 128,
+    255, 255, 255, 255, 49, 0, 0, 128, 255, 255, 255, 255, 49, 0, 0, 128,
+    49, 0, 0, 128, 49, 0, 0, 128, 49, 0, 0, 128, 49, 0, 0, 128,
+    105, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 106, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 49, 0, 0, 128, 49, 0, 0, 128,
+    255, 255, 255, 255, 134, 0, 0, 0, 135, 0, 0, 0, 103, 0, 0, 0,
+    136, 0, 0, 0, 49, 0, 0, 128, 114, 0, 0, 0, 115, 0, 0, 0,
+    116, 0, 0, 0, 117, 0, 0, 0, 118, 0, 0, 0, 119, 0, 0, 0,
+    183, 0, 0, 0, 104, 0, 0, 0, 43, 0, 0, 128, 255, 255, 255, 255,
+    43, 0, 0, 128, 255, 255, 255, 255, 146, 0, 0, 0, 147, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 185, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 105, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    106, 0, 0, 0, 43, 0, 0, 128, 43, 0, 0, 128, 149, 0, 0, 0,
+    132, 0, 0, 0, 133, 0, 0, 0, 186, 0, 0, 0, 255, 255, 255, 255,
+    43, 0, 0, 128, 187, 0, 0, 0, 255, 255, 255, 255, 114, 0, 0, 0,
+    115, 0, 0, 0, 116, 0, 0, 0, 117, 0, 0, 0, 118, 0, 0, 0,
+    119, 0, 0, 0, 183, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    188, 0, 0, 0, 189, 0, 0, 0, 190, 0, 0, 0, 191, 0, 0, 0,
+    192, 0, 0, 0, 193, 0, 0, 0, 255, 255, 255, 255, 185, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 42, 0, 0, 128, 255, 255, 255, 255,
+    212, 0, 0, 0, 213, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    148, 0, 0, 0, 132, 0, 0, 0, 133, 0, 0, 0, 186, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 187, 0, 0, 0, 42, 0, 0, 128,
+    42, 0, 0, 128, 215, 0, 0, 0, 198, 0, 0, 0, 199, 0, 0, 0,
+    255, 255, 255, 255, 1, 0, 0, 0, 42, 0, 0, 128, 255, 255, 255, 255,
+    255, 255, 255, 255, 188, 0, 0, 0, 189, 0, 0, 0, 190, 0, 0, 0,
+    191, 0, 0, 0, 192, 0, 0, 0, 193, 0, 0, 0, 2, 0, 0, 0,
+    47, 0, 0, 128, 255, 255, 255, 255, 47, 0, 0, 128, 255, 255, 255, 255,
+    47, 0, 0, 128, 47, 0, 0, 128, 140, 0, 0, 0, 141, 0, 0, 0,
+    142, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 3, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 4, 0, 0, 0, 47, 0, 0, 128,
+    47, 0, 0, 128, 255, 255, 255, 255, 214, 0, 0, 0, 198, 0, 0, 0,
+    199, 0, 0, 0, 1, 0, 0, 0, 47, 0, 0, 128, 255, 255, 255, 255,
+    255, 255, 255, 255, 12, 0, 0, 0, 13, 0, 0, 0, 14, 0, 0, 0,
+    15, 0, 0, 0, 16, 0, 0, 0, 17, 0, 0, 0, 2, 0, 0, 0,
+    46, 0, 0, 128, 255, 255, 255, 255, 46, 0, 0, 128, 255, 255, 255, 255,
+    46, 0, 0, 128, 46, 0, 0, 128, 140, 0, 0, 0, 141, 0, 0, 0,
+    142, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 3, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 4, 0, 0, 0, 46, 0, 0, 128,
+    46, 0, 0, 128, 255, 255, 255, 255, 255, 255, 255, 255, 43, 0, 0, 0,
+    31, 0, 0, 0, 1, 0, 0, 0, 46, 0, 0, 128, 255, 255, 255, 255,
+    255, 255, 255, 255, 12, 0, 0, 0, 13, 0, 0, 0, 14, 0, 0, 0,
+    15, 0, 0, 0, 16, 0, 0, 0, 17, 0, 0, 0, 2, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 45, 0, 0, 128, 255, 255, 255, 255,
+    45, 0, 0, 128, 45, 0, 0, 128, 206, 0, 0, 0, 207, 0, 0, 0,
+    208, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 3, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 4, 0, 0, 0, 45, 0, 0, 128,
+    45, 0, 0, 128, 255, 255, 255, 255, 255, 255, 255, 255, 42, 0, 0, 0,
+    31, 0, 0, 0, 255, 255, 255, 255, 45, 0, 0, 128, 48, 0, 0, 128,
+    255, 255, 255, 255, 12, 0, 0, 0, 13, 0, 0, 0, 14, 0, 0, 0,
+    15, 0, 0, 0, 16, 0, 0, 0, 17, 0, 0, 0, 48, 0, 0, 128,
+    48, 0, 0, 128, 48, 0, 0, 128, 48, 0, 0, 128, 48, 0, 0, 128,
+    255, 255, 255, 255, 62, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 0, 128, 48, 0, 0, 128,
+    62, 0, 0, 0, 78, 0, 0, 0, 79, 0, 0, 0, 63, 0, 0, 0,
+    80, 0, 0, 0, 48, 0, 0, 128, 255, 255, 255, 255, 41, 0, 0, 0,
+    31, 0, 0, 0, 255, 255, 255, 255, 63, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 64, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 65, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 64, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 65, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 66, 0, 0, 0, 67, 0, 0, 0, 68, 0, 0, 0,
+    69, 0, 0, 0, 70, 0, 0, 0, 71, 0, 0, 0, 62, 0, 0, 0,
+    66, 0, 0, 0, 67, 0, 0, 0, 68, 0, 0, 0, 69, 0, 0, 0,
+    70, 0, 0, 0, 71, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 63, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 89, 0, 0, 0,
+    77, 0, 0, 0, 64, 0, 0, 0, 51, 0, 0, 128, 255, 255, 255, 255,
+    65, 0, 0, 0, 255, 255, 255, 255, 88, 0, 0, 0, 77, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 51, 0, 0, 128, 51, 0, 0, 128,
+    51, 0, 0, 128, 51, 0, 0, 128, 51, 0, 0, 128, 66, 0, 0, 0,
+    67, 0, 0, 0, 68, 0, 0, 0, 69, 0, 0, 0, 70, 0, 0, 0,
+    71, 0, 0, 0, 51, 0, 0, 128, 51, 0, 0, 128, 255, 255, 255, 255,
+    78, 0, 0, 0, 79, 0, 0, 0, 50, 0, 0, 128, 80, 0, 0, 0,
+    51, 0, 0, 128, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 50, 0, 0, 128, 50, 0, 0, 128,
+    50, 0, 0, 128, 50, 0, 0, 128, 50, 0, 0, 128, 255, 255, 255, 255,
+    103, 0, 0, 0, 87, 0, 0, 0, 77, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 50, 0, 0, 128, 50, 0, 0, 128, 49, 0, 0, 128,
+    78, 0, 0, 0, 79, 0, 0, 0, 104, 0, 0, 0, 80, 0, 0, 0,
+    50, 0, 0, 128, 255, 255, 255, 255, 255, 255, 255, 255, 49, 0, 0, 128,
+    49, 0, 0, 128, 49, 0, 0, 128, 49, 0, 0, 128, 49, 0, 0, 128,
+    255, 255, 255, 255, 255, 255, 255, 255, 105, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 106, 0, 0, 0, 49, 0, 0, 128, 49, 0, 0, 128,
+    255, 255, 255, 255, 78, 0, 0, 0, 79, 0, 0, 0, 255, 255, 255, 255,
+    80, 0, 0, 0, 49, 0, 0, 128, 103, 0, 0, 0, 255, 255, 255, 255,
+    114, 0, 0, 0, 115, 0, 0, 0, 116, 0, 0, 0, 117, 0, 0, 0,
+    118, 0, 0, 0, 119, 0, 0, 0, 103, 0, 0, 0, 255, 255, 255, 255,
+    104, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    104, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    105, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 106, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 145, 0, 0, 0, 133, 0, 0, 0,
+    105, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 106, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 114, 0, 0, 0, 115, 0, 0, 0,
+    116, 0, 0, 0, 117, 0, 0, 0, 118, 0, 0, 0, 119, 0, 0, 0,
+    255, 255, 255, 255, 183, 0, 0, 0, 114, 0, 0, 0, 115, 0, 0, 0,
+    116, 0, 0, 0, 117, 0, 0, 0, 118, 0, 0, 0, 119, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 185, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    144, 0, 0, 0, 133, 0, 0, 0, 255, 255, 255, 255, 186, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 187, 0, 0, 0, 255, 255, 255, 255,
+    143, 0, 0, 0, 133, 0, 0, 0, 48, 0, 0, 128, 255, 255, 255, 255,
+    48, 0, 0, 128, 48, 0, 0, 128, 48, 0, 0, 128, 48, 0, 0, 128,
+    48, 0, 0, 128, 188, 0, 0, 0, 189, 0, 0, 0, 190, 0, 0, 0,
+    191, 0, 0, 0, 192, 0, 0, 0, 193, 0, 0, 0, 48, 0, 0, 128,
+    48, 0, 0, 128, 183, 0, 0, 0, 200, 0, 0, 0, 201, 0, 0, 0,
+    255, 255, 255, 255, 202, 0, 0, 0, 48, 0, 0, 128, 183, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 185, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 185, 0, 0, 0, 255, 255, 255, 255, 211, 0, 0, 0,
+    199, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 186, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 187, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 186, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    187, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 188, 0, 0, 0, 189, 0, 0, 0, 190, 0, 0, 0,
+    191, 0, 0, 0, 192, 0, 0, 0, 193, 0, 0, 0, 188, 0, 0, 0,
+    189, 0, 0, 0, 190, 0, 0, 0, 191, 0, 0, 0, 192, 0, 0, 0,
+    193, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    47, 0, 0, 128, 255, 255, 255, 255, 47, 0, 0, 128, 47, 0, 0, 128,
+    206, 0, 0, 0, 207, 0, 0, 0, 208, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 210, 0, 0, 0,
+    199, 0, 0, 0, 47, 0, 0, 128, 47, 0, 0, 128, 255, 255, 255, 255,
+    255, 255, 255, 255, 209, 0, 0, 0, 199, 0, 0, 0, 51, 0, 0, 128,
+    47, 0, 0, 128, 51, 0, 0, 128, 51, 0, 0, 128, 51, 0, 0, 128,
+    51, 0, 0, 128, 51, 0, 0, 128, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    51, 0, 0, 128, 51, 0, 0, 128, 255, 255, 255, 255, 200, 0, 0, 0,
+    201, 0, 0, 0, 255, 255, 255, 255, 202, 0, 0, 0, 51, 0, 0, 128,
+    50, 0, 0, 128, 255, 255, 255, 255, 50, 0, 0, 128, 50, 0, 0, 128,
+    50, 0, 0, 128, 50, 0, 0, 128, 50, 0, 0, 128, 255, 255, 255, 255,
+    1, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 50, 0, 0, 128, 50, 0, 0, 128, 255, 255, 255, 255,
+    200, 0, 0, 0, 201, 0, 0, 0, 2, 0, 0, 0, 202, 0, 0, 0,
+    50, 0, 0, 128, 49, 0, 0, 128, 255, 255, 255, 255, 49, 0, 0, 128,
+    49, 0, 0, 128, 49, 0, 0, 128, 49, 0, 0, 128, 49, 0, 0, 128,
+    255, 255, 255, 255, 1, 0, 0, 0, 3, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 4, 0, 0, 0, 49, 0, 0, 128, 49, 0, 0, 128,
+    255, 255, 255, 255, 200, 0, 0, 0, 201, 0, 0, 0, 2, 0, 0, 0,
+    202, 0, 0, 0, 49, 0, 0, 128, 255, 255, 255, 255, 255, 255, 255, 255,
+    12, 0, 0, 0, 13, 0, 0, 0, 14, 0, 0, 0, 15, 0, 0, 0,
+    16, 0, 0, 0, 17, 0, 0, 0, 1, 0, 0, 0, 3, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 4, 0, 0, 0, 255, 255, 255, 255,
+    40, 0, 0, 128, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    2, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    40, 0, 0, 128, 12, 0, 0, 0, 13, 0, 0, 0, 14, 0, 0, 0,
+    15, 0, 0, 0, 16, 0, 0, 0, 17, 0, 0, 0, 78, 1, 0, 0,
+    3, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 4, 0, 0, 0,
+    255, 255, 255, 255, 48, 0, 0, 0, 49, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 0, 0, 0,
+    40, 0, 0, 128, 255, 255, 255, 255, 12, 0, 0, 0, 13, 0, 0, 0,
+    14, 0, 0, 0, 15, 0, 0, 0, 16, 0, 0, 0, 17, 0, 0, 0,
+    77, 1, 0, 0, 2, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    46, 0, 0, 128, 255, 255, 255, 255, 46, 0, 0, 128, 46, 0, 0, 128,
+    206, 0, 0, 0, 207, 0, 0, 0, 208, 0, 0, 0, 255, 255, 255, 255,
+    1, 0, 0, 0, 3, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    4, 0, 0, 0, 46, 0, 0, 128, 46, 0, 0, 128, 255, 255, 255, 255,
+    255, 255, 255, 255, 76, 1, 0, 0, 2, 0, 0, 0, 41, 0, 0, 128,
+    46, 0, 0, 128, 41, 0, 0, 128, 255, 255, 255, 255, 12, 0, 0, 0,
+    13, 0, 0, 0, 14, 0, 0, 0, 15, 0, 0, 0, 16, 0, 0, 0,
+    17, 0, 0, 0, 1, 0, 0, 0, 3, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 4, 0, 0, 0, 150, 0, 0, 0, 151, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 0, 0, 0,
+    255, 255, 255, 255, 41, 0, 0, 128, 255, 255, 255, 255, 255, 255, 255, 255,
+    12, 0, 0, 0, 13, 0, 0, 0, 14, 0, 0, 0, 15, 0, 0, 0,
+    16, 0, 0, 0, 17, 0, 0, 0, 37, 0, 0, 0, 3, 0, 0, 0,
+    255, 255, 255, 255, 43, 0, 0, 128, 4, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 43, 0, 0, 128, 62, 0, 0, 0, 44, 0, 0, 0,
+    45, 0, 0, 0, 12, 0, 0, 0, 13, 0, 0, 0, 14, 0, 0, 0,
+    15, 0, 0, 0, 16, 0, 0, 0, 17, 0, 0, 0, 36, 0, 0, 0,
+    63, 0, 0, 0, 255, 255, 255, 255, 43, 0, 0, 128, 43, 0, 0, 128,
+    44, 0, 0, 128, 255, 255, 255, 255, 212, 0, 0, 0, 213, 0, 0, 0,
+    255, 255, 255, 255, 43, 0, 0, 128, 255, 255, 255, 255, 62, 0, 0, 0,
+    64, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 65, 0, 0, 0,
+    255, 255, 255, 255, 44, 0, 0, 128, 44, 0, 0, 128, 255, 255, 255, 255,
+    35, 0, 0, 0, 63, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    44, 0, 0, 128, 255, 255, 255, 255, 66, 0, 0, 0, 67, 0, 0, 0,
+    68, 0, 0, 0, 69, 0, 0, 0, 70, 0, 0, 0, 71, 0, 0, 0,
+    62, 0, 0, 0, 64, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    65, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 63, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 66, 0, 0, 0,
+    67, 0, 0, 0, 68, 0, 0, 0, 69, 0, 0, 0, 70, 0, 0, 0,
+    71, 0, 0, 0, 22, 1, 0, 0, 64, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 65, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    43, 0, 0, 128, 62, 0, 0, 0, 212, 0, 0, 0, 213, 0, 0, 0,
+    66, 0, 0, 0, 67, 0, 0, 0, 68, 0, 0, 0, 69, 0, 0, 0,
+    70, 0, 0, 0, 71, 0, 0, 0, 21, 1, 0, 0, 63, 0, 0, 0,
+    255, 255, 255, 255, 43, 0, 0, 128, 43, 0, 0, 128, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    43, 0, 0, 128, 255, 255, 255, 255, 62, 0, 0, 0, 64, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 65, 0, 0, 0, 41, 0, 0, 128,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 20, 1, 0, 0,
+    63, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 41, 0, 0, 128,
+    255, 255, 255, 255, 66, 0, 0, 0, 67, 0, 0, 0, 68, 0, 0, 0,
+    69, 0, 0, 0, 70, 0, 0, 0, 71, 0, 0, 0, 62, 0, 0, 0,
+    64, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 65, 0, 0, 0,
+    48, 0, 0, 0, 49, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 63, 0, 0, 0, 255, 255, 255, 255, 41, 0, 0, 128,
+    255, 255, 255, 255, 255, 255, 255, 255, 66, 0, 0, 0, 67, 0, 0, 0,
+    68, 0, 0, 0, 69, 0, 0, 0, 70, 0, 0, 0, 71, 0, 0, 0,
+    83, 0, 0, 0, 64, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    65, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    103, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 66, 0, 0, 0,
+    67, 0, 0, 0, 68, 0, 0, 0, 69, 0, 0, 0, 70, 0, 0, 0,
+    71, 0, 0, 0, 82, 0, 0, 0, 104, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 103, 0, 0, 0, 105, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 106, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 81, 0, 0, 0, 104, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    114, 0, 0, 0, 115, 0, 0, 0, 116, 0, 0, 0, 117, 0, 0, 0,
+    118, 0, 0, 0, 119, 0, 0, 0, 103, 0, 0, 0, 105, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 106, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    104, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 114, 0, 0, 0, 115, 0, 0, 0, 116, 0, 0, 0,
+    117, 0, 0, 0, 118, 0, 0, 0, 119, 0, 0, 0, 17, 1, 0, 0,
+    105, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 106, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 103, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 114, 0, 0, 0, 115, 0, 0, 0,
+    116, 0, 0, 0, 117, 0, 0, 0, 118, 0, 0, 0, 119, 0, 0, 0,
+    16, 1, 0, 0, 104, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    103, 0, 0, 0, 105, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    106, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 15, 1, 0, 0, 104, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 114, 0, 0, 0,
+    115, 0, 0, 0, 116, 0, 0, 0, 117, 0, 0, 0, 118, 0, 0, 0,
+    119, 0, 0, 0, 103, 0, 0, 0, 105, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 106, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 104, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    114, 0, 0, 0, 115, 0, 0, 0, 116, 0, 0, 0, 117, 0, 0, 0,
+    118, 0, 0, 0, 119, 0, 0, 0, 139, 0, 0, 0, 105, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 106, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 183, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 114, 0, 0, 0, 115, 0, 0, 0, 116, 0, 0, 0,
+    117, 0, 0, 0, 118, 0, 0, 0, 119, 0, 0, 0, 138, 0, 0, 0,
+    185, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 183, 0, 0, 0,
+    186, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 187, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    137, 0, 0, 0, 185, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 188, 0, 0, 0, 189, 0, 0, 0,
+    190, 0, 0, 0, 191, 0, 0, 0, 192, 0, 0, 0, 193, 0, 0, 0,
+    183, 0, 0, 0, 186, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    187, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 185, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 188, 0, 0, 0,
+    189, 0, 0, 0, 190, 0, 0, 0, 191, 0, 0, 0, 192, 0, 0, 0,
+    193, 0, 0, 0, 230, 0, 0, 0, 186, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 187, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 183, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    188, 0, 0, 0, 189, 0, 0, 0, 190, 0, 0, 0, 191, 0, 0, 0,
+    192, 0, 0, 0, 193, 0, 0, 0, 229, 0, 0, 0, 185, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 183, 0, 0, 0, 186, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 187, 0, 0, 0, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 228, 0, 0, 0,
+    185, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 188, 0, 0, 0, 189, 0, 0, 0, 190, 0, 0, 0,
+    191, 0, 0, 0, 192, 0, 0, 0, 193, 0, 0, 0, 183, 0, 0, 0,
+    186, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 187, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 185, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 188, 0, 0, 0, 189, 0, 0, 0,
+    190, 0, 0, 0, 191, 0, 0, 0, 192, 0, 0, 0, 193, 0, 0, 0,
+    205, 0, 0, 0, 186, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+    187, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 188, 0, 0, 0,
+    189, 0, 0, 0, 190, 0, 0, 0, 191, 0, 0, 0, 192, 0, 0, 0,
+    193, 0, 0, 0, 204, 0, 0, 0, 45, 0, 0, 128, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 45, 0, 0, 128, 255, 255, 255, 255,
+    45, 0, 0, 128, 45, 0, 0, 128, 38, 0, 0, 0, 39, 0, 0, 0,
+    40, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 47, 0, 0, 128, 203, 0, 0, 0, 45, 0, 0, 128,
+    45, 0, 0, 128, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 47, 0, 0, 128, 45, 0, 0, 128, 47, 0, 0, 128,
+    47, 0, 0, 128, 38, 0, 0, 0, 39, 0, 0, 0, 40, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    46, 0, 0, 128, 255, 255, 255, 255, 47, 0, 0, 128, 47, 0, 0, 128,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 45, 0, 0, 128,
+    46, 0, 0, 128, 47, 0, 0, 128, 46, 0, 0, 128, 46, 0, 0, 128,
+    38, 0, 0, 0, 39, 0, 0, 0, 40, 0, 0, 0, 45, 0, 0, 128,
+    45, 0, 0, 128, 84, 0, 0, 0, 85, 0, 0, 0, 86, 0, 0, 0,
+    255, 255, 255, 255, 46, 0, 0, 128, 46, 0, 0, 128, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 45, 0, 0, 128, 45, 0, 0, 128,
+    46, 0, 0, 128, 47, 0, 0, 128, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 45, 0, 0, 128, 46, 0, 0, 128, 255, 255, 255, 255,
+    255, 255, 255, 255, 47, 0, 0, 128, 47, 0, 0, 128, 84, 0, 0, 0,
+    85, 0, 0, 0, 86, 0, 0, 0, 46, 0, 0, 128, 46, 0, 0, 128,
+    84, 0, 0, 0, 85, 0, 0, 0, 86, 0, 0, 0, 255, 255, 255, 255,
+    47, 0, 0, 128, 47, 0, 0, 128, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 46, 0, 0, 128, 46, 0, 0, 128, 47, 0, 0, 128,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    46, 0, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    2, 0, 0, 0, 3, 0, 0, 0, 4, 0, 0, 0, 5, 0, 0, 0,
+    5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0,
+    5, 0, 0, 0, 5, 0, 0, 0, 6, 0, 0, 0, 6, 0, 0, 0,
+    6, 0, 0, 0, 6, 0, 0, 0, 6, 0, 0, 0, 6, 0, 0, 0,
+    6, 0, 0, 0, 6, 0, 0, 0, 6, 0, 0, 0, 6, 0, 0, 0,
+    6, 0, 0, 0, 6, 0, 0, 0, 6, 0, 0, 0, 6, 0, 0, 0,
+    6, 0, 0, 0, 6, 0, 0, 0, 6, 0, 0, 0, 6, 0, 0, 0,
+    6, 0, 0, 0, 6, 0, 0, 0, 6, 0, 0, 0, 7, 0, 0, 0,
+    8, 0, 0, 0, 9, 0, 0, 0, 9, 0, 0, 0, 9, 0, 0, 0,
+    9, 0, 0, 0, 10, 0, 0, 0, 11, 0, 0, 0, 12, 0, 0, 0,
+    12, 0, 0, 0, 12, 0, 0, 0, 12, 0, 0, 0, 13, 0, 0, 0,
+    14, 0, 0, 0, 14, 0, 0, 0, 14, 0, 0, 0, 15, 0, 0, 0,
+    16, 0, 0, 0, 16, 0, 0, 0, 16, 0, 0, 0, 16, 0, 0, 0,
+    16, 0, 0, 0, 16, 0, 0, 0, 16, 0, 0, 0, 16, 0, 0, 0,
+    16, 0, 0, 0, 17, 0, 0, 0, 17, 0, 0, 0, 17, 0, 0, 0,
+    18, 0, 0, 0, 19, 0, 0, 0, 20, 0, 0, 0, 21, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 0, 23, 0, 0, 0, 24, 0, 0, 0, 25, 0, 0, 0,
+    25, 0, 0, 0, 25, 0, 0, 0, 25, 0, 0, 0, 26, 0, 0, 0,
+    27, 0, 0, 0, 28, 0, 0, 0, 28, 0, 0, 0, 28, 0, 0, 0,
+    28, 0, 0, 0, 29, 0, 0, 0, 30, 0, 0, 0, 30, 0, 0, 0,
+    30, 0, 0, 0, 31, 0, 0, 0, 32, 0, 0, 0, 32, 0, 0, 0,
+    32, 0, 0, 0, 32, 0, 0, 0, 33, 0, 0, 0, 33, 0, 0, 0,
+    34, 0, 0, 0, 34, 0, 0, 0, 35, 0, 0, 0, 36, 0, 0, 0,
+    37, 0, 0, 0, 38, 0, 0, 0, 38, 0, 0, 0, 38, 0, 0, 0,
+    38, 0, 0, 0, 38, 0, 0, 0, 38, 0, 0, 0, 38, 0, 0, 0,
+    39, 0, 0, 0, 39, 0, 0, 0, 39, 0, 0, 0, 39, 0, 0, 0,
+    39, 0, 0, 0, 39, 0, 0, 0, 39, 0, 0, 0, 39, 0, 0, 0,
+    39, 0, 0, 0, 39, 0, 0, 0, 39, 0, 0, 0, 39, 0, 0, 0,
+    39, 0, 0, 0, 39, 0, 0, 0, 39, 0, 0, 0, 39, 0, 0, 0,
+    39, 0, 0, 0, 39, 0, 0, 0, 39, 0, 0, 0, 39, 0, 0, 0,
+    39, 0, 0, 0, 40, 0, 0, 0, 41, 0, 0, 0, 42, 0, 0, 0,
+    42, 0, 0, 0, 42, 0, 0, 0, 42, 0, 0, 0, 43, 0, 0, 0,
+    44, 0, 0, 0, 45, 0, 0, 0, 45, 0, 0, 0, 45, 0, 0, 0,
+    45, 0, 0, 0, 46, 0, 0, 0, 47, 0, 0, 0, 47, 0, 0, 0,
+    47, 0, 0, 0, 48, 0, 0, 0, 49, 0, 0, 0, 49, 0, 0, 0,
+    49, 0, 0, 0, 49, 0, 0, 0, 49, 0, 0, 0, 49, 0, 0, 0,
+    49, 0, 0, 0, 49, 0, 0, 0, 49, 0, 0, 0, 50, 0, 0, 0,
+    50, 0, 0, 0, 50, 0, 0, 0, 51, 0, 0, 0, 51, 0, 0, 0,
+    51, 0, 0, 0, 52, 0, 0, 0, 52, 0, 0, 0, 52, 0, 0, 0,
+    52, 0, 0, 0, 53, 0, 0, 0, 53, 0, 0, 0, 53, 0, 0, 0,
+    53, 0, 0, 0, 53, 0, 0, 0, 54, 0, 0, 0, 54, 0, 0, 0,
+    54, 0, 0, 0, 54, 0, 0, 0, 55, 0, 0, 0, 55, 0, 0, 0,
+    55, 0, 0, 0, 56, 0, 0, 0, 57, 0, 0, 0, 58, 0, 0, 0,
+    59, 0, 0, 0, 60, 0, 0, 0, 61, 0, 0, 0, 61, 0, 0, 0,
+    61, 0, 0, 0, 61, 0, 0, 0, 61, 0, 0, 0, 61, 0, 0, 0,
+    61, 0, 0, 0, 61, 0, 0, 0, 61, 0, 0, 0, 61, 0, 0, 0,
+    61, 0, 0, 0, 61, 0, 0, 0, 61, 0, 0, 0, 62, 0, 0, 0,
+    63, 0, 0, 0, 64, 0, 0, 0, 64, 0, 0, 0, 64, 0, 0, 0,
+    64, 0, 0, 0, 65, 0, 0, 0, 66, 0, 0, 0, 67, 0, 0, 0,
+    67, 0, 0, 0, 67, 0, 0, 0, 67, 0, 0, 0, 68, 0, 0, 0,
+    69, 0, 0, 0, 69, 0, 0, 0, 69, 0, 0, 0, 70, 0, 0, 0,
+    71, 0, 0, 0, 71, 0, 0, 0, 71, 0, 0, 0, 72, 0, 0, 0,
+    73, 0, 0, 0, 73, 0, 0, 0, 73, 0, 0, 0, 73, 0, 0, 0,
+    73, 0, 0, 0, 73, 0, 0, 0, 73, 0, 0, 0, 73, 0, 0, 0,
+    73, 0, 0, 0, 73, 0, 0, 0, 73, 0, 0, 0, 73, 0, 0, 0,
+    73, 0, 0, 0, 73, 0, 0, 0, 73, 0, 0, 0, 73, 0, 0, 0,
+    73, 0, 0, 0, 73, 0, 0, 0, 74, 0, 0, 0, 74, 0, 0, 0,
+    75, 0, 0, 0, 75, 0, 0, 0, 76, 0, 0, 0, 76, 0, 0, 0,
+    76, 0, 0, 0, 76, 0, 0, 0, 76, 0, 0, 0, 76, 0, 0, 0,
+    76, 0, 0, 0, 76, 0, 0, 0, 76, 0, 0, 0, 76, 0, 0, 0,
+    76, 0, 0, 0, 77, 0, 0, 0, 77, 0, 0, 0, 77, 0, 0, 0,
+    77, 0, 0, 0, 77, 0, 0, 0, 77, 0, 0, 0, 77, 0, 0, 0,
+    77, 0, 0, 0, 77, 0, 0, 0, 77, 0, 0, 0, 77, 0, 0, 0,
+    77, 0, 0, 0, 77, 0, 0, 0, 77, 0, 0, 0, 77, 0, 0, 0,
+    78, 0, 0, 0, 78, 0, 0, 0, 78, 0, 0, 0, 78, 0, 0, 0,
+    78, 0, 0, 0, 78, 0, 0, 0, 78, 0, 0, 0, 78, 0, 0, 0,
+    78, 0, 0, 0, 78, 0, 0, 0, 78, 0, 0, 0, 78, 0, 0, 0,
+    78, 0, 0, 0, 78, 0, 0, 0, 79, 0, 0, 0, 79, 0, 0, 0,
+    80, 0, 0, 0, 80, 0, 0, 0, 80, 0, 0, 0, 80, 0, 0, 0,
+    81, 0, 0, 0, 81, 0, 0, 0, 82, 0, 0, 0, 83, 0, 0, 0,
+    83, 0, 0, 0, 84, 0, 0, 0, 84, 0, 0, 0, 84, 0, 0, 0,
+    84, 0, 0, 0, 84, 0, 0, 0, 84, 0, 0, 0, 84, 0, 0, 0,
+    84, 0, 0, 0, 84, 0, 0, 0, 84, 0, 0, 0, 84, 0, 0, 0,
+    85, 0, 0, 0, 85, 0, 0, 0, 86, 0, 0, 0, 86, 0, 0, 0,
+    86, 0, 0, 0, 86, 0, 0, 0, 86, 0, 0, 0, 86, 0, 0, 0,
+    86, 0, 0, 0, 86, 0, 0, 0, 86, 0, 0, 0, 86, 0, 0, 0,
+    86, 0, 0, 0, 87, 0, 0, 0, 87, 0, 0, 0, 87, 0, 0, 0,
+    87, 0, 0, 0, 87, 0, 0, 0, 87, 0, 0, 0, 87, 0, 0, 0,
+    87, 0, 0, 0, 87, 0, 0, 0, 87, 0, 0, 0, 87, 0, 0, 0,
+    87, 0, 0, 0, 88, 0, 0, 0, 88, 0, 0, 0, 88, 0, 0, 0,
+    88, 0, 0, 0, 88, 0, 0, 0, 88, 0, 0, 0, 88, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1
   };
 
-  static auto json = nlohmann::json::from_cbor(binary, binary + sizeof(binary));
-  static auto syntax = alioth::LoadSyntax(json);
+  static auto syntax = alioth::Syntactic::View(
+      {reinterpret_cast<char const*>(kImage), sizeof(kImage)});
 
   return syntax;
 }
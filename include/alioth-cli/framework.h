@@ -1,16 +1,32 @@
 #ifndef __ALIOTH_CLI_FRAMEWORK_H__
 #define __ALIOTH_CLI_FRAMEWORK_H__
 
+#include "alioth-cli/syntax.h"
 #include "cli/cli.h"
 
 struct Framework : public cli::Command {
   int Run() override;
 
+  /**
+   * 为语法规则生成框架代码
+   *
+   * 头文件写入 output/include/<lang>，源文件写入 output/src
+   * 合成的非终结符不出现在生成的代码中
+   *
+   * @param syntax 语法规则
+   * @param output 输出目录
+   */
+  static void Generate(alioth::Syntax const& syntax,
+                       std::filesystem::path const& output);
+
   cli::Arg gpath = Named("grammar-path");
   cli::Opt opath = Option({"-o", "--output"})
                        ->Required()
                        ->Argument("output-dir")
                        ->Brief("output directory");
+  cli::Opt jobs = ::Syntax::JobsOption(*this);
+
+  cli::Opt no_cache = ::Syntax::NoCacheOption(*this);
 };
 
 #endif
\ No newline at end of file
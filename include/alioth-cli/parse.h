@@ -1,6 +1,7 @@
 #ifndef __ALIOTH_CLI_PARSE_H__
 #define __ALIOTH_CLI_PARSE_H__
 
+#include "alioth-cli/syntax.h"
 #include "cli/cli.h"
 
 struct Parse : public cli::Command {
@@ -24,6 +25,12 @@ struct Parse : public cli::Command {
 
   cli::Opt flatten_output = Option({"-f", "--flatten-output"});
 
+  cli::Opt drop_ignored = Option({"-D", "--drop-ignored"})
+                              ->Brief("drop ignored terms")
+                              ->Doc(
+                                  "do not keep ignored terms such as spaces"
+                                  " and comments in the syntax tree");
+
   cli::Opt text_key = Option({"--text"})->Argument("text-key");
   cli::Opt id_key = Option({"--id"})->Argument("id-key");
   cli::Opt name_key = Option({"--name"})->Argument("name-key");
@@ -31,6 +38,16 @@ struct Parse : public cli::Command {
   cli::Opt formula_key = Option({"--formula"})->Argument("formula-key");
   cli::Opt origin_key = Option({"--origin"})->Argument("origin-key");
   cli::Opt form_key = Option({"--form"})->Argument("form-key");
+
+  cli::Opt jobs = Option({"-j", "--jobs"})
+                      ->Argument("jobs")
+                      ->Brief("lex in parallel")
+                      ->Doc(
+                          "pre-lex the source with the given number of threads,"
+                          " 0 to decide by hardware and source size,"
+                          " only for grammars with a single lexical context");
+
+  cli::Opt no_cache = ::Syntax::NoCacheOption(*this);
 };
 
 #endif
\ No newline at end of file
@@ -1,12 +1,15 @@
 #ifndef __ALIOTH_CLI_SKELETON_H__
 #define __ALIOTH_CLI_SKELETON_H__
 
+#include "alioth-cli/syntax.h"
 #include "cli/cli.h"
 
 struct Skeleton : public cli::Command {
   int Run() override;
 
   cli::Arg gpath = Named("grammar-path");
+
+  cli::Opt no_cache = ::Syntax::NoCacheOption(*this);
 };
 
 #endif
\ No newline at end of file
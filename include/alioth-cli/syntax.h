@@ -1,6 +1,8 @@
 #ifndef __ALIOTH_CLI_SYNTAX_H__
 #define __ALIOTH_CLI_SYNTAX_H__
 
+#include <optional>
+
 #include "alioth/syntax.h"
 #include "cli/cli.h"
 
@@ -9,6 +11,16 @@ struct Syntax : public cli::Command {
 
   cli::Arg gpath = Named("grammar");
 
+  cli::Opt jobs = JobsOption(*this);
+
+  cli::Opt binary = Option({"-b", "--binary"})
+                        ->Brief("output a binary image")
+                        ->Doc(
+                            "print a binary image that can be mapped and"
+                            " used in place instead of json");
+
+  cli::Opt no_cache = NoCacheOption(*this);
+
   /**
    * 从指定路径加载语法
    *
@@ -16,10 +28,42 @@ struct Syntax : public cli::Command {
    * 否则从指定路径加载
    *
    * 同时支持 json 格式和 grammar 格式
+   * 文件也可以是二进制镜像，此时直接映射到内存
+   *
+   * grammar 格式的编译结果以二进制镜像的形式，按语法文本、版本号和
+   * 编译器指纹的哈希值缓存在 AliothCache 中
+   * 再次加载相同的语法时直接映射缓存的镜像，缓存不可用时重新编译
+   * 缓存文件末尾记录完整的键，与当前的键不一致时视为缓存不可用
+   * 映射的镜像不含状态表，需要 Store 的调用方应当关闭缓存
+   * 编译 grammar 格式时产生的说明打印到标准错误
    *
    * @param path 语法文件路径
+   * @param jobs 编译 grammar 格式时构造状态机的线程数
+   * @param cache 是否读写缓存
+   */
+  static alioth::Syntax Load(std::string const& path, size_t jobs = 1,
+                             bool cache = true);
+
+  /**
+   * 为加载语法的命令创建 --no-cache 选项
+   */
+  static cli::Opt NoCacheOption(cli::Command& command);
+
+  /**
+   * 为编译语法的命令创建 -j 选项，指定构造状态机的线程数
+   */
+  static cli::Opt JobsOption(cli::Command& command);
+
+  /**
+   * 读取 -j 选项指定的线程数
+   *
+   * 所有命令中 0 都表示由硬件决定线程数
+   * 值不是十进制整数时，打印错误信息并返回空
+   *
+   * @param option -j 选项
+   * @param fallback 未指定选项时的线程数
    */
-  static alioth::Syntax Load(std::string const& path);
+  static std::optional<size_t> JobsOf(cli::Opt const& option, size_t fallback);
 };
 
 #endif
\ No newline at end of file
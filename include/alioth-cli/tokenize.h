@@ -0,0 +1,37 @@
+#ifndef __ALIOTH_CLI_TOKENIZE_H__
+#define __ALIOTH_CLI_TOKENIZE_H__
+
+#include "alioth-cli/syntax.h"
+#include "cli/cli.h"
+
+struct Tokenize : public cli::Command {
+  int Run() override;
+
+  cli::Arg source = Named("source-path");
+
+  cli::Opt gpath = Option({"-g", "--grammar"})
+                       ->Required()
+                       ->Argument("grammar-path")
+                       ->Brief("grammar file path")
+                       ->Doc(
+                           "specify the path to the grammar file,"
+                           " '-' represents stdin");
+
+  cli::Opt context = Option({"-c", "--context"})
+                         ->Argument("context-name")
+                         ->Brief("lexical context")
+                         ->Doc(
+                             "specify the context to scan the source in,"
+                             " the first context of the grammar by default");
+
+  cli::Opt jobs = Option({"-j", "--jobs"})
+                      ->Argument("jobs")
+                      ->Brief("lex in parallel")
+                      ->Doc(
+                          "scan the source with the given number of threads,"
+                          " 0 to decide by hardware and source size");
+
+  cli::Opt no_cache = ::Syntax::NoCacheOption(*this);
+};
+
+#endif
@@ -5,11 +5,24 @@
 
 namespace alioth {
 
+/**
+ * Alioth 版本号
+ */
+constexpr auto kVersion = "0.0.0";
+
 /**
  * 获取用户的 Alioth 主目录
  */
 std::filesystem::path AliothHome();
 
+/**
+ * 获取 Alioth 的缓存目录
+ *
+ * 依次尝试 $XDG_CACHE_HOME/alioth、$HOME/.cache/alioth
+ * 都不可用时使用 Alioth 主目录下的 .cache
+ */
+std::filesystem::path AliothCache();
+
 }  // namespace alioth
 
 #endif
\ No newline at end of file
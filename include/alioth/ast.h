@@ -2,8 +2,11 @@
 #define __ALIOTH_AST_H__
 
 #include <map>
+#include <deque>
 #include <memory>
+#include <string_view>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 #include "alioth/ast.h"
@@ -28,6 +31,49 @@ using ASTRoot = std::shared_ptr<ASTRootNode>;
 
 struct Skeleton;
 
+using AtomID = uint32_t;
+
+/**
+ * 标识符驻留表
+ *
+ * 为每个不同的文本分配稠密的原子ID，相同文本的原子ID相同
+ * 下游比较标识符或以标识符为键查表时，可以用原子ID代替文本
+ * 驻留表不是线程安全的，跨线程共享时需要调用者加锁
+ */
+struct Atoms {
+  static constexpr AtomID kNone = -1U;  // 未驻留
+
+  /**
+   * 驻留一段文本，返回其原子ID
+   *
+   * @param text 文本内容
+   */
+  AtomID Intern(std::string_view text);
+
+  /**
+   * 查找文本的原子ID，未驻留则返回 kNone
+   *
+   * @param text 文本内容
+   */
+  AtomID Find(std::string_view text) const;
+
+  /**
+   * 获取原子ID对应的文本
+   *
+   * @param atom 原子ID
+   */
+  std::string_view Text(AtomID atom) const;
+
+  /**
+   * 获取已驻留的文本数量
+   */
+  size_t Size() const;
+
+ protected:
+  std::deque<std::string> texts_{};                       // 原子ID -> 文本
+  std::unordered_map<std::string_view, AtomID> index_{};  // 文本 -> 原子ID
+};
+
 /**
  * 语法树节点
  */
@@ -97,6 +143,13 @@ struct ASTNode : public std::enable_shared_from_this<ASTNode> {
    */
   std::string Text();
 
+  /**
+   * 获取终结符文本的原子ID
+   *
+   * 若节点不是终结符或终结符未被驻留则返回 Atoms::kNone
+   */
+  AtomID Atom();
+
   /**
    * 获取语法树节点的指定属性的文本内容
    *
@@ -208,8 +261,9 @@ struct ASTNode::StoreOptions {
  * 终结符
  */
 struct ASTTermNode : public ASTNode {
-  size_t offset{};  // 词法单元的偏移量
-  size_t length{};  // 词法单元的长度
+  size_t offset{};            // 词法单元的偏移量
+  size_t length{};            // 词法单元的长度
+  AtomID atom{Atoms::kNone};  // 文本的原子ID，未驻留为 kNone
 
   /**
    * 由词法规则或产生式设置的属性
@@ -241,8 +295,9 @@ struct ASTNtrmNode : public ASTNode {
  * 根节点
  */
 struct ASTRootNode : public ASTNtrmNode {
-  Syntax syntax;  // 语法规则
-  Doc doc;        // 源码
+  Syntax syntax;                 // 语法规则
+  Doc doc;                       // 源码
+  std::shared_ptr<Atoms> atoms;  // 标识符驻留表
 
   /**
    * 创建一个终结符节点
@@ -1,8 +1,17 @@
 #ifndef __ALIOTH_LEXICON_H__
 #define __ALIOTH_LEXICON_H__
 
+#include <array>
+#include <bitset>
+#include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <span>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "alioth/error.h"
@@ -21,6 +30,10 @@ using Lex = std::shared_ptr<Lexicon>;
 struct Lexicon {
   struct Term;
   struct State;
+  struct Table;
+  struct Token;
+  struct Lazy;
+  struct Product;
   class Builder;
 
   static constexpr SymbolID kEOF = 0;
@@ -30,6 +43,16 @@ struct Lexicon {
   std::vector<std::string> contexts{};  // 上下文表，第一个元素ID为0
   std::vector<State> states{};          // 状态表，第一个元素ID为0
 
+  /**
+   * 由状态表编译得到的稠密转移表，扫描单词时使用
+   */
+  std::shared_ptr<Table const> table{};
+
+  /**
+   * 惰性构造的状态机，非空时状态表为空，扫描单词时按需构造状态
+   */
+  std::shared_ptr<Lazy> lazy{};
+
   /**
    * 获取语言名称
    *
@@ -51,23 +74,108 @@ struct Lexicon {
    */
   SymbolID FindSymbol(std::string const& name) const;
 
+  /**
+   * 依据状态表编译稠密转移表
+   *
+   * 状态表是词法规则的编辑和存储形式，扫描单词只使用稠密转移表
+   * 修改状态表后需要重新编译
+   */
+  void Compile();
+
+  /**
+   * 从文本的指定位置扫描一个单词
+   *
+   * 到达文本末尾时返回长度为0的 kEOF
+   * 无法识别的文本被扫描为 kERR
+   *
+   * @param text 文本内容
+   * @param offset 起始偏移量
+   * @param context 上下文
+   */
+  Token Scan(std::string_view text, size_t offset, ContextID context) const;
+
+  /**
+   * 从文本的指定位置，在多个上下文中分别扫描单词
+   *
+   * 结果与逐个上下文调用 Scan 等价，入口状态相同的上下文只扫描一次
+   * 入口状态不同的上下文各自读取一遍输入，需要一遍读取时使用乘积状态机
+   *
+   * @param text 文本内容
+   * @param offset 起始偏移量
+   * @param contexts 上下文列表
+   * @param tokens 输出与上下文列表一一对应的单词，可复用以避免分配内存
+   */
+  void Scan(std::string_view text, size_t offset,
+            std::vector<ContextID> const& contexts,
+            std::vector<Token>& tokens) const;
+
+  /**
+   * 从文本的指定位置，使用乘积状态机在其全部上下文中同时扫描单词
+   *
+   * 结果与逐个上下文调用 Scan 等价，输入只读取一遍
+   *
+   * @param text 文本内容
+   * @param offset 起始偏移量
+   * @param product 乘积状态机
+   * @param tokens 输出与乘积状态机的上下文列表一一对应的单词
+   */
+  void Scan(std::string_view text, size_t offset, Product const& product,
+            std::vector<Token>& tokens) const;
+
+  /**
+   * 构造多个上下文的乘积状态机
+   *
+   * 入口状态不足两个、状态机是惰性构造的或乘积状态过多时返回空
+   *
+   * @param contexts 上下文列表
+   */
+  std::shared_ptr<Product const> Join(
+      std::span<ContextID const> contexts) const;
+
   /**
    * 将词法规则保存为JSON格式
    */
   nlohmann::json Store() const;
 
+  /**
+   * 将词法规则保存为不含状态表的JSON格式
+   */
+  nlohmann::json StoreMeta() const;
+
   /**
    * 从JSON格式加载词法规则
    *
    * @param json JSON格式的词法规则
    */
   static Lex Load(nlohmann::json const& json);
+
+  struct NotMaterialized : public Error {
+    NotMaterialized()
+        : Error(
+              "Lexicon has no state table, it is lazy or viewed from an "
+              "image") {}
+  };
+
+ protected:
+  /**
+   * 从 state 出发继续扫描，直到单词结束
+   *
+   * 扫描结束时 state 为单词结束所在的状态
+   *
+   * @param text 文本内容
+   * @param offset 单词起始偏移量
+   * @param cursor 当前扫描位置
+   * @param state 当前状态
+   */
+  Token Walk(std::string_view text, size_t offset, size_t cursor,
+             uint32_t& state) const;
 };
 
 struct Lexicon::Term {
   std::string name{};             // 单词名称
   Regex pattern{};                // 单词正则表达式
   std::set<ContextID> entries{};  // 单词入口上下文，空表示任何上下文
+  std::string keyword{};         // 非空表示单词是由关键字表识别的字面量
 
   /**
    * 单词属性表
@@ -112,6 +220,40 @@ class Lexicon::Builder {
   Builder& Annotate(std::string const& term, std::string const& key,
                     nlohmann::json const& value);
 
+  /**
+   * 设置是否最小化状态机，默认最小化
+   *
+   * @param enable 是否最小化
+   */
+  Builder& Minimize(bool enable);
+
+  /**
+   * 设置是否自动识别关键字，默认不识别
+   *
+   * 能被另一个单词完整匹配的字面量单词称为关键字
+   * 关键字不进入状态机，而是在宿主单词匹配后查表识别，以缩小状态机
+   *
+   * @param enable 是否将全部符合条件的字面量单词作为关键字
+   */
+  Builder& Keywords(bool enable);
+
+  /**
+   * 声明一个单词为关键字，不符合条件时构建词法规则失败
+   *
+   * @param term 单词名称
+   */
+  Builder& Keyword(std::string const& term);
+
+  /**
+   * 设置惰性构造状态机的内存预算，默认为 0 即预先构造全部状态
+   *
+   * 惰性构造时只保留位置集合，扫描单词时才构造经过的状态并缓存
+   * 惰性的词法规则不能保存或用于生成代码
+   *
+   * @param budget 状态缓存的内存预算，单位为字节，超出时清空缓存
+   */
+  Builder& Lazy(size_t budget);
+
   /**
    * 构建词法规则
    */
@@ -126,9 +268,35 @@ class Lexicon::Builder {
     TooManyContexts() : Error("TooManyContexts") {}
   };
 
+  struct InvalidKeyword : public Error {
+    InvalidKeyword(std::string const& name)
+        : Error("Term {} cannot be recognized as a keyword", name) {}
+  };
+
+ protected:
+  /**
+   * 将符合条件的字面量单词标记为关键字
+   *
+   * 关键字的文本互不相同，且在关键字的全部上下文中都存在能完整匹配它的宿主单词
+   * 因此移除关键字后状态机的扫描路径不变，只有接受的单词需要查表修正
+   */
+  void ExtractKeywords();
+
+  /**
+   * 使用 Hopcroft 算法合并等价状态
+   *
+   * 接受不同单词的状态不会被合并，起始状态保持ID为0
+   */
+  void MinimizeStates();
+
  protected:
   Lex lex_;
-  Regex regex_;
+  RegexTree::Arena arena_;                 // 全部单词的正则表达式
+  std::map<SymbolID, uint32_t> patterns_;  // 单词 -> 正则表达式根节点
+  std::set<std::string> keywords_;         // 声明为关键字的单词
+  bool minimize_{true};
+  bool auto_keywords_{false};
+  size_t lazy_{};  // 惰性构造状态机的内存预算，为 0 表示预先构造
 };
 
 /**
@@ -146,6 +314,214 @@ struct Lexicon::State {
   std::map<char, StateID> transitions{};
 };
 
+/**
+ * 词法规则的稠密转移表
+ *
+ * 输入字节先映射为等价类，再按 [状态][等价类] 查找下一个状态
+ * 对所有状态都具有相同转移的字节被归入同一个等价类
+ *
+ * 随状态数增长的数组以视图的形式引用 storage 持有的内存，可以直接使用映射的镜像
+ */
+struct Lexicon::Table {
+  struct Skip;
+  struct Keyword;
+  static constexpr uint32_t kReject = -1U;  // 不接受任何单词
+
+  std::array<uint8_t, 256> classes{};       // 字节 -> 等价类
+  uint32_t width{};                         // 等价类数量，即转移表每行的宽度
+  std::span<uint32_t const> entries{};      // 上下文 -> 首状态
+  std::span<uint32_t const> transitions{};  // [状态 * width + 等价类] -> 状态
+  std::span<uint32_t const> accepts{};      // 状态 -> 接受的单词或 kReject
+  std::span<Skip const> skips{};            // 状态 -> 自循环跳跃规则
+  std::span<uint8_t const> hosts{};         // 状态 -> 是否可能接受关键字文本
+  std::vector<Keyword> keywords{};          // 散列槽 -> 关键字
+  std::vector<uint32_t> displacements{};    // 散列桶 -> 槽偏移量
+  uint64_t seed{};                          // 关键字完美散列的种子
+  size_t longest{};                         // 最长关键字的长度
+  std::shared_ptr<void const> storage{};    // 持有视图引用的内存
+
+  /**
+   * 获取上下文的首状态，上下文超出入口表时抛出 std::out_of_range
+   */
+  uint32_t Entry(ContextID context) const;
+
+  /**
+   * 修正扫描得到的单词
+   *
+   * 若单词文本是当前上下文中的关键字且关键字优先级更高，返回关键字
+   *
+   * @param word 单词文本
+   * @param term 状态机接受的单词
+   * @param context 上下文
+   */
+  SymbolID Resolve(std::string_view word, SymbolID term,
+                   ContextID context) const;
+
+  /**
+   * 计算关键字文本在指定种子下的散列值
+   */
+  static uint64_t Hash(std::string_view word, uint64_t seed);
+
+  /**
+   * 计算散列值在桶偏移量下对应的槽
+   */
+  static size_t Slot(uint64_t hash, uint32_t displacement, size_t slots);
+};
+
+/**
+ * 自循环状态的跳跃规则
+ *
+ * 注释、字符串和模板文本等单词的大部分字节都使状态转移回自身
+ * 若离开循环的字节或维持循环的字节足够少，扫描时可以成块查找循环的终点
+ */
+struct Lexicon::Table::Skip {
+  static constexpr size_t kMaxBytes = 8;
+
+  uint8_t count{};  // 关键字节数量，为 0 表示不跳跃
+  bool loop{};      // 关键字节维持循环，否则关键字节离开循环
+  std::array<char, kMaxBytes> bytes{};  // 关键字节
+  CharSet exits{};                      // 离开循环的全部字节
+
+  /**
+   * 从 cursor 开始查找第一个离开循环的字节，找不到则返回 size
+   *
+   * 支持 SSE2/AVX2 时按块比较，否则逐字节查找
+   */
+  size_t Find(char const* data, size_t cursor, size_t size) const;
+};
+
+/**
+ * 关键字散列槽
+ *
+ * 散列表在编译时为每个桶选取偏移量使全部关键字互不冲突，查找时只需比较一个槽
+ */
+struct Lexicon::Table::Keyword {
+  std::string text{};           // 关键字文本，为空表示空槽
+  uint64_t hash{};              // 关键字文本的散列值
+  SymbolID term{};              // 关键字单词ID
+  std::bitset<256> contexts{};  // 关键字生效的上下文
+};
+
+/**
+ * 多个上下文的乘积状态机
+ *
+ * 状态是各分量在词法状态机中所处状态的元组，入口状态相同的上下文共用一个分量
+ * 每读取一个字节只需查一次转移表，分量结束时依据其所处的词法状态确定单词
+ * 只剩一个分量时改为在词法状态机上继续扫描，以便使用自循环跳跃规则
+ */
+struct Lexicon::Product {
+  static constexpr size_t kMaxStates = 4096;  // 乘积状态数量的上限
+  static constexpr size_t kMaxArity = 16;     // 分量数量的上限
+
+  std::vector<ContextID> contexts{};    // 上下文列表
+  std::vector<uint32_t> components{};   // 上下文 -> 分量
+  uint32_t arity{};                     // 分量数量
+  std::vector<uint32_t> members{};      // [状态 * arity + 分量] -> 词法状态
+  std::vector<uint32_t> alive{};        // 状态 -> 尚未结束的分量数量
+  std::vector<uint32_t> transitions{};  // [状态 * width + 等价类] -> 状态
+};
+
+/**
+ * 惰性构造的状态机
+ *
+ * 状态即位置集合，扫描时首次经过某个转移才计算目标位置集合并驻留为状态
+ * 缓存的状态和转移超出内存预算时整体清空，之后按需重新构造
+ * 缓存由互斥锁保护，多个线程可以共用同一个词法规则
+ */
+struct Lexicon::Lazy {
+  static constexpr uint32_t kUnknown = -1U;          // 尚未计算的转移
+  static constexpr size_t kDefaultBudget = 8 << 20;  // 默认内存预算
+
+  /**
+   * 位置集合的散列函数
+   */
+  struct Hash {
+    size_t operator()(std::vector<uint32_t> const& positions) const {
+      size_t hash = 14695981039346656037UL;
+      for (auto const pos : positions) {
+        hash ^= pos;
+        hash *= 1099511628211UL;
+      }
+      return hash;
+    }
+  };
+
+  std::array<uint8_t, 256> classes{};              // 字节 -> 等价类
+  uint32_t width{};                                // 等价类数量
+  std::vector<std::bitset<256>> matches{};         // 位置 -> 匹配的等价类
+  std::vector<std::vector<uint32_t>> followpos{};  // 位置 -> 后继位置
+  std::vector<uint32_t> accepts{};                 // 位置 -> 接受的单词
+  std::vector<std::vector<uint32_t>> firstpos{};   // 上下文 -> 首位置集合
+  size_t budget{kDefaultBudget};                   // 内存预算，单位为字节
+  size_t flushes{};                                // 清空缓存的次数
+
+  /**
+   * 从指定位置扫描一个单词，语义与 Lexicon::Scan 一致，不处理关键字
+   *
+   * 先持共享锁沿已构造的转移扫描，多个线程可以同时进行
+   * 遇到尚未构造的状态或转移时，改为持独占锁从单词起点重新扫描并补全缓存
+   *
+   * @param text 文本内容
+   * @param offset 起始偏移量
+   * @param context 上下文
+   */
+  Token Scan(std::string_view text, size_t offset, ContextID context);
+
+  /**
+   * 当前缓存的状态数量，包含死状态
+   */
+  size_t States();
+
+ protected:
+  /**
+   * 沿缓存的状态机扫描一个单词
+   *
+   * build 为假时只读取缓存，遇到尚未构造的状态或转移时返回空
+   * build 为真时按需构造缺失的状态，调用者必须持有独占锁
+   */
+  std::optional<Token> Walk(std::string_view text, size_t offset,
+                            ContextID context, bool build);
+
+  /**
+   * 获取上下文的首状态
+   */
+  uint32_t Entry(ContextID context);
+
+  /**
+   * 获取状态在等价类上的转移，必要时构造目标状态
+   *
+   * 构造前若缓存超出预算则清空缓存，当前状态被重新驻留，因此 state 可能改变
+   */
+  uint32_t Next(uint32_t& state, uint8_t cls);
+
+  /**
+   * 驻留位置集合，返回对应的状态
+   */
+  uint32_t Intern(std::vector<uint32_t> const& positions);
+
+  /**
+   * 清空缓存，只保留死状态 0
+   */
+  void Flush();
+
+ protected:
+  std::shared_mutex mutex_{};
+  std::unordered_map<std::vector<uint32_t>, uint32_t, Hash> interned_{};
+  std::vector<std::vector<uint32_t>> sets_{};  // 状态 -> 位置集合
+  std::vector<uint32_t> transitions_{};        // [状态 * width + 类] -> 状态
+  std::vector<uint32_t> finals_{};             // 状态 -> 接受的单词或 kReject
+  std::vector<uint32_t> entries_{};            // 上下文 -> 首状态
+  size_t memory_{};                            // 缓存占用的内存估计
+};
+
+/**
+ * 扫描得到的单词
+ */
+struct Lexicon::Token {
+  SymbolID id{};    // 单词ID
+  size_t length{};  // 单词长度
+};
+
 }  // namespace alioth
 
 #endif
\ No newline at end of file
@@ -1,11 +1,16 @@
 #ifndef __ALIOTH_PARSER_H__
 #define __ALIOTH_PARSER_H__
 
+#include <functional>
+#include <string_view>
+#include <vector>
+
 #include "alioth/ast.h"
 #include "alioth/error.h"
 #include "alioth/generic.h"
 #include "alioth/lexicon.h"
 #include "alioth/syntax.h"
+#include "alioth/tokenizer.h"
 
 namespace alioth {
 
@@ -16,14 +21,77 @@ class Parser {
  public:
   struct Thread;
 
+  /**
+   * 单词缓存的命中统计，用于评估分析线路分叉时重复扫描的比例
+   */
+  struct Statistics {
+    size_t hits{};    // 命中缓存的扫描次数
+    size_t misses{};  // 实际扫描的次数
+  };
+
+  /**
+   * 词法扫描函数
+   *
+   * 参数为文本、扫描位置和上下文，语义与 Lexicon::Scan 一致
+   */
+  using Scanner =
+      std::function<Lexicon::Token(std::string_view, size_t, ContextID)>;
+
  public:
   Parser(Syntax syntax, Doc doc);
 
+  /**
+   * 替换词法扫描函数
+   *
+   * 默认使用词法规则的转移表扫描
+   * 生成的框架代码可以提供直接编码的扫描函数，它必须与语法规则的词法规则等价
+   *
+   * @param scanner 扫描函数，为空则恢复默认
+   */
+  void UseScanner(Scanner scanner);
+
+  /**
+   * 使用预先扫描的单词流代替词法扫描
+   *
+   * 单词流通常由 Tokenizer::All 并行扫描得到
+   * 在单词流之外的位置或其他上下文中扫描时，仍使用词法规则的转移表
+   *
+   * @param tokens 预先扫描的单词流
+   * @param context 扫描单词流所用的上下文
+   */
+  void UseTokens(std::shared_ptr<Tokenizer::Batch const> tokens,
+                 ContextID context = 0);
+
+  /**
+   * 设置是否丢弃被忽略的单词，默认保留
+   *
+   * 保留时被忽略的单词会在归约时填回句子，语法树可以还原完整的源码
+   * 丢弃时只在单一上下文中扫描到的被忽略单词不创建终结符，也不填回句子
+   * 适合只使用语法树属性的场景
+   *
+   * @param enable 是否丢弃
+   */
+  void DropIgnored(bool enable);
+
+  /**
+   * 使用指定的标识符驻留表，默认每个语法树使用独立的驻留表
+   *
+   * 多个文档共用驻留表时，相同的标识符在各语法树中具有相同的原子ID
+   *
+   * @param atoms 驻留表
+   */
+  void UseAtoms(std::shared_ptr<Atoms> atoms);
+
   /**
    * 解析源码
    */
   ASTRoot Parse();
 
+  /**
+   * 获取单词缓存的命中统计
+   */
+  Statistics const& Stats() const;
+
   struct ParseError : public Error {
     ParseError() : Error("Parse error occured") {}
   };
@@ -83,13 +151,46 @@ class Parser {
   void Crash();
 
   /**
-   * 从文档中扫描一个词法单元
+   * 从文档中扫描一个词法单元，并将分析线路移动到单词之后
+   *
+   * 相同位置和上下文的扫描结果被缓存，终结符由各分析线路各自创建
+   * 只有一条分析线路时，越过的单词不会再被读取，不写入缓存
    *
    * @param thread 当前分析线路
    * @param context 上下文
    */
   ASTTerm Scan(Thread& thread, ContextID context = 0);
 
+  /**
+   * 从指定位置扫描状态的多个上下文的词法单元
+   *
+   * 状态有乘积状态机时只读取一遍输入，否则逐个上下文扫描
+   *
+   * @param state 分析线路所处的状态
+   * @param offset 扫描位置
+   * @param contexts 上下文列表，是状态可能的上下文的子序列
+   * @param tokens 输出与上下文列表一一对应的单词
+   */
+  void Scan(StateID state, size_t offset,
+            std::vector<ContextID> const& contexts,
+            std::vector<Lexicon::Token>& tokens);
+
+  /**
+   * 查找缓存的扫描结果，未命中返回空指针
+   *
+   * @param offset 扫描位置
+   * @param context 上下文
+   */
+  Lexicon::Token const* Recall(size_t offset, ContextID context) const;
+
+  /**
+   * 为扫描得到的单词创建终结符
+   *
+   * @param offset 单词的偏移量
+   * @param token 扫描得到的单词
+   */
+  ASTTerm Term(size_t offset, Lexicon::Token const& token);
+
  protected:
   /**
    * 分析线路接受候选
@@ -99,9 +200,31 @@ class Parser {
    */
   using Candidate = std::pair<ASTNtrm, std::vector<ASTTerm>>;
 
+  /**
+   * 缓存的扫描结果
+   */
+  struct Memoized {
+    size_t offset{};         // 扫描位置
+    ContextID context{};     // 上下文
+    Lexicon::Token token{};  // 扫描得到的单词
+  };
+
+  /**
+   * 单词缓存，所有分析线路都越过的单词会被清除
+   *
+   * 只缓存扫描结果，终结符在归约时会被写入标注属性，每条分析线路各自创建
+   * 存活的条目只有分析线路所在位置附近的少数几个，顺序查找即可
+   */
+  using Memo = std::vector<Memoized>;
+
   ASTRoot root_;                       // 正在分析的语法树根
+  Scanner scanner_;                    // 词法扫描函数，为空则使用转移表
   std::vector<Thread> threads_;        // 分析线路
   std::vector<Candidate> candidates_;  // 已分析完毕的候选语法树
+  Memo memo_;                          // 单词缓存
+  bool drop_ignored_{false};           // 是否丢弃被忽略的单词
+  Statistics stats_;                   // 单词缓存的命中统计
+  std::vector<bool> interned_;         // 单词 -> 是否驻留其文本
 };
 
 struct Parser::Thread {
@@ -110,6 +233,14 @@ struct Parser::Thread {
   std::vector<AST> seens{};        // 已经识别的语法单元，按识别顺序排列
   std::vector<ASTTerm> ignores{};  // 被忽略的语法单元，按忽略顺序排列
   std::vector<AST> inputs{};       // 输入的语法单元，按读取顺序排列
+
+  /**
+   * 默认归约不查看展望符号，出错的输入可能先被归约
+   * 记录当前输入首次默认归约前的现场，出错时据此报告
+   */
+  bool deferred{};   // 当前输入是否触发过默认归约
+  StateID origin{};  // 首次默认归约前的状态
+  AST before{};      // 首次默认归约前最后识别的语法单元
 };
 
 }  // namespace alioth
@@ -1,8 +1,9 @@
 #ifndef __ALIOTH_REGEX_H__
 #define __ALIOTH_REGEX_H__
 
+#include <cstdint>
 #include <memory>
-#include <set>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <variant>
@@ -10,6 +11,7 @@
 
 #include "alioth/error.h"
 #include "alioth/generic.h"
+#include "alioth/strings.h"
 
 namespace alioth {
 
@@ -31,7 +33,6 @@ struct RegexTree {
   struct LeafNode;
   struct MonoNode;
   struct BinaryNode;
-  struct AcceptNode;
   struct CharNode;
   struct RangeNode;
   struct ConcatNode;
@@ -40,15 +41,9 @@ struct RegexTree {
   struct PositiveNode;
   struct OptionalNode;
   struct Unit;
-
-  using Leaf = std::shared_ptr<LeafNode>;
-  using Leafs = std::set<Leaf, std::owner_less<Leaf>>;
+  struct Arena;
 
   virtual ~RegexTree() = default;
-  virtual bool GetNullable() = 0;
-  virtual Leafs GetFirstpos() = 0;
-  virtual Leafs GetLastpos() = 0;
-  virtual void CalcFollowpos() = 0;
 
   /**
    * 编译正则表达式
@@ -75,20 +70,20 @@ struct RegexTree {
 
  protected:
   static std::string const& Operators();
-  static void ParseRange(std::vector<Unit>& input, size_t const start);
-  static void ParseChars(std::vector<Unit>& base);
-  static void Parse(std::vector<Unit>& base, size_t const start);
+  static Regex ParseRange(std::string const& pattern, size_t& offset);
+  static std::vector<Unit> ParseChars(std::string const& pattern);
+  static Regex Parse(std::vector<Unit> const& units, size_t& offset);
+  static Regex ParseTerm(std::vector<Unit> const& units, size_t& offset);
+  static Regex ParseFactor(std::vector<Unit> const& units, size_t& offset);
 };
 
-struct RegexTree::LeafNode : public RegexTree,
-                             public std::enable_shared_from_this<LeafNode> {
+struct RegexTree::LeafNode : public RegexTree {
+  virtual bool Match(char input) = 0;
+
   /**
-   * 后继位置集合
+   * 获取能被匹配的全部字符，字符 0 从不被匹配
    */
-  Leafs followpos_{};
-
-  void CalcFollowpos() final;
-  virtual bool Match(char input) = 0;
+  virtual CharSet Matches() = 0;
 };
 
 struct RegexTree::MonoNode : public RegexTree {
@@ -100,35 +95,14 @@ struct RegexTree::BinaryNode : public RegexTree {
   Regex right_{};
 };
 
-/**
- * 正则表达式中的接受节点
- */
-struct RegexTree::AcceptNode : public LeafNode {
-  SymbolID term_{};
-
-  bool GetNullable() override;
-  Leafs GetFirstpos() override;
-  Leafs GetLastpos() override;
-  bool Match(char input) override;
-
-  /**
-   * 为正则表达式标记接受节点
-   * @param regex 正则表达式
-   * @param term 接受的终结符 id
-   */
-  static std::shared_ptr<AcceptNode> On(Regex const& regex, SymbolID term);
-};
-
 /**
  * 单个字符节点
  */
 struct RegexTree::CharNode : public LeafNode {
   char ch_{};
 
-  bool GetNullable() override;
-  Leafs GetFirstpos() override;
-  Leafs GetLastpos() override;
   bool Match(char input) override;
+  CharSet Matches() override;
 };
 
 /**
@@ -151,27 +125,15 @@ struct RegexTree::CharNode : public LeafNode {
  */
 struct RegexTree::RangeNode : public LeafNode {
   bool includes_{};
-  std::set<char> set_{};
+  CharSet set_{};
 
-  bool GetNullable() override;
-  Leafs GetFirstpos() override;
-  Leafs GetLastpos() override;
   bool Match(char input) override;
+  CharSet Matches() override;
 };
 
-struct RegexTree::ConcatNode : public BinaryNode {
-  bool GetNullable() override;
-  Leafs GetFirstpos() override;
-  Leafs GetLastpos() override;
-  void CalcFollowpos() override;
-};
+struct RegexTree::ConcatNode : public BinaryNode {};
 
 struct RegexTree::UnionNode : public BinaryNode {
-  bool GetNullable() override;
-  Leafs GetFirstpos() override;
-  Leafs GetLastpos() override;
-  void CalcFollowpos() override;
-
   /**
    * 将两个正则表达式使用或运算连接
    *
@@ -181,26 +143,11 @@ struct RegexTree::UnionNode : public BinaryNode {
   static Regex Of(Regex const& lhs, Regex const& rhs);
 };
 
-struct RegexTree::KleeneNode : public MonoNode {
-  bool GetNullable() override;
-  Leafs GetFirstpos() override;
-  Leafs GetLastpos() override;
-  void CalcFollowpos() override;
-};
+struct RegexTree::KleeneNode : public MonoNode {};
 
-struct RegexTree::PositiveNode : public MonoNode {
-  bool GetNullable() override;
-  Leafs GetFirstpos() override;
-  Leafs GetLastpos() override;
-  void CalcFollowpos() override;
-};
+struct RegexTree::PositiveNode : public MonoNode {};
 
-struct RegexTree::OptionalNode : public MonoNode {
-  bool GetNullable() override;
-  Leafs GetFirstpos() override;
-  Leafs GetLastpos() override;
-  void CalcFollowpos() override;
-};
+struct RegexTree::OptionalNode : public MonoNode {};
 
 /** 泛型输入单元 */
 struct RegexTree::Unit : public std::variant<char, Regex> {
@@ -214,6 +161,83 @@ struct RegexTree::Unit : public std::variant<char, Regex> {
   Regex Node() const { return std::get<Regex>(*this); }
 };
 
+/**
+ * 正则表达式的扁平存储
+ *
+ * 语法树被展开为节点数组，节点之间以下标互相引用，子节点总是先于父节点
+ * 可空性、首位置和末位置在展开时自底向上计算一次并缓存在节点上
+ * 后继位置在展开时同步计算，不修改原语法树
+ *
+ * 多个正则表达式可以展开到同一个存储中，它们的位置ID统一编号
+ */
+struct RegexTree::Arena {
+  enum class Kind : uint8_t {
+    kLeaf,
+    kConcat,
+    kUnion,
+    kKleene,
+    kPositive,
+    kOptional,
+  };
+
+  /**
+   * 位置集合在 pool 中的区间
+   */
+  struct Span {
+    uint32_t offset{};
+    uint32_t size{};
+  };
+
+  struct Node {
+    Kind kind{};
+    uint32_t left{};   // 左子节点或唯一子节点，叶子节点为位置ID
+    uint32_t right{};  // 右子节点
+    bool nullable{};
+    Span firstpos{};
+    Span lastpos{};
+  };
+
+  struct Position {
+    CharSet chars{};                    // 位置能匹配的字节
+    std::vector<uint32_t> followpos{};  // 后继位置，升序排列
+    std::optional<SymbolID> accept{};   // 接受位置对应的单词
+  };
+
+  std::vector<Node> nodes{};
+  std::vector<Position> positions{};
+  std::vector<uint32_t> pool{};  // 全部节点的首位置和末位置
+
+  /**
+   * 展开一个正则表达式，返回其根节点
+   *
+   * @param regex 正则表达式
+   */
+  uint32_t Add(Regex const& regex);
+
+  /**
+   * 为已展开的正则表达式添加接受位置，返回接受位置ID
+   *
+   * @param root 正则表达式根节点
+   * @param term 接受的单词ID
+   */
+  uint32_t Accept(uint32_t root, SymbolID term);
+
+  /**
+   * 获取位置集合的内容
+   */
+  uint32_t const* begin(Span span) const { return pool.data() + span.offset; }
+  uint32_t const* end(Span span) const {
+    return pool.data() + span.offset + span.size;
+  }
+
+ protected:
+  uint32_t Flatten(RegexTree& node);
+  uint32_t Union(RegexTree& node);
+  uint32_t Leaf(LeafNode& leaf);
+  Span Merge(Span lhs, Span rhs);
+  void Follow(Span from, Span to);
+};
+
 /**
  * 正则表达式字面语法
  */
@@ -1,6 +1,8 @@
 #ifndef __ALIOTH_STRINGS_H__
 #define __ALIOTH_STRINGS_H__
 
+#include <bitset>
+#include <cstdint>
 #include <set>
 #include <string>
 
@@ -8,6 +10,38 @@
 
 namespace alioth {
 
+/**
+ * 字符集合
+ *
+ * 以256位的位图表示，第 i 位对应无符号值为 i 的字符
+ * 并集、交集和补集分别使用位图的 |、& 和 ~ 运算
+ */
+struct CharSet : public std::bitset<256> {
+  using bitset::bitset;
+  CharSet(std::bitset<256> const& bits) : bitset(bits) {}
+
+  /**
+   * 构造包含字符串中全部字符的集合
+   */
+  explicit CharSet(std::string const& chars);
+
+  /**
+   * 构造包含一段字符范围的集合，与 Chars::Range 一致按有符号字符比较
+   */
+  static CharSet Range(char from, char to);
+
+  bool Contains(char ch) const { return test(static_cast<uint8_t>(ch)); }
+  CharSet& Insert(char ch) {
+    set(static_cast<uint8_t>(ch));
+    return *this;
+  }
+
+  /**
+   * 获取集合中无符号值最小的字符，集合为空时返回 256
+   */
+  size_t First() const;
+};
+
 struct Chars {
   static std::string Range(char from, char to);
 
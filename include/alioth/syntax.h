@@ -1,10 +1,16 @@
 #ifndef __ALIOTH_SYNTAX_H__
 #define __ALIOTH_SYNTAX_H__
 
+#include <filesystem>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
+#include <span>
+#include <string_view>
+#include <unordered_map>
 
 #include "alioth/error.h"
 #include "alioth/generic.h"
@@ -21,8 +27,8 @@ using Syntax = std::shared_ptr<Syntactic>;
 
 struct Syntactic {
   struct LR0Item;
-  struct LR1Item;
   struct State;
+  struct Table;
   struct Formula;
   class Builder;
 
@@ -32,6 +38,11 @@ struct Syntactic {
   std::vector<State> states;       // 语法分析状态机
   std::set<SymbolID> ignores;      // 语法分析过程中应当忽略的符号
 
+  /**
+   * 由状态表编译得到的压缩动作表，语法分析时使用
+   */
+  std::shared_ptr<Table const> table{};
+
   /**
    * 获取语言名称
    *
@@ -67,6 +78,27 @@ struct Syntactic {
    */
   bool IsIgnored(SymbolID id) const;
 
+  /**
+   * 判断符号是否为编译时合成的非终结符
+   *
+   * 合成的非终结符包括增广文法的起始符号和可省符号的辅助非终结符
+   * 它们的名称带有 kSynthetic 标记，文法中的标识符不会包含该标记
+   * 生成代码时应当跳过这些符号
+   *
+   * @param id 符号ID
+   */
+  bool IsSynthetic(SymbolID id) const;
+
+  static constexpr char kSynthetic = '\'';  // 合成非终结符的名称标记
+
+  /**
+   * 依据状态表编译压缩动作表
+   *
+   * 状态表是语法规则的编辑和存储形式，语法分析只使用压缩动作表
+   * 修改状态表后需要重新编译
+   */
+  void Compile();
+
   /**
    * 打印语法规则
    * 可以使用 https://jsmachines.sourceforge.net/machines/lalr1.html 查看
@@ -94,12 +126,69 @@ struct Syntactic {
    */
   nlohmann::json Store() const;
 
+  /**
+   * 将语法规则保存为不含状态表的JSON格式
+   *
+   * 从镜像查看的语法规则没有状态表，只能保存这部分内容
+   */
+  nlohmann::json StoreMeta() const;
+
   /**
    * 从JSON格式加载语法规则
    *
    * @param json JSON格式的语法规则
    */
   static Syntax Load(nlohmann::json const& json);
+
+  /**
+   * 将语法规则保存为二进制镜像
+   *
+   * 镜像包含动作表、转移表和产生式等语法分析需要的全部数据，不包含状态表
+   * 各段以相对镜像起点的偏移量定位，映射到任意地址都可以直接使用
+   */
+  std::string Image() const;
+
+  /**
+   * 直接在二进制镜像上使用语法规则，不复制动作表和转移表
+   *
+   * 得到的语法规则没有状态表，可以用于语法分析，但不能保存或用于生成代码
+   * 单词表和产生式等元数据仍需解码，乘积状态机在首次扫描多个上下文时构造
+   * 镜像的起点需要按 8 字节对齐
+   *
+   * @param image 二进制镜像
+   * @param owner 持有镜像内存的对象，语法规则存活期间保持镜像有效
+   */
+  static Syntax View(std::span<char const> image,
+                     std::shared_ptr<void const> owner = nullptr);
+
+  /**
+   * 将二进制镜像文件映射到内存并使用，语义与 View 一致
+   *
+   * @param path 镜像文件路径
+   */
+  static Syntax Map(std::filesystem::path const& path);
+
+  /**
+   * 判断数据是否以二进制镜像的魔数开头
+   *
+   * @param data 待判断的数据
+   */
+  static bool IsImage(std::string_view data);
+
+  struct TooManySymbols : public Error {
+    TooManySymbols(size_t symbols)
+        : Error("Too many symbols to compile the action table: {}", symbols) {}
+  };
+
+  struct InvalidImage : public Error {
+    InvalidImage(std::string const& reason)
+        : Error("Invalid syntax image: {}", reason) {}
+  };
+
+  struct NotMaterialized : public Error {
+    NotMaterialized()
+        : Error("Syntax viewed from an image has no state table") {}
+  };
 };
 
 struct Syntactic::LR0Item {
@@ -110,15 +199,6 @@ struct Syntactic::LR0Item {
   bool operator==(LR0Item const& other) const;
 };
 
-struct Syntactic::LR1Item {
-  FormulaID formula{};
-  size_t point{};
-  SymbolID ahead{};
-
-  bool operator<(LR1Item const& other) const;
-  bool operator==(LR1Item const& other) const;
-};
-
 /**
  * 语法分析器状态
  */
@@ -128,6 +208,77 @@ struct Syntactic::State {
   std::set<ContextID> contexts{};          // 可能的上下文
 };
 
+/**
+ * 语法分析器的压缩动作表
+ *
+ * 各状态的动作行按偏移量交错存放在同一个动作表中，空槽可以被其他行占用
+ * 内容不同的行偏移量互不相同，因此检查表只需记录槽所属的符号
+ *
+ * 若状态没有终结符的移进规则，且只能归约同一个产生式
+ * 则该产生式作为状态的默认归约，不必查看展望符号，其归约规则也不进入动作表
+ */
+struct Syntactic::Table {
+  static constexpr uint32_t kNone = -1U;         // 没有动作
+  static constexpr uint32_t kReduce = 1U << 31;  // 归约动作标记
+  static constexpr uint16_t kEmpty = -1;         // 空槽
+
+  std::span<uint32_t const> bases{};      // 状态 -> 动作行的偏移量
+  std::span<uint32_t const> defaults{};   // 状态 -> 默认归约的产生式或 kNone
+  std::span<uint16_t const> checks{};     // 槽 -> 槽所属的符号或 kEmpty
+  std::span<uint32_t const> actions{};    // 槽 -> 移进目标状态或带标记的产生式
+  std::span<uint32_t const> scopes{};     // 状态 -> 上下文列表的起点
+  std::span<ContextID const> contexts{};  // 各状态可能的上下文，依次存放
+
+  /**
+   * 持有以上数组的内存，可能是编译得到的缓冲区，也可能是映射的镜像
+   */
+  std::shared_ptr<void const> storage{};
+
+  /**
+   * 乘积状态机的缓存，由 Join 在首次扫描多个上下文时填充
+   */
+  mutable std::mutex joining{};
+  mutable std::vector<std::shared_ptr<Lexicon::Product const>>
+      products{};  // 状态 -> 乘积状态机
+  mutable std::map<std::vector<ContextID>,
+                   std::shared_ptr<Lexicon::Product const>>
+      joined{};  // 上下文列表 -> 乘积状态机
+
+  /**
+   * 查找状态在符号上的动作，没有动作时返回 kNone
+   *
+   * 归约动作带有 kReduce 标记，默认归约不在查找范围内
+   *
+   * @param state 状态ID
+   * @param symbol 符号ID
+   */
+  uint32_t Find(StateID state, SymbolID symbol) const;
+
+  /**
+   * 获取状态可能的上下文，按上下文ID从小到大排列
+   *
+   * @param state 状态ID
+   */
+  std::span<ContextID const> Contexts(StateID state) const;
+
+  /**
+   * 获取状态的上下文的乘积状态机，首次获取时构造
+   *
+   * 上下文列表相同的状态共用同一个，可以被多个分析器同时调用
+   * 上下文不足两个或乘积状态过多时返回空指针，逐个上下文扫描即可
+   *
+   * @param state 状态ID
+   * @param lex 词法规则，必须已经编译出转移表
+   */
+  std::shared_ptr<Lexicon::Product const> Join(StateID state,
+                                               Lexicon const& lex) const;
+
+  /**
+   * 压缩动作表占用的字节数
+   */
+  size_t Bytes() const;
+};
+
 /**
  * 产生式
  */
@@ -188,6 +339,9 @@ class Syntactic::Builder {
   class FormulaBuilder;
   friend class FormulaBuilder;
   struct NtrmDef;
+  struct Suffix;
+  struct Expansion;
+  struct Draft;
 
  public:
   /**
@@ -239,10 +393,37 @@ class Syntactic::Builder {
   Builder& Ignore(std::string const& name);
 
   /**
-   * 创建LALR(1)语法规则
+   * 设置是否合并同心状态，默认不合并
+   *
+   * 不合并时构造规范LR(1)状态机
+   * 合并时将LR(0)核心相同的状态合并，得到LALR(1)状态机，状态数量通常少得多
+   * 若合并引入了归约-归约冲突，则放弃合并，保留LR(1)状态机
+   *
+   * @param enable 是否合并
+   */
+  Builder& Lalr(bool enable);
+
+  /**
+   * 设置构造状态机的线程数，默认为 1
+   *
+   * 多个线程同时展开待处理的状态，构造完成后按单线程的展开顺序重新编号
+   * 因此构造结果与线程数无关
+   *
+   * @param jobs 线程数，为 0 时使用硬件线程数
+   */
+  Builder& Jobs(size_t jobs);
+
+  /**
+   * 创建LR(1)语法规则，若开启合并则为LALR(1)语法规则
    */
   Syntax Build();
 
+  /**
+   * 开启合并但合并会引入归约-归约冲突时，Build 保留LR(1)状态机
+   * 此后返回冲突的符号和产生式，其余情况返回空
+   */
+  std::optional<std::string> const& MergeConflict() const;
+
   struct UnknownTermError : public Error {
     UnknownTermError(std::string const& name)
         : Error("unknown terminal symbol {}", name) {}
@@ -264,40 +445,148 @@ class Syntactic::Builder {
                 fmt::join(ntrms, ", ")) {}
   };
 
+  /**
+   * 冲突异常的消息包含冲突的产生式和状态
+   * heads 记录冲突涉及的产生式头，便于调用者调整文法后重试
+   */
   struct ReduceReduceConflict : public Error {
-    ReduceReduceConflict() : Error("reduce-reduce conflict detected") {}
+    ReduceReduceConflict(std::string const& detail,
+                         std::set<std::string> heads)
+        : Error("reduce-reduce conflict detected\n{}", detail),
+          heads{std::move(heads)} {}
+    std::set<std::string> heads{};
   };
 
   struct ShiftReduceConflict : public Error {
-    ShiftReduceConflict() : Error("shift-reduce conflict detected") {}
+    ShiftReduceConflict(std::string const& detail, std::set<std::string> heads)
+        : Error("shift-reduce conflict detected\n{}", detail),
+          heads{std::move(heads)} {}
+    std::set<std::string> heads{};
   };
 
  protected:
+  /**
+   * 展望符号集合，按终结符ID索引的位集
+   */
+  using Lookahead = std::vector<uint64_t>;
+
+  /**
+   * LR(1)项目集，每个LR(0)项目携带全部展望符号
+   */
+  using ItemSet = std::map<LR0Item, Lookahead>;
+
+  /**
+   * 项目集的核心，即项目集闭包之前的项目，按项目顺序排列
+   *
+   * 除起始状态外，核心项目的点都不在产生式开头，因此核心唯一确定状态
+   */
+  using Kernel = std::vector<std::pair<LR0Item, Lookahead>>;
+
+  /**
+   * 项目集核心的散列函数，只依赖项目内容，结果与构建过程无关
+   */
+  struct KernelHash {
+    size_t operator()(Kernel const& kernel) const;
+  };
+
+  /**
+   * 计算非终结符的可空性、FIRST集合和FOLLOW集合
+   *
+   * 三者都是依赖图上的不动点，以工作表求解，非终结符只在其依赖变化后重新计算
+   */
   void CalculateNullable();
   void CalculateFirst();
   void CalculateFollow();
+  void CalculateSuffixes();
+  void CalculateExpansions();
   void CalculateStates();
 
-  std::set<LR1Item> Closure(std::set<LR1Item> items);
-  std::set<LR1Item> Goto(std::set<LR1Item> const& items, SymbolID symbol);
-  std::set<SymbolID> Alphabet(std::set<LR1Item> const& items);
+  /**
+   * 合并LR(0)核心相同的状态，起始状态保持ID为0
+   *
+   * 同心状态的移进符号相同，合并只可能引入归约-归约冲突
+   * 若引入冲突则不做任何修改，冲突记录在 merge_conflict_ 中
+   *
+   * @param kernels 状态 -> 项目集核心
+   */
+  void MergeStates(std::vector<Kernel const*> const& kernels);
+
+  /**
+   * 展开状态草稿，计算其转移和可归约的项目
+   *
+   * 可能被多个线程同时调用，只读取构建器的数据
+   *
+   * @param draft 状态草稿
+   * @param intern 查找或登记项目集核心，返回核心的草稿编号
+   */
+  void Expand(Draft& draft, std::function<size_t(Kernel&&)> const& intern);
+
+  /**
+   * 计算项目集核心的闭包
+   *
+   * 核心项目点后的每个非终结符按其闭包模板展开，不需要迭代到不动点
+   */
+  ItemSet Closure(Kernel const& kernel);
+  Kernel Goto(ItemSet const& items, SymbolID symbol);
+  std::set<SymbolID> Alphabet(ItemSet const& items);
 
   /**
    * 获取非终结符 ID，必要时创建新符号
+   *
+   * 符号名经 symbols_ 查找，不遍历单词表和非终结符表
    */
   SymbolID TouchNtrm(std::string const& name);
 
  protected:
   Syntax syntax_;
   std::map<SymbolID, NtrmDef> ntrms_;
+  std::unordered_map<std::string, SymbolID> symbols_;  // 符号名 -> 符号ID
+  bool lalr_{false};  // 是否合并同心状态
+  std::optional<std::string> merge_conflict_{};  // 放弃合并的原因
+  size_t jobs_{1};    // 构造状态机的线程数
+
+  /**
+   * 产生式 -> 点 -> 点之后符号串的FIRST集合
+   */
+  std::vector<std::vector<Suffix>> suffixes_;
+};
+
+/**
+ * 点之后的符号串
+ */
+struct Syntactic::Builder::Suffix {
+  Lookahead first{};  // 符号串的FIRST集合
+  bool nullable{};    // 符号串是否可空
+};
+
+/**
+ * 构造中的状态，按登记顺序编号，构造完成后重新编号
+ */
+struct Syntactic::Builder::Draft {
+  Kernel const* kernel{};                                  // 项目集核心
+  std::vector<std::pair<SymbolID, size_t>> gotos{};        // 符号 -> 草稿
+  std::vector<std::pair<FormulaID, Lookahead>> reduces{};  // 可归约的产生式
+};
+
+/**
+ * 闭包模板的一项
+ *
+ * 展开非终结符 A 时，闭包中 ntrm 的全部产生式以点开头
+ * 它们的展望符号为 spontaneous，若 propagate 为真还包括 A 项目的展望符号
+ */
+struct Syntactic::Builder::Expansion {
+  SymbolID ntrm{};          // 闭包中出现的非终结符
+  Lookahead spontaneous{};  // 闭包内部产生的展望符号
+  bool propagate{};         // 是否继承被展开项目的展望符号
 };
 
 struct Syntactic::Builder::NtrmDef {
   std::string name{};
   std::set<size_t> formulas{};
   bool nullable{};
-  std::set<SymbolID> first{};
-  std::set<SymbolID> follow{};
+  Lookahead first{};                    // FIRST集合，按终结符ID索引的位集
+  Lookahead follow{};                   // FOLLOW集合，按终结符ID索引的位集
+  std::vector<Expansion> expansions{};  // 闭包模板，包括非终结符自身
 };
 
 /**
@@ -0,0 +1,119 @@
+#ifndef __ALIOTH_TOKENIZER_H__
+#define __ALIOTH_TOKENIZER_H__
+
+#include <functional>
+
+#include "alioth/document.h"
+#include "alioth/generic.h"
+#include "alioth/lexicon.h"
+
+namespace alioth {
+
+/**
+ * 单词流扫描器
+ *
+ * 不经过语法分析，只依据词法规则将文档切分为单词，供语法高亮、索引等场景使用
+ * 单词分批写入可复用的缓冲区，扫描过程不为单个单词分配内存
+ */
+class Tokenizer {
+ public:
+  struct Batch;
+  static constexpr size_t kBatchSize = 4096;
+  static constexpr size_t kChunkSize = 1 << 20;  // 并行扫描分块的最小字节数
+
+  /**
+   * 上下文切换函数
+   *
+   * 参数为刚扫描的单词和扫描它的上下文，返回扫描下一个单词的上下文
+   */
+  using Follow = std::function<ContextID(SymbolID, ContextID)>;
+
+ public:
+  /**
+   * 构造单词流扫描器
+   *
+   * @param lex 词法规则
+   * @param doc 文档
+   * @param context 起始上下文
+   */
+  Tokenizer(Lex lex, Doc doc, ContextID context = 0);
+
+  /**
+   * 设置上下文切换函数，默认始终使用起始上下文
+   *
+   * @param follow 上下文切换函数
+   */
+  Tokenizer& Switch(Follow follow);
+
+  /**
+   * 扫描下一批单词，缓冲区原有内容被覆盖
+   *
+   * 到达文档末尾时返回0，kEOF 不写入缓冲区，无法识别的文本写入 kERR
+   *
+   * @param batch 单词缓冲区
+   * @param capacity 本批最多扫描的单词数量
+   * @return 本批扫描的单词数量
+   */
+  size_t Next(Batch& batch, size_t capacity = kBatchSize);
+
+  /**
+   * 并行扫描文档余下的全部单词，缓冲区原有内容被覆盖
+   *
+   * 文档被切分为若干分块，每个分块由一个线程从块首开始推测扫描
+   * 之后依次从跨越分块边界的单词末尾重新扫描，直到与下一个分块的推测结果对齐
+   * 设置了上下文切换函数时无法推测分块起点的上下文，退化为顺序扫描
+   *
+   * @param batch 单词缓冲区
+   * @param jobs 分块数量，为 0 则依据硬件并发数和文档大小决定
+   * @return 扫描的单词数量
+   */
+  size_t All(Batch& batch, size_t jobs = 0);
+
+  /**
+   * 是否已经到达文档末尾
+   */
+  bool Done() const;
+
+ protected:
+  /**
+   * 扫描一个单词追加到缓冲区，并依据切换函数更新上下文
+   */
+  void Step(Batch& batch);
+
+ protected:
+  Lex lex_;            // 词法规则
+  Doc doc_;            // 文档
+  ContextID context_;  // 当前上下文
+  size_t offset_{};    // 当前扫描位置
+  Follow follow_{};    // 上下文切换函数
+};
+
+/**
+ * 单词缓冲区，以并列数组存储单词的ID、偏移量和长度
+ */
+struct Tokenizer::Batch {
+  std::vector<SymbolID> ids{};    // 单词ID
+  std::vector<size_t> offsets{};  // 单词偏移量
+  std::vector<size_t> lengths{};  // 单词长度
+
+  /**
+   * 缓冲区中的单词数量
+   */
+  size_t Size() const;
+
+  /**
+   * 查找从指定偏移量开始的单词下标，不存在则返回 Size()
+   *
+   * @param offset 单词偏移量
+   */
+  size_t Find(size_t offset) const;
+
+  /**
+   * 清空缓冲区，保留已分配的内存
+   */
+  void Clear();
+};
+
+}  // namespace alioth
+
+#endif
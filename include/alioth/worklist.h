@@ -0,0 +1,94 @@
+#ifndef __ALIOTH_WORKLIST_H__
+#define __ALIOTH_WORKLIST_H__
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <utility>
+#include <vector>
+
+namespace alioth {
+
+/**
+ * 依赖图上的工作表求解器
+ *
+ * 用于求解只增不减的不动点，例如可空性、FIRST 集合和 FOLLOW 集合
+ * 初始时全部节点待计算，节点的值发生变化时，依赖它的节点重新计算
+ * 每个节点只在依赖的节点变化后重新计算，不需要反复遍历全部节点
+ *
+ * 初始的计算顺序为依赖图的拓扑序，依赖图无环时每个节点只计算一次
+ */
+class Worklist {
+ public:
+  /**
+   * @param size 节点数量，节点按 [0, size) 编号
+   */
+  explicit Worklist(size_t size) : dependents_(size), queued_(size, true) {}
+
+  /**
+   * 声明节点 node 的值依赖节点 on 的值
+   */
+  void Depend(size_t node, size_t on) { dependents_.at(on).push_back(node); }
+
+  /**
+   * 迭代到不动点
+   *
+   * @param update 重新计算节点的值，返回值是否发生变化
+   */
+  template <typename Update>
+  void Solve(Update&& update) {
+    auto const order = Order();
+    queue_.assign(order.begin(), order.end());
+    while (!queue_.empty()) {
+      auto const node = queue_.front();
+      queue_.pop_front();
+      queued_[node] = false;
+      if (!update(node)) continue;
+
+      for (auto const dependent : dependents_[node]) {
+        if (queued_[dependent]) continue;
+        queued_[dependent] = true;
+        queue_.push_back(dependent);
+      }
+    }
+  }
+
+ private:
+  /**
+   * 依赖图的逆后序，节点排在它依赖的节点之后，环上的节点顺序任意
+   */
+  std::vector<size_t> Order() const {
+    std::vector<size_t> order;
+    std::vector<bool> visited(dependents_.size());
+    std::vector<std::pair<size_t, size_t>> stack;  // 节点, 下一个待访问的后继
+    for (auto root = 0UL; root < dependents_.size(); ++root) {
+      if (visited[root]) continue;
+      visited[root] = true;
+      stack.emplace_back(root, 0);
+      while (!stack.empty()) {
+        auto const [node, next] = stack.back();
+        if (next == dependents_[node].size()) {
+          order.push_back(node);
+          stack.pop_back();
+          continue;
+        }
+
+        ++stack.back().second;
+        auto const dependent = dependents_[node][next];
+        if (visited[dependent]) continue;
+        visited[dependent] = true;
+        stack.emplace_back(dependent, 0);
+      }
+    }
+    std::reverse(order.begin(), order.end());
+    return order;
+  }
+
+  std::vector<std::vector<size_t>> dependents_;  // 节点 -> 依赖它的节点
+  std::vector<bool> queued_;                     // 节点是否在队列中
+  std::deque<size_t> queue_;                     // 待计算的节点
+};
+
+}  // namespace alioth
+
+#endif
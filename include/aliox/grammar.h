@@ -32,8 +32,15 @@ struct Grammar {
 
   /**
    * 编译文法定义为语法规则
+   *
+   * 编译成功但结果与选项不符时，例如 lalr 选项因冲突保留了LR(1)状态机，
+   * 将说明追加到 notes，由调用者决定是否展示
+   *
+   * @param jobs 构造语法分析状态机的线程数，为 0 时使用硬件线程数
+   * @param notes 接收编译说明，为空时丢弃
    */
-  Syntax Compile() const;
+  Syntax Compile(size_t jobs = 1,
+                 std::vector<std::string>* notes = nullptr) const;
 
   /**
    * 从文法源码加载文法定义
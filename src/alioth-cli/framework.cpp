@@ -1,6 +1,9 @@
 #include "alioth-cli/framework.h"
 
+#include <algorithm>
 #include <fstream>
+#include <map>
+#include <set>
 
 #include "alioth-cli/syntax.h"
 #include "alioth/alioth.h"
@@ -10,24 +13,200 @@
 #include "aliox/grammar.h"
 #include "aliox/skeleton.h"
 #include "aliox/template.h"
+#include "fmt/ranges.h"
+
+namespace {
+
+/**
+ * 将文本转义为 C++ 字符串字面量的内容
+ */
+std::string EscapeOf(std::string const& text) {
+  std::string escaped;
+  for (auto const ch : text) {
+    auto const byte = static_cast<unsigned char>(ch);
+    if (ch == '"' || ch == '\\') {
+      escaped += '\\';
+      escaped += ch;
+    } else if (byte < 0x20 || byte >= 0x7f) {
+      escaped += fmt::format("\\{:03o}", byte);
+    } else {
+      escaped += ch;
+    }
+  }
+  return escaped;
+}
+
+/**
+ * 将名称转换为合法的 C++ 标识符
+ *
+ * 关键字和标准库中常见的宏不能作为标识符，在末尾追加下划线
+ */
+std::string IdentifierOf(std::string const& name) {
+  static std::set<std::string> const reserved{
+      "alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand", "bitor",
+      "bool", "break", "case", "catch", "char", "char8_t", "char16_t",
+      "char32_t", "class", "compl", "concept", "const", "consteval",
+      "constexpr", "constinit", "const_cast", "continue", "co_await",
+      "co_return", "co_yield", "decltype", "default", "delete", "do", "double",
+      "dynamic_cast", "else", "enum", "explicit", "export", "extern", "false",
+      "float", "for", "friend", "goto", "if", "inline", "int", "long",
+      "mutable", "namespace", "new", "noexcept", "not", "not_eq", "nullptr",
+      "operator", "or", "or_eq", "private", "protected", "public", "register",
+      "reinterpret_cast", "requires", "return", "short", "signed", "sizeof",
+      "static", "static_assert", "static_cast", "struct", "switch", "template",
+      "this", "thread_local", "throw", "true", "try", "typedef", "typeid",
+      "typename", "union", "unsigned", "using", "virtual", "void", "volatile",
+      "wchar_t", "while", "xor", "xor_eq",
+      "NULL", "EOF", "errno", "assert", "stdin", "stdout", "stderr", "offsetof",
+  };
+  return reserved.count(name) ? name + "_" : name;
+}
+
+/**
+ * 为直接编码的词法扫描器准备模型
+ *
+ * 每个状态按转移目标将字节分组，字节最多的分组作为 default 分支
+ * 转移目标为 0 的分组表示扫描在此字节结束
+ * 关键字按长度分组，只在关键字文本可能到达的状态接受单词后查找
+ *
+ * @param lex 词法规则
+ */
+nlohmann::json ScannerOf(alioth::Lex const& lex) {
+  auto const& table = *lex->table;
+  nlohmann::json scanner;
+
+  scanner["entries"] = nlohmann::json::array();
+  for (auto ctx = 0UL; ctx < table.entries.size(); ++ctx) {
+    if (table.entries[ctx] == 0) continue;
+    scanner["entries"].push_back({
+        {"context", ctx},
+        {"state", table.entries[ctx]},
+    });
+  }
+
+  scanner["states"] = nlohmann::json::array();
+  for (auto state = 1UL; state < table.accepts.size(); ++state) {
+    auto const row = table.transitions.data() + state * table.width;
+    std::map<uint32_t, std::vector<int>> groups;
+    for (auto c = 0; c < 256; ++c) groups[row[table.classes[c]]].push_back(c);
+
+    auto const largest = std::max_element(
+        groups.begin(), groups.end(), [](auto const& lhs, auto const& rhs) {
+          return lhs.second.size() < rhs.second.size();
+        });
+
+    nlohmann::json s;
+    s["id"] = state;
+    if (table.accepts[state] != alioth::Lexicon::Table::kReject) {
+      s["accepts"] = table.accepts[state];
+    }
+    if (table.hosts[state]) s["keyword"] = true;
+    s["default"] = largest->first;
+    s["cases"] = nlohmann::json::array();
+    for (auto const& [target, bytes] : groups) {
+      if (target == largest->first) continue;
+      s["cases"].push_back({{"target", target}, {"bytes", bytes}});
+    }
+    scanner["states"].push_back(s);
+  }
+
+  std::map<size_t, nlohmann::json> lengths;
+  for (auto id = 0UL; id < lex->terms.size(); ++id) {
+    auto const& term = lex->terms.at(id);
+    if (term.keyword.empty()) continue;
+
+    std::vector<std::string> guards;
+    for (auto const ctx : term.entries) {
+      guards.push_back(fmt::format("context == {}", static_cast<int>(ctx)));
+    }
+    lengths[term.keyword.size()].push_back({
+        {"id", id},
+        {"literal", EscapeOf(term.keyword)},
+        {"guard", fmt::format("{}", fmt::join(guards, " || "))},
+    });
+  }
+
+  scanner["keywords"] = nlohmann::json::array();
+  for (auto const& [size, keywords] : lengths) {
+    scanner["keywords"].push_back({{"size", size}, {"keywords", keywords}});
+  }
+
+  return scanner;
+}
+
+/**
+ * 将语法规则的二进制镜像排版为 C++ 数组初始化列表的各行
+ *
+ * @param syntax 语法规则
+ */
+std::vector<std::string> ImageOf(alioth::Syntax const& syntax) {
+  auto const image = syntax->Image();
+  std::vector<std::string> rows;
+  for (auto offset = 0UL; offset < image.size(); offset += 16) {
+    std::vector<int> bytes;
+    for (auto i = offset; i < std::min(offset + 16, image.size()); ++i) {
+      bytes.push_back(static_cast<unsigned char>(image[i]));
+    }
+    rows.push_back(fmt::format("{}", fmt::join(bytes, ", ")));
+  }
+  return rows;
+}
+
+}  // namespace
 
 int Framework::Run() {
-  using namespace alioth;
+  auto const threads = ::Syntax::JobsOf(jobs, 1);
+  if (!threads) return 1;
+  auto syntax = ::Syntax::Load(gpath->Value(), *threads, !no_cache->HasValue());
+  try {
+    Generate(syntax, opath->Value());
+  } catch (alioth::Lexicon::NotMaterialized const& e) {
+    fmt::println(stderr, "error: {}", e.what());
+    return 1;
+  }
+  return 0;
+}
 
-  auto syntax = ::Syntax::Load(gpath->Value());
+void Framework::Generate(alioth::Syntax const& syntax,
+                         std::filesystem::path const& output) {
+  using namespace alioth;
 
   Template::Map model;
   auto lang = syntax->Lang();
   model["lang"] = lang;
 
-  auto jsyntax = syntax->Store();
-  auto binary = nlohmann::json::to_cbor(jsyntax);
-  jsyntax["binary"] = binary;
+  auto jsyntax = syntax->StoreMeta();
+  jsyntax["image"] = ImageOf(syntax);
   model["syntax"] = Template::Value::FromJson(jsyntax);
+  model["scanner"] = Template::Value::FromJson(ScannerOf(syntax->lex));
+
+  /**
+   * 非终结符ID，跳过增广文法的起始符号和可省符号的辅助非终结符
+   * 常量名和节点类型名由驼峰形式的名称构成，不同的非终结符不能重名
+   */
+  auto jntrms = nlohmann::json::array();
+  std::map<std::string, std::string> identifiers;  // 驼峰形式 -> 非终结符
+  for (auto i = 0UL; i < syntax->ntrms.size(); ++i) {
+    auto const id = syntax->lex->terms.size() + i;
+    if (syntax->IsSynthetic(id)) continue;
+
+    auto const& name = syntax->ntrms[i];
+    auto const identifier = Strings::Camelcase(name);
+    auto const [it, fresh] = identifiers.emplace(identifier, name);
+    if (!fresh) {
+      throw std::runtime_error(
+          fmt::format("Nonterminals {} and {} both generate identifier {}",
+                      it->second, name, it->first));
+    }
+    jntrms.push_back({{"name", name}, {"id", id}});
+  }
+  model["ntrms"] = Template::Value::FromJson(jntrms);
 
   auto skeleton = alioth::Skeleton::Deduce(syntax);
   auto jskeleton = skeleton.Store();
-  jskeleton.erase("S'");
+  for (auto const& [symbol, _] : skeleton.structures) {
+    if (syntax->IsSynthetic(symbol)) jskeleton.erase(syntax->NameOf(symbol));
+  }
   model["skeleton"] = Template::Value::FromJson(jskeleton);
 
   Template::Map meta;
@@ -35,6 +214,7 @@ int Framework::Run() {
   meta["lowercase"] = Template::Pipe(&Strings::Lowercase);
   meta["camelcase"] = Template::Pipe(&Strings::Camelcase);
   meta["titlecase"] = Template::Pipe(&Strings::Titlecase);
+  meta["identifier"] = Template::Pipe(&IdentifierOf);
   meta["eq"] = Template::Filter{[](auto&, auto const& args) {
     return Template::Value{args[0].TextOf() == args[1].TextOf()};
   }};
@@ -43,11 +223,10 @@ int Framework::Run() {
 
   auto home = AliothHome();
   auto root = home / "templates" / "skeleton" / "cpp";
-  auto output_dir = std::filesystem::path(opath->Value());
 
   {
     auto text = Template::Render(root / "syntax.h.template", model, meta);
-    auto dir = output_dir / "include" / lang;
+    auto dir = output / "include" / lang;
     std::filesystem::create_directories(dir);
     std::ofstream ofs(dir / "syntax.h");
     ofs << text;
@@ -55,11 +234,17 @@ int Framework::Run() {
 
   {
     auto text = Template::Render(root / "syntax.cpp.template", model, meta);
-    auto dir = output_dir / "src";
+    auto dir = output / "src";
     std::filesystem::create_directories(dir);
     std::ofstream ofs(dir / "syntax.cpp");
     ofs << text;
   }
 
-  return 0;
+  {
+    auto text = Template::Render(root / "scanner.cpp.template", model, meta);
+    auto dir = output / "src";
+    std::filesystem::create_directories(dir);
+    std::ofstream ofs(dir / "scanner.cpp");
+    ofs << text;
+  }
 }
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include "alioth-cli/render.h"
 #include "alioth-cli/skeleton.h"
 #include "alioth-cli/syntax.h"
+#include "alioth-cli/tokenize.h"
 #include "alioth/alioth.h"
 #include "alioth/parser.h"
 #include "alioth/strings.h"
@@ -20,9 +21,10 @@ int main(int argc, char** argv) {
   cli::Application::Command(std::make_shared<Render>(), {"render"});
   cli::Application::Command(std::make_shared<Skeleton>(), {"skeleton"});
   cli::Application::Command(std::make_shared<Framework>(), {"framework"});
+  cli::Application::Command(std::make_shared<Tokenize>(), {"tokenize"});
   cli::Application::Name("alioth");
   cli::Application::Brief("compiler utils");
-  cli::Application::Version("0.0.0");
+  cli::Application::Version(alioth::kVersion);
   cli::Application::Author("GodGnidoc");
   return cli::Application::Run(argc, argv);
 }
\ No newline at end of file
@@ -3,12 +3,16 @@
 #include "alioth-cli/syntax.h"
 #include "alioth/document.h"
 #include "alioth/parser.h"
+#include "alioth/tokenizer.h"
 #include "aliox/grammar.h"
 #include "aliox/skeleton.h"
 
 int Parse::Run() {
+  auto const threads = ::Syntax::JobsOf(jobs, 0);
+  if (!threads) return 1;
+
   alioth::Doc gdoc;
-  auto syntax = ::Syntax::Load(gpath->Value());
+  auto syntax = ::Syntax::Load(gpath->Value(), 1, !no_cache->HasValue());
 
   alioth::Doc sdoc;
   if (source->Value() == "-") {
@@ -18,6 +22,13 @@ int Parse::Run() {
   }
 
   auto parser = alioth::Parser(syntax, sdoc);
+  if (drop_ignored->HasValue()) parser.DropIgnored(true);
+  if (jobs->HasValue() && syntax->lex->contexts.size() == 1) {
+    auto tokens = std::make_shared<alioth::Tokenizer::Batch>();
+    auto tokenizer = alioth::Tokenizer(syntax->lex, sdoc);
+    tokenizer.All(*tokens, *threads);
+    parser.UseTokens(tokens);
+  }
   auto root = parser.Parse();
   std::shared_ptr<alioth::Skeleton> skeleton;
 
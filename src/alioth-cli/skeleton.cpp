@@ -10,7 +10,7 @@
 #include "aliox/template.h"
 
 int Skeleton::Run() {
-  auto syntax = ::Syntax::Load(gpath->Value());
+  auto syntax = ::Syntax::Load(gpath->Value(), 1, !no_cache->HasValue());
 
   auto skeleton = alioth::Skeleton::Deduce(syntax);
   fmt::println("{}", skeleton.Store().dump(2));
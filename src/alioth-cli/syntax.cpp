@@ -1,5 +1,10 @@
 #include "alioth-cli/syntax.h"
 
+#include <unistd.h>
+
+#include <charconv>
+#include <cstdint>
+#include <fstream>
 #include <iostream>
 
 #include "alioth/alioth.h"
@@ -9,18 +14,176 @@
 #include "aliox/skeleton.h"
 
 int Syntax::Run() {
-  auto syntax = ::Syntax::Load(gpath->Value());
+  auto const threads = JobsOf(jobs, 1);
+  if (!threads) return 1;
+  /**
+   * 缓存的是二进制镜像，镜像不含状态表，只能重新输出为镜像
+   * 因此输出 json 时不读取缓存；惰性构造的词法规则两者都不能输出
+   */
+  auto const cache = binary->HasValue() && !no_cache->HasValue();
+  auto syntax = ::Syntax::Load(gpath->Value(), *threads, cache);
+
+  try {
+    if (binary->HasValue()) {
+      std::cout << syntax->Image();
+      return 0;
+    }
 
-  auto json = syntax->Store();
-  std::cout << json.dump(2) << std::endl;
-  return 0;
+    auto json = syntax->Store();
+    std::cout << json.dump(2) << std::endl;
+    return 0;
+  } catch (alioth::Syntactic::NotMaterialized const& e) {
+    fmt::println(stderr, "error: {}, output it with -b", e.what());
+  } catch (alioth::Lexicon::NotMaterialized const& e) {
+    fmt::println(stderr, "error: {}", e.what());
+  }
+  return 1;
 }
 
-alioth::Syntax Syntax::Load(std::string const& path) {
+namespace {
+
+/**
+ * 编译器指纹，即当前可执行文件的大小和修改时间
+ *
+ * 版本号不随每次修改递增，重新构建后指纹随之变化，旧的缓存不再命中
+ * 无法获取指纹时返回空，此时不使用缓存
+ */
+std::string Fingerprint() {
+  std::error_code ec;
+  auto const exe = std::filesystem::read_symlink("/proc/self/exe", ec);
+  if (ec) return {};
+  auto const size = std::filesystem::file_size(exe, ec);
+  if (ec) return {};
+  auto const time = std::filesystem::last_write_time(exe, ec);
+  if (ec) return {};
+  return fmt::format("{}:{}", size, time.time_since_epoch().count());
+}
+
+/**
+ * 缓存文件末尾的标记，其前是键的长度，再往前是键的全文
+ */
+constexpr std::string_view kKeyMark = "ALIOKEY1";
+
+/**
+ * 计算语法缓存的键，即版本号、编译器指纹和语法文本
+ */
+std::string CacheKey(std::string const& fingerprint,
+                     std::string const& content) {
+  return fmt::format("{}\n{}\n{}", alioth::kVersion, fingerprint, content);
+}
+
+/**
+ * 计算语法缓存文件的路径
+ *
+ * 缓存以键的 FNV-1a 哈希值命名，文件名相同不代表键相同
+ */
+std::filesystem::path CachePath(std::string const& key) {
+  auto hash = 14695981039346656037ULL;
+  for (auto const c : key) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 1099511628211ULL;
+  }
+  return alioth::AliothCache() / "syntax" / fmt::format("{:016x}.img", hash);
+}
+
+/**
+ * 读取缓存文件末尾记录的键，格式不符时返回空
+ */
+std::optional<std::string> KeyOf(std::filesystem::path const& path) {
+  std::ifstream ifs(path, std::ios::binary | std::ios::ate);
+  if (!ifs) return std::nullopt;
+
+  auto const size = static_cast<uint64_t>(ifs.tellg());
+  std::string mark(kKeyMark.size(), '\0');
+  uint64_t length{};
+  if (size < sizeof(length) + mark.size()) return std::nullopt;
+  ifs.seekg(size - sizeof(length) - mark.size());
+  ifs.read(reinterpret_cast<char*>(&length), sizeof(length));
+  ifs.read(mark.data(), mark.size());
+  if (!ifs || mark != kKeyMark) return std::nullopt;
+  if (length > size - sizeof(length) - mark.size()) return std::nullopt;
+
+  std::string key(length, '\0');
+  ifs.seekg(size - sizeof(length) - mark.size() - length);
+  ifs.read(key.data(), key.size());
+  if (!ifs) return std::nullopt;
+  return key;
+}
+
+/**
+ * 将缓存的语法镜像映射到内存
+ *
+ * 缓存不存在、末尾记录的键与 key 不同或镜像无法加载时返回空
+ * 镜像只访问头部记录的各段，末尾的键不影响映射
+ */
+alioth::Syntax ReadCache(std::filesystem::path const& path,
+                         std::string const& key) {
+  std::error_code ec;
+  if (!std::filesystem::is_regular_file(path, ec)) return nullptr;
+  if (KeyOf(path) != key) return nullptr;
+
+  try {
+    return alioth::Syntactic::Map(path);
+  } catch (std::exception const&) {
+    return nullptr;
+  }
+}
+
+/**
+ * 将语法的二进制镜像写入缓存，镜像之后追加键的全文、长度和标记
+ *
+ * 先写入临时文件再重命名，并发的进程不会读到不完整的缓存
+ * 已映射旧缓存的进程仍持有原文件，不受重命名影响
+ * 写入失败不影响语法的使用，因此忽略所有错误
+ * 惰性构造的词法规则没有完整的状态表，不能输出镜像，因此不缓存
+ */
+void WriteCache(std::filesystem::path const& path, std::string const& key,
+                alioth::Syntax const& syntax) {
+  if (syntax->lex->lazy) return;
+
+  std::string image;
+  try {
+    image = syntax->Image();
+  } catch (std::exception const&) {
+    return;
+  }
+  uint64_t const length = key.size();
+  image += key;
+  image.append(reinterpret_cast<char const*>(&length), sizeof(length));
+  image += kKeyMark;
+
+  std::error_code ec;
+  std::filesystem::create_directories(path.parent_path(), ec);
+  if (ec) return;
+
+  auto temp = path;
+  temp += fmt::format(".{}.tmp", getpid());
+  {
+    std::ofstream ofs(temp, std::ios::binary);
+    ofs << image;
+    if (!ofs.flush()) {
+      ofs.close();
+      std::filesystem::remove(temp, ec);
+      return;
+    }
+  }
+
+  std::filesystem::rename(temp, path, ec);
+  if (ec) std::filesystem::remove(temp, ec);
+}
+
+}  // namespace
+
+alioth::Syntax Syntax::Load(std::string const& path, size_t jobs, bool cache) {
   alioth::Doc doc;
   if (path == "-") {
     doc = alioth::Document::Read();
   } else {
+    std::string magic(8, '\0');
+    std::ifstream(path, std::ios::binary).read(magic.data(), magic.size());
+    if (alioth::Syntactic::IsImage(magic)) {
+      return alioth::Syntactic::Map(path);
+    }
     doc = alioth::Document::Read(path);
   }
 
@@ -29,8 +192,53 @@ alioth::Syntax Syntax::Load(std::string const& path) {
     auto syntax = alioth::Syntactic::Load(json);
     return syntax;
   } catch (nlohmann::json::parse_error const&) {
+    std::filesystem::path cpath;
+    std::string ckey;
+    auto const fingerprint = cache ? Fingerprint() : std::string{};
+    cache = !fingerprint.empty();
+    if (cache) {
+      ckey = CacheKey(fingerprint, doc->content);
+      cpath = CachePath(ckey);
+      if (auto syntax = ReadCache(cpath, ckey)) return syntax;
+    }
+
     auto grammar = alioth::Grammar::Load(doc);
-    auto syntax = grammar.Compile();
+    std::vector<std::string> notes;
+    auto syntax = grammar.Compile(jobs, &notes);
+    for (auto const& note : notes) fmt::println(stderr, "note: {}", note);
+    if (cache) WriteCache(cpath, ckey, syntax);
     return syntax;
   }
+}
+
+cli::Opt Syntax::NoCacheOption(cli::Command& command) {
+  return command.Option({"--no-cache"})
+      ->Brief("do not use the syntax cache")
+      ->Doc(
+          "compile the grammar from scratch without"
+          " reading or writing the syntax cache");
+}
+
+cli::Opt Syntax::JobsOption(cli::Command& command) {
+  return command.Option({"-j", "--jobs"})
+      ->Argument("jobs")
+      ->Brief("build in parallel")
+      ->Doc(
+          "build the parsing states with the given number of threads,"
+          " 0 to use all hardware threads");
+}
+
+std::optional<size_t> Syntax::JobsOf(cli::Opt const& option,
+                                     size_t fallback) {
+  if (!option->HasValue()) return fallback;
+
+  auto const value = option->Value();
+  size_t jobs{};
+  auto const end = value.data() + value.size();
+  auto const [ptr, ec] = std::from_chars(value.data(), end, jobs);
+  if (value.empty() || ec != std::errc{} || ptr != end) {
+    fmt::println(stderr, "error: Invalid number of jobs: {}", value);
+    return std::nullopt;
+  }
+  return jobs;
 }
\ No newline at end of file
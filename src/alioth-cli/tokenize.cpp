@@ -0,0 +1,57 @@
+#include "alioth-cli/tokenize.h"
+
+#include "alioth-cli/syntax.h"
+#include "alioth/document.h"
+#include "alioth/tokenizer.h"
+
+int Tokenize::Run() {
+  auto const threads = ::Syntax::JobsOf(jobs, 0);
+  if (!threads) return 1;
+
+  auto syntax = ::Syntax::Load(gpath->Value(), 1, !no_cache->HasValue());
+  auto lex = syntax->lex;
+
+  alioth::Doc sdoc;
+  if (source->Value() == "-") {
+    sdoc = alioth::Document::Read();
+  } else {
+    sdoc = alioth::Document::Read(source->Value());
+  }
+
+  alioth::ContextID ctx = 0;
+  if (context->HasValue()) {
+    auto const& contexts = lex->contexts;
+    auto it = std::find(contexts.begin(), contexts.end(), context->Value());
+    if (it == contexts.end()) {
+      fmt::println(stderr, "error: Unknown context {}", context->Value());
+      return 1;
+    }
+    ctx = it - contexts.begin();
+  }
+
+  auto tokens = nlohmann::json::array();
+  auto tokenizer = alioth::Tokenizer(lex, sdoc, ctx);
+  auto batch = alioth::Tokenizer::Batch{};
+  auto const parallel = jobs->HasValue();
+  while (parallel ? tokenizer.All(batch, *threads) : tokenizer.Next(batch)) {
+    for (auto i = 0UL; i < batch.Size(); ++i) {
+      auto const id = batch.ids[i];
+      auto const offset = batch.offsets[i];
+      auto const length = batch.lengths[i];
+      auto token = nlohmann::json::object();
+      token["name"] = lex->NameOf(id);
+      token["offset"] = offset;
+      token["length"] = length;
+      token["text"] = sdoc->content.substr(offset, length);
+      if (id != alioth::Lexicon::kERR) {
+        auto const& attributes = lex->terms.at(id).attributes;
+        auto it = attributes.find("tokenize");
+        if (it != attributes.end()) token["tokenize"] = it->second;
+      }
+      tokens.push_back(token);
+    }
+  }
+
+  fmt::println("{}", tokens.dump(2));
+  return 0;
+}
@@ -15,4 +15,20 @@ std::filesystem::path AliothHome() {
   return alioth_home;
 }
 
+std::filesystem::path AliothCache() {
+  static auto const alioth_cache = [] {
+    if (auto env = getenv("XDG_CACHE_HOME"); env && *env) {
+      return std::filesystem::path(env) / "alioth";
+    }
+
+    if (auto env = getenv("HOME"); env && *env) {
+      return std::filesystem::path(env) / ".cache" / "alioth";
+    }
+
+    return AliothHome() / ".cache";
+  }();
+
+  return alioth_cache;
+}
+
 }  // namespace alioth
\ No newline at end of file
@@ -4,6 +4,28 @@
 
 namespace alioth {
 
+AtomID Atoms::Intern(std::string_view text) {
+  auto it = index_.find(text);
+  if (it != index_.end()) return it->second;
+
+  /**
+   * deque 追加元素不会移动已有元素，索引中的文本视图始终有效
+   */
+  auto const atom = static_cast<AtomID>(texts_.size());
+  auto const& stored = texts_.emplace_back(text);
+  index_.emplace(stored, atom);
+  return atom;
+}
+
+AtomID Atoms::Find(std::string_view text) const {
+  auto it = index_.find(text);
+  return it == index_.end() ? kNone : it->second;
+}
+
+std::string_view Atoms::Text(AtomID atom) const { return texts_.at(atom); }
+
+size_t Atoms::Size() const { return texts_.size(); }
+
 ASTNtrm ASTNode::AsNtrm() {
   return std::dynamic_pointer_cast<ASTNtrmNode>(shared_from_this());
 }
@@ -93,6 +115,11 @@ Range ASTNode::Range() {
 
 std::string ASTNode::Name() { return root.lock()->syntax->NameOf(id); }
 
+AtomID ASTNode::Atom() {
+  auto term = AsTerm();
+  return term ? term->atom : Atoms::kNone;
+}
+
 std::string ASTNode::Text() {
   auto doc = root.lock()->doc;
 
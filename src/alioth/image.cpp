@@ -0,0 +1,281 @@
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+
+#include "alioth/syntax.h"
+
+namespace alioth {
+
+namespace {
+
+constexpr std::string_view kMagic{"ALIOTHSY", 8};  // 镜像魔数
+constexpr uint32_t kFormat = 1;                    // 镜像格式版本
+constexpr uint32_t kByteOrder = 0x01020304;        // 字节序标记
+
+/**
+ * 镜像的段，按此顺序存放在文件头之后
+ */
+enum Section : uint32_t {
+  kMeta,         // 单词表、产生式等元数据，CBOR 格式
+  kClasses,      // 词法：字节 -> 等价类
+  kEntries,      // 词法：上下文 -> 首状态
+  kTransitions,  // 词法：稠密转移表
+  kAccepts,      // 词法：状态 -> 接受的单词
+  kSkips,        // 词法：状态 -> 自循环跳跃规则
+  kHosts,        // 词法：状态 -> 是否可能接受关键字文本
+  kBases,        // 语法：状态 -> 动作行的偏移量
+  kDefaults,     // 语法：状态 -> 默认归约的产生式
+  kChecks,       // 语法：槽 -> 槽所属的符号
+  kActions,      // 语法：槽 -> 动作
+  kScopes,       // 语法：状态 -> 上下文列表的起点
+  kContexts,     // 语法：各状态可能的上下文
+  kSections,
+};
+
+/**
+ * 段在镜像中的位置，偏移量相对镜像起点，单位为字节
+ */
+struct Extent {
+  uint64_t offset;
+  uint64_t size;
+};
+
+/**
+ * 镜像文件头
+ *
+ * 整数按本机字节序存储，字节序或跳跃规则的布局不同的镜像拒绝加载
+ */
+struct Header {
+  std::array<char, 8> magic;
+  uint32_t format;
+  uint32_t order;
+  uint32_t skip;   // 跳跃规则的字节数
+  uint32_t width;  // 词法等价类数量
+  std::array<Extent, kSections> extents;
+};
+
+template <typename T>
+std::span<char const> Bytes(std::span<T const> data) {
+  return {reinterpret_cast<char const*>(data.data()), data.size_bytes()};
+}
+
+template <typename T>
+std::span<T const> Slice(std::span<char const> image, Extent const& extent) {
+  if (extent.size % sizeof(T)) throw Syntactic::InvalidImage("bad section");
+  return {reinterpret_cast<T const*>(image.data() + extent.offset),
+          extent.size / sizeof(T)};
+}
+
+/**
+ * 检查数组的全部元素满足条件，否则镜像已损坏
+ */
+template <typename T, typename Pred>
+void Expect(std::span<T const> data, Pred pred, std::string const& reason) {
+  if (!std::all_of(data.begin(), data.end(), pred)) {
+    throw Syntactic::InvalidImage(reason);
+  }
+}
+
+}  // namespace
+
+std::string Syntactic::Image() const {
+  if constexpr (std::endian::native != std::endian::little) {
+    throw InvalidImage("big endian hosts are not supported");
+  }
+
+  /**
+   * 元数据沿用JSON格式的存储形式，不含状态表
+   * 从镜像查看的语法规则同样可以重新输出镜像
+   */
+  if (lex->lazy) throw Lexicon::NotMaterialized{};
+  auto const cbor = nlohmann::json::to_cbor(StoreMeta());
+
+  auto const& lt = *lex->table;
+  auto const& st = *table;
+  std::array<std::span<char const>, kSections> const sections{
+      Bytes(std::span<uint8_t const>(cbor)),
+      Bytes(std::span<uint8_t const>(lt.classes)),
+      Bytes(lt.entries),
+      Bytes(lt.transitions),
+      Bytes(lt.accepts),
+      Bytes(lt.skips),
+      Bytes(lt.hosts),
+      Bytes(st.bases),
+      Bytes(st.defaults),
+      Bytes(st.checks),
+      Bytes(st.actions),
+      Bytes(st.scopes),
+      Bytes(st.contexts),
+  };
+
+  Header header{};
+  std::copy(kMagic.begin(), kMagic.end(), header.magic.begin());
+  header.format = kFormat;
+  header.order = kByteOrder;
+  header.skip = sizeof(Lexicon::Table::Skip);
+  header.width = lt.width;
+
+  /**
+   * 各段按 8 字节对齐，映射后可以直接作为数组访问
+   */
+  std::string image(sizeof(Header), '\0');
+  for (auto i = 0UL; i < kSections; ++i) {
+    image.resize((image.size() + 7) / 8 * 8, '\0');
+    header.extents[i] = {image.size(), sections[i].size()};
+    image.append(sections[i].data(), sections[i].size());
+  }
+  std::memcpy(image.data(), &header, sizeof(Header));
+  return image;
+}
+
+Syntax Syntactic::View(std::span<char const> image,
+                       std::shared_ptr<void const> owner) {
+  if (!IsImage({image.data(), image.size()})) {
+    throw InvalidImage("bad magic");
+  }
+  if (image.size() < sizeof(Header)) throw InvalidImage("truncated header");
+  if (reinterpret_cast<uintptr_t>(image.data()) % 8) {
+    throw InvalidImage("misaligned");
+  }
+
+  Header header;
+  std::memcpy(&header, image.data(), sizeof(Header));
+  if (header.format != kFormat) {
+    throw InvalidImage(fmt::format("unsupported format {}", header.format));
+  }
+  if (header.order != kByteOrder) throw InvalidImage("byte order mismatch");
+  if (header.skip != sizeof(Lexicon::Table::Skip)) {
+    throw InvalidImage("layout mismatch");
+  }
+  for (auto const& extent : header.extents) {
+    if (extent.offset % 8 || extent.offset > image.size() ||
+        extent.size > image.size() - extent.offset) {
+      throw InvalidImage("section out of range");
+    }
+  }
+
+  /**
+   * 以空的状态表加载元数据，关键字散列表只取决于单词表，此时已经构造完成
+   */
+  Syntax syntax;
+  try {
+    auto const cbor = Slice<uint8_t>(image, header.extents[kMeta]);
+    auto meta = nlohmann::json::from_cbor(cbor.begin(), cbor.end());
+    meta["states"] = nlohmann::json::array();
+    meta["lex"]["states"] = nlohmann::json::array();
+    syntax = Load(meta);
+  } catch (nlohmann::json::exception const& e) {
+    throw InvalidImage(e.what());
+  }
+
+  auto lt = std::make_shared<Lexicon::Table>(*syntax->lex->table);
+  auto const classes = Slice<uint8_t>(image, header.extents[kClasses]);
+  if (classes.size() != lt->classes.size()) throw InvalidImage("bad classes");
+  std::copy(classes.begin(), classes.end(), lt->classes.begin());
+  lt->width = header.width;
+  lt->entries = Slice<uint32_t>(image, header.extents[kEntries]);
+  lt->transitions = Slice<uint32_t>(image, header.extents[kTransitions]);
+  lt->accepts = Slice<uint32_t>(image, header.extents[kAccepts]);
+  lt->skips = Slice<Lexicon::Table::Skip>(image, header.extents[kSkips]);
+  lt->hosts = Slice<uint8_t>(image, header.extents[kHosts]);
+  lt->storage = owner;
+
+  auto st = std::make_shared<Table>();
+  st->bases = Slice<uint32_t>(image, header.extents[kBases]);
+  st->defaults = Slice<uint32_t>(image, header.extents[kDefaults]);
+  st->checks = Slice<uint16_t>(image, header.extents[kChecks]);
+  st->actions = Slice<uint32_t>(image, header.extents[kActions]);
+  st->scopes = Slice<uint32_t>(image, header.extents[kScopes]);
+  st->contexts = Slice<ContextID>(image, header.extents[kContexts]);
+  st->storage = owner;
+
+  auto const nstates = lt->accepts.size();
+  if (lt->transitions.size() != nstates * lt->width ||
+      lt->skips.size() != nstates || lt->hosts.size() != nstates ||
+      st->defaults.size() != st->bases.size() ||
+      st->scopes.size() != st->bases.size() + 1 ||
+      st->checks.size() != st->actions.size()) {
+    throw InvalidImage("inconsistent tables");
+  }
+
+  /**
+   * 扫描和分析时不检查下标，加载时确认状态、产生式和上下文都在范围内
+   * 动作行的偏移量不必检查，查找动作时槽位越界即视为没有动作
+   */
+  auto const terms = syntax->lex->terms.size();
+  auto const formulas = syntax->formulas.size();
+  auto const nrows = st->bases.size();
+  auto const state = [&](uint32_t s) { return s < nstates; };
+  auto const accept = [&](uint32_t t) {
+    return t == Lexicon::Table::kReject || t < terms;
+  };
+  auto const skip = [](Lexicon::Table::Skip const& s) {
+    return s.count <= Lexicon::Table::Skip::kMaxBytes;
+  };
+  auto const formula = [&](uint32_t f) {
+    return f == Table::kNone || f < formulas;
+  };
+  auto const context = [&](ContextID c) {
+    return static_cast<uint8_t>(c) < lt->entries.size();
+  };
+
+  if (nstates == 0 || nrows == 0) throw InvalidImage("empty tables");
+  Expect(classes, [&](uint8_t c) { return c < lt->width; }, "bad classes");
+  Expect(lt->entries, state, "bad entries");
+  Expect(lt->transitions, state, "bad transitions");
+  Expect(lt->accepts, accept, "bad accepts");
+  Expect(lt->skips, skip, "bad skips");
+  Expect(st->defaults, formula, "bad defaults");
+  Expect(st->contexts, context, "bad contexts");
+  for (auto slot = 0UL; slot < st->actions.size(); ++slot) {
+    if (st->checks[slot] == Table::kEmpty) continue;
+    auto const action = st->actions[slot];
+    if (action & Table::kReduce ? (action & ~Table::kReduce) >= formulas
+                                : action >= nrows) {
+      throw InvalidImage("bad actions");
+    }
+  }
+  if (st->scopes.front() != 0 || st->scopes.back() != st->contexts.size() ||
+      !std::is_sorted(st->scopes.begin(), st->scopes.end())) {
+    throw InvalidImage("bad scopes");
+  }
+
+  syntax->lex->table = lt;
+  syntax->table = st;
+  return syntax;
+}
+
+Syntax Syntactic::Map(std::filesystem::path const& path) {
+  auto const fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) throw InvalidImage(fmt::format("cannot open {}", path.string()));
+
+  struct stat st {};
+  if (fstat(fd, &st) != 0 || st.st_size == 0) {
+    close(fd);
+    throw InvalidImage(fmt::format("cannot stat {}", path.string()));
+  }
+
+  auto const size = static_cast<size_t>(st.st_size);
+  auto const addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) {
+    throw InvalidImage(fmt::format("cannot map {}", path.string()));
+  }
+
+  auto owner = std::shared_ptr<void const>(addr, [size](void const* data) {
+    munmap(const_cast<void*>(data), size);
+  });
+  return View({static_cast<char const*>(addr), size}, owner);
+}
+
+bool Syntactic::IsImage(std::string_view data) {
+  return data.starts_with(kMagic);
+}
+
+}  // namespace alioth
@@ -1,7 +1,39 @@
 #include "alioth/lexicon.h"
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <bitset>
+#include <cstring>
+#include <map>
+#include <numeric>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace alioth {
 
+namespace {
+
+/**
+ * 稠密转移表中随状态数增长的数组，编译完成后由转移表持有
+ */
+struct Arrays {
+  std::vector<uint32_t> entries;
+  std::vector<uint32_t> transitions;
+  std::vector<uint32_t> accepts;
+  std::vector<Lexicon::Table::Skip> skips;
+  std::vector<uint8_t> hosts;
+};
+
+}  // namespace
+
 std::string Lexicon::Lang() const { return contexts.front(); }
 
 std::string Lexicon::NameOf(SymbolID symbol) const {
@@ -22,11 +54,651 @@ SymbolID Lexicon::FindSymbol(std::string const& name) const {
   throw std::runtime_error(fmt::format("Unknown symbol {}", name));
 }
 
+void Lexicon::Compile() {
+  auto table = std::make_shared<Table>();
+  auto arrays = std::make_shared<Arrays>();
+  auto const nstates = states.size();
+
+  /**
+   * 按字节在各状态上的转移目标划分等价类
+   *
+   * 起始状态的转移以上下文ID为输入，不参与划分
+   */
+  std::map<std::vector<uint32_t>, uint8_t> signatures;
+  std::vector<uint32_t> representatives;
+  for (auto c = 0; c < 256; ++c) {
+    auto const ch = static_cast<char>(c);
+    std::vector<uint32_t> signature(nstates, 0);
+    for (auto state = 1UL; state < nstates; ++state) {
+      auto const& transitions = states.at(state).transitions;
+      auto it = transitions.find(ch);
+      if (it != transitions.end()) signature[state] = it->second;
+    }
+
+    auto [it, created] =
+        signatures.emplace(std::move(signature), representatives.size());
+    if (created) representatives.push_back(c);
+    table->classes[c] = it->second;
+  }
+  table->width = representatives.size();
+
+  /**
+   * 以等价类代表字节填写转移表，起始状态所在行保持为空
+   */
+  arrays->transitions.resize(nstates * table->width, 0);
+  arrays->accepts.resize(nstates, Table::kReject);
+  for (auto state = 1UL; state < nstates; ++state) {
+    auto const& st = states.at(state);
+    if (st.accepts) arrays->accepts[state] = *st.accepts;
+
+    auto row = arrays->transitions.data() + state * table->width;
+    for (auto cls = 0UL; cls < table->width; ++cls) {
+      auto const ch = static_cast<char>(representatives[cls]);
+      auto it = st.transitions.find(ch);
+      if (it != st.transitions.end()) row[cls] = it->second;
+    }
+  }
+
+  /**
+   * 记录自循环状态的关键字节，离开循环的字节和维持循环的字节取较少者
+   */
+  arrays->skips.resize(nstates);
+  for (auto state = 1UL; state < nstates; ++state) {
+    auto row = arrays->transitions.data() + state * table->width;
+    CharSet loops;
+    for (auto c = 0; c < 256; ++c) {
+      if (row[table->classes[c]] == state) loops.set(c);
+    }
+    if (loops.none()) continue;
+
+    auto& skip = arrays->skips[state];
+    skip.exits = ~loops;
+    skip.loop = skip.exits.count() > Table::Skip::kMaxBytes;
+    auto const& keys = skip.loop ? loops : skip.exits;
+    if (keys.count() > Table::Skip::kMaxBytes) {
+      skip = {};
+      continue;
+    }
+    for (auto c = 0; c < 256; ++c) {
+      if (keys.test(c)) skip.bytes[skip.count++] = static_cast<char>(c);
+    }
+  }
+
+  if (!states.empty()) {
+    for (auto const& [ctx, state] : states.front().transitions) {
+      auto const index = static_cast<uint8_t>(ctx);
+      if (arrays->entries.size() <= index) arrays->entries.resize(index + 1, 0);
+      arrays->entries[index] = state;
+    }
+  }
+
+  /**
+   * 为关键字构造完美散列表
+   *
+   * 关键字先按散列值分桶，再从大到小为每个桶寻找偏移量，使桶内关键字落入空槽
+   * 查找时只需访问一个桶和一个槽，若某个桶找不到偏移量则更换种子重试
+   */
+  std::vector<SymbolID> keywords;
+  for (auto id = 0UL; id < terms.size(); ++id) {
+    auto const& term = terms.at(id);
+    if (term.keyword.empty()) continue;
+    keywords.push_back(id);
+    table->longest = std::max(table->longest, term.keyword.size());
+  }
+
+  auto const nslots = std::bit_ceil(keywords.size() + keywords.size() / 4);
+  auto const nbuckets = std::bit_ceil((keywords.size() + 3) / 4);
+  auto place = [&](uint64_t seed) {
+    table->keywords.assign(nslots, {});
+    table->displacements.assign(nbuckets, 0);
+
+    std::vector<std::vector<std::pair<SymbolID, uint64_t>>> buckets(nbuckets);
+    for (auto const id : keywords) {
+      auto const hash = Table::Hash(terms.at(id).keyword, seed);
+      buckets[(hash >> 32) & (nbuckets - 1)].emplace_back(id, hash);
+    }
+    std::vector<size_t> order(nbuckets);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](auto lhs, auto rhs) {
+      return buckets[lhs].size() > buckets[rhs].size();
+    });
+
+    std::vector<size_t> chosen;
+    for (auto const bucket : order) {
+      auto const& members = buckets[bucket];
+      if (members.empty()) break;
+
+      auto displacement = 0U;
+      for (; displacement < nslots * 4; ++displacement) {
+        chosen.clear();
+        for (auto const& [_, hash] : members) {
+          auto const slot = Table::Slot(hash, displacement, nslots);
+          if (!table->keywords[slot].text.empty()) break;
+          if (std::count(chosen.begin(), chosen.end(), slot)) break;
+          chosen.push_back(slot);
+        }
+        if (chosen.size() == members.size()) break;
+      }
+      if (chosen.size() != members.size()) return false;
+
+      table->displacements[bucket] = displacement;
+      for (auto i = 0UL; i < members.size(); ++i) {
+        auto const& term = terms.at(members[i].first);
+        auto& slot = table->keywords[chosen[i]];
+        slot.text = term.keyword;
+        slot.hash = members[i].second;
+        slot.term = members[i].first;
+        if (term.entries.empty()) slot.contexts.set();
+        for (auto const ctx : term.entries) {
+          slot.contexts.set(static_cast<uint8_t>(ctx));
+        }
+      }
+    }
+    return true;
+  };
+
+  if (!keywords.empty()) {
+    while (!place(table->seed)) table->seed++;
+  }
+
+  /**
+   * 在状态机上模拟关键字文本，标记关键字文本结束时所在的状态
+   * 只有在这些状态接受的单词才需要查表
+   */
+  arrays->hosts.resize(nstates);
+  for (auto const id : keywords) {
+    auto const& term = terms.at(id);
+    for (auto ctx = 0UL; ctx < arrays->entries.size(); ++ctx) {
+      if (!term.entries.empty() && !term.entries.count(ctx)) continue;
+
+      auto state = arrays->entries[ctx];
+      for (auto const ch : term.keyword) {
+        if (state == 0) break;
+        auto const cls = table->classes[static_cast<uint8_t>(ch)];
+        state = arrays->transitions[state * table->width + cls];
+      }
+      if (state != 0) arrays->hosts[state] = true;
+    }
+  }
+
+  table->entries = arrays->entries;
+  table->transitions = arrays->transitions;
+  table->accepts = arrays->accepts;
+  table->skips = arrays->skips;
+  table->hosts = arrays->hosts;
+  table->storage = arrays;
+  this->table = table;
+}
+
+Lexicon::Token Lexicon::Scan(std::string_view text, size_t offset,
+                             ContextID context) const {
+  if (offset >= text.size()) return Token{.id = kEOF};
+
+  auto const& table = *this->table;
+  if (lazy) {
+    auto token = lazy->Scan(text, offset, context);
+    if (token.id != kERR && !table.keywords.empty()) {
+      token.id = table.Resolve(text.substr(offset, token.length), token.id,
+                              context);
+    }
+    return token;
+  }
+
+  uint32_t state = table.Entry(context);
+  auto token = Walk(text, offset, offset, state);
+  if (token.id != kERR && table.hosts[state]) {
+    token.id = table.Resolve(text.substr(offset, token.length), token.id,
+                            context);
+  }
+  return token;
+}
+
+void Lexicon::Scan(std::string_view text, size_t offset,
+                   std::vector<ContextID> const& contexts,
+                   std::vector<Token>& tokens) const {
+  constexpr size_t kMaxContexts = 16;
+  if (offset >= text.size() || contexts.size() > kMaxContexts || lazy) {
+    tokens.clear();
+    for (auto const context : contexts) {
+      tokens.push_back(Scan(text, offset, context));
+    }
+    return;
+  }
+
+  /**
+   * 入口状态相同的上下文读取输入的路径完全相同，只需扫描一次
+   * 关键字与上下文有关，因此仍需逐个上下文修正
+   */
+  auto const& table = *this->table;
+  std::array<uint32_t, kMaxContexts> entries;  // 上下文的入口状态
+  std::array<uint32_t, kMaxContexts> states;   // 单词结束所在的状态
+  std::array<Token, kMaxContexts> accepts;     // 转移表接受的单词
+  tokens.resize(contexts.size());
+  for (auto i = 0UL; i < contexts.size(); ++i) {
+    entries[i] = table.Entry(contexts[i]);
+    auto same = 0UL;
+    while (entries[same] != entries[i]) same++;
+    if (same == i) {
+      auto state = entries[i];
+      accepts[i] = Walk(text, offset, offset, state);
+      states[i] = state;
+    } else {
+      states[i] = states[same];
+      accepts[i] = accepts[same];
+    }
+
+    auto& token = tokens[i];
+    token = accepts[i];
+    if (token.id != kERR && table.hosts[states[i]]) {
+      token.id = table.Resolve(text.substr(offset, token.length), token.id,
+                              contexts[i]);
+    }
+  }
+}
+
+void Lexicon::Scan(std::string_view text, size_t offset,
+                   Product const& product, std::vector<Token>& tokens) const {
+  tokens.resize(product.contexts.size());
+  if (offset >= text.size()) {
+    std::fill(tokens.begin(), tokens.end(), Token{.id = kEOF});
+    return;
+  }
+
+  auto const& table = *this->table;
+  auto const arity = product.arity;
+  auto const* members = product.members.data();
+  auto const* data = text.data();
+  auto const size = text.size();
+  std::array<Token, Product::kMaxArity> ends;     // 分量扫描到的单词
+  std::array<uint32_t, Product::kMaxArity> lasts;  // 分量结束所在的词法状态
+
+  /**
+   * 入口状态为 0 的分量不接受任何输入
+   */
+  for (auto i = 0U; i < arity; ++i) {
+    ends[i] = Token{.id = kEOF};
+    lasts[i] = 0;
+  }
+
+  /**
+   * 分量在无法转移时结束，与 Walk 相同
+   * 所处状态接受单词则得到该单词，否则得到包含当前字节的 kERR
+   */
+  uint32_t state = 1;
+  auto cursor = offset;
+  while (product.alive[state] >= 2) {
+    uint32_t next = 0;
+    if (cursor < size) {
+      auto const cls = table.classes[static_cast<uint8_t>(data[cursor])];
+      next = product.transitions[state * table.width + cls];
+    }
+
+    if (product.alive[next] < product.alive[state]) {
+      for (auto i = 0U; i < arity; ++i) {
+        auto const current = members[state * arity + i];
+        if (current == 0 || members[next * arity + i] != 0) continue;
+        if (table.accepts[current] != Table::kReject) {
+          ends[i] = {.id = table.accepts[current], .length = cursor - offset};
+          lasts[i] = current;
+        } else {
+          ends[i] = {.id = kERR, .length = cursor + 1 - offset};
+        }
+      }
+    }
+
+    cursor++;
+    state = next;
+  }
+
+  if (product.alive[state] == 1) {
+    for (auto i = 0U; i < arity; ++i) {
+      auto current = members[state * arity + i];
+      if (current == 0) continue;
+      ends[i] = Walk(text, offset, cursor, current);
+      lasts[i] = current;
+    }
+  }
+
+  /**
+   * 关键字与上下文有关，逐个上下文修正
+   */
+  for (auto j = 0UL; j < product.contexts.size(); ++j) {
+    auto const i = product.components[j];
+    auto& token = tokens[j];
+    token = ends[i];
+    if (token.id != kERR && table.hosts[lasts[i]]) {
+      token.id = table.Resolve(text.substr(offset, token.length), token.id,
+                              product.contexts[j]);
+    }
+  }
+}
+
+std::shared_ptr<Lexicon::Product const> Lexicon::Join(
+    std::span<ContextID const> contexts) const {
+  if (lazy || !table) return nullptr;
+
+  auto const& table = *this->table;
+  auto product = std::make_shared<Product>();
+  product->contexts.assign(contexts.begin(), contexts.end());
+
+  /**
+   * 入口状态相同的上下文读取输入的路径完全相同，共用一个分量
+   */
+  std::vector<uint32_t> entries;  // 分量 -> 入口状态
+  for (auto const context : contexts) {
+    auto const entry = table.Entry(context);
+    auto const it = std::find(entries.begin(), entries.end(), entry);
+    product->components.push_back(it - entries.begin());
+    if (it == entries.end()) entries.push_back(entry);
+  }
+  if (entries.size() < 2 || entries.size() > Product::kMaxArity) {
+    return nullptr;
+  }
+
+  /**
+   * 0 号状态的全部分量都已结束，1 号状态是各分量的入口状态
+   * 少于两个分量未结束的状态不再展开
+   */
+  auto const arity = product->arity = entries.size();
+  std::map<std::vector<uint32_t>, uint32_t> interned;
+  auto const intern = [&](std::vector<uint32_t> const& members) {
+    auto const [it, inserted] = interned.emplace(members, interned.size());
+    if (inserted) {
+      product->members.insert(product->members.end(), members.begin(),
+                              members.end());
+      product->alive.push_back(
+          arity - std::count(members.begin(), members.end(), 0U));
+      product->transitions.resize(interned.size() * table.width);
+    }
+    return it->second;
+  };
+  intern(std::vector<uint32_t>(arity));
+  intern(entries);
+
+  std::vector<uint32_t> members(arity);
+  for (auto state = 1U; state < interned.size(); ++state) {
+    if (product->alive[state] < 2) continue;
+    for (auto cls = 0U; cls < table.width; ++cls) {
+      for (auto i = 0U; i < arity; ++i) {
+        auto const current = product->members[state * arity + i];
+        members[i] = current ? table.transitions[current * table.width + cls]
+                             : 0;
+      }
+      auto const next = intern(members);
+      if (interned.size() > Product::kMaxStates) return nullptr;
+      product->transitions[state * table.width + cls] = next;
+    }
+  }
+  return product;
+}
+
+Lexicon::Token Lexicon::Lazy::Scan(std::string_view text, size_t offset,
+                                   ContextID context) {
+  {
+    std::shared_lock lock{mutex_};
+    if (auto token = Walk(text, offset, context, false)) return *token;
+  }
+
+  std::lock_guard lock{mutex_};
+  return *Walk(text, offset, context, true);
+}
+
+std::optional<Lexicon::Token> Lexicon::Lazy::Walk(std::string_view text,
+                                                  size_t offset,
+                                                  ContextID context,
+                                                  bool build) {
+  auto const* data = text.data();
+  auto const size = text.size();
+  auto cursor = offset;
+
+  uint32_t state = kUnknown;
+  if (build) {
+    state = Entry(context);
+  } else if (!sets_.empty()) {
+    state = entries_.at(static_cast<uint8_t>(context));
+  }
+  if (state == kUnknown) return std::nullopt;
+
+  Token token{.id = kEOF};
+  while (state != 0 && cursor <= size) {
+    uint32_t next = 0;
+    if (cursor < size) {
+      auto const cls = classes[static_cast<uint8_t>(data[cursor])];
+      next = build ? Next(state, cls) : transitions_[state * width + cls];
+      if (next == kUnknown) return std::nullopt;
+    }
+
+    if (next == 0 && finals_[state] != Table::kReject) {
+      token.id = finals_[state];
+      break;
+    }
+
+    token.id = kERR;
+    cursor++;
+    state = next;
+  }
+
+  token.length = cursor - offset;
+  return token;
+}
+
+size_t Lexicon::Lazy::States() {
+  std::shared_lock lock{mutex_};
+  return sets_.size();
+}
+
+uint32_t Lexicon::Lazy::Entry(ContextID context) {
+  if (sets_.empty()) Flush();
+
+  auto& entry = entries_.at(static_cast<uint8_t>(context));
+  if (entry == kUnknown) entry = Intern(firstpos.at(context));
+  return entry;
+}
+
+uint32_t Lexicon::Lazy::Next(uint32_t& state, uint8_t cls) {
+  auto next = transitions_[state * width + cls];
+  if (next != kUnknown) return next;
+
+  std::vector<uint32_t> target;
+  for (auto const pos : sets_[state]) {
+    if (!matches[pos].test(cls)) continue;
+    target.insert(target.end(), followpos[pos].begin(), followpos[pos].end());
+  }
+  std::sort(target.begin(), target.end());
+  target.erase(std::unique(target.begin(), target.end()), target.end());
+
+  if (target.empty()) {
+    next = 0;
+  } else if (interned_.count(target)) {
+    next = interned_.at(target);
+  } else {
+    if (memory_ > budget) {
+      auto const current = sets_[state];
+      Flush();
+      state = Intern(current);
+    }
+    next = Intern(target);
+  }
+
+  transitions_[state * width + cls] = next;
+  return next;
+}
+
+uint32_t Lexicon::Lazy::Intern(std::vector<uint32_t> const& positions) {
+  auto [it, created] = interned_.emplace(positions, sets_.size());
+  if (!created) return it->second;
+
+  /**
+   * 单词ID越小，优先级越高
+   */
+  auto final = Table::kReject;
+  for (auto const pos : positions) final = std::min(final, accepts[pos]);
+
+  sets_.push_back(positions);
+  finals_.push_back(final);
+  transitions_.resize(transitions_.size() + width, kUnknown);
+  memory_ += positions.size() * sizeof(uint32_t) * 2 + width * sizeof(uint32_t);
+  return it->second;
+}
+
+void Lexicon::Lazy::Flush() {
+  if (!sets_.empty()) flushes++;
+  interned_.clear();
+  sets_.assign(1, {});
+  finals_.assign(1, Table::kReject);
+  transitions_.assign(width, 0);
+  entries_.assign(firstpos.size(), kUnknown);
+  memory_ = width * sizeof(uint32_t);
+}
+
+Lexicon::Token Lexicon::Walk(std::string_view text, size_t offset,
+                             size_t cursor, uint32_t& state) const {
+  Token token{.id = kEOF};
+  auto const& table = *this->table;
+  auto const width = table.width;
+  auto const* transitions = table.transitions.data();
+  auto const* data = text.data();
+  auto const size = text.size();
+
+  while (state != 0 && cursor <= size) {
+    /**
+     * 文本末尾视作无法转移的输入
+     */
+    uint32_t next = 0;
+    if (cursor < size) {
+      auto const cls = table.classes[static_cast<uint8_t>(data[cursor])];
+      next = transitions[state * width + cls];
+    }
+
+    if (next == 0 && table.accepts[state] != Table::kReject) {
+      token.id = table.accepts[state];
+      break;
+    }
+
+    token.id = kERR;
+    cursor++;
+
+    /**
+     * 进入自循环后直接跳到循环的终点
+     */
+    if (next == state && table.skips[state].count) {
+      cursor = table.skips[state].Find(data, cursor, size);
+    }
+    state = next;
+  }
+
+  token.length = cursor - offset;
+  return token;
+}
+
+uint32_t Lexicon::Table::Entry(ContextID context) const {
+  auto const index = static_cast<uint8_t>(context);
+  if (index >= entries.size()) {
+    throw std::out_of_range("unknown lexical context");
+  }
+  return entries[index];
+}
+
+SymbolID Lexicon::Table::Resolve(std::string_view word, SymbolID term,
+                                 ContextID context) const {
+  if (keywords.empty() || word.size() > longest) return term;
+
+  auto const hash = Hash(word, seed);
+  auto const bucket = (hash >> 32) & (displacements.size() - 1);
+  auto const& slot =
+      keywords[Slot(hash, displacements[bucket], keywords.size())];
+  if (slot.hash != hash || slot.term >= term) return term;
+  if (slot.text != word) return term;
+  if (!slot.contexts.test(static_cast<uint8_t>(context))) return term;
+  return slot.term;
+}
+
+uint64_t Lexicon::Table::Hash(std::string_view word, uint64_t seed) {
+  auto const* data = word.data();
+  auto const size = word.size();
+  uint64_t hash = size ^ (seed * 0x9E3779B97F4A7C15UL);
+  auto offset = 0UL;
+  for (; offset + 8 <= size; offset += 8) {
+    uint64_t chunk;
+    std::memcpy(&chunk, data + offset, 8);
+    hash = (hash ^ chunk) * 0xFF51AFD7ED558CCDUL;
+    hash ^= hash >> 29;
+  }
+  if (offset < size) {
+    uint64_t chunk = 0;
+    for (auto i = offset; i < size; ++i) {
+      chunk = chunk << 8 | static_cast<uint8_t>(data[i]);
+    }
+    hash = (hash ^ chunk) * 0xFF51AFD7ED558CCDUL;
+    hash ^= hash >> 29;
+  }
+  return hash;
+}
+
+size_t Lexicon::Table::Slot(uint64_t hash, uint32_t displacement,
+                            size_t slots) {
+  auto const step = (hash >> 8) | 1;
+  return (hash + displacement * step) & (slots - 1);
+}
+
+size_t Lexicon::Table::Skip::Find(char const* data, size_t cursor,
+                                  size_t size) const {
+#if defined(__AVX2__)
+  while (cursor + 32 <= size) {
+    auto const block = _mm256_loadu_si256(
+        reinterpret_cast<__m256i const*>(data + cursor));
+    auto hits = _mm256_setzero_si256();
+    for (auto i = 0; i < count; ++i) {
+      auto const key = _mm256_set1_epi8(bytes[i]);
+      hits = _mm256_or_si256(hits, _mm256_cmpeq_epi8(block, key));
+    }
+    auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(hits));
+    if (loop) mask = ~mask;
+    if (mask) return cursor + std::countr_zero(mask);
+    cursor += 32;
+  }
+#elif defined(__SSE2__)
+  while (cursor + 16 <= size) {
+    auto const block =
+        _mm_loadu_si128(reinterpret_cast<__m128i const*>(data + cursor));
+    auto hits = _mm_setzero_si128();
+    for (auto i = 0; i < count; ++i) {
+      auto const key = _mm_set1_epi8(bytes[i]);
+      hits = _mm_or_si128(hits, _mm_cmpeq_epi8(block, key));
+    }
+    auto mask = static_cast<uint32_t>(_mm_movemask_epi8(hits));
+    if (loop) mask = ~mask & 0xFFFF;
+    if (mask) return cursor + std::countr_zero(mask);
+    cursor += 16;
+  }
+#endif
+  while (cursor < size && !exits.Contains(data[cursor])) ++cursor;
+  return cursor;
+}
+
 nlohmann::json Lexicon::Store() const {
+  if (lazy || (table && table->accepts.size() != states.size())) {
+    throw NotMaterialized{};
+  }
+
+  auto json = StoreMeta();
+  for (auto const& state : states) {
+    nlohmann::json s;
+    if (state.accepts) s["accepts"] = *state.accepts;
+    for (auto const& [ch, st] : state.transitions) {
+      s["transitions"][std::to_string(ch)] = st;
+    }
+    json["states"].push_back(s);
+  }
+  return json;
+}
+
+nlohmann::json Lexicon::StoreMeta() const {
   nlohmann::json json;
   for (auto const& term : terms) {
     nlohmann::json t;
     t["name"] = term.name;
+    if (!term.keyword.empty()) t["keyword"] = term.keyword;
     // TODO 尚未实现正则表达式转文本，暂时不保存正则表达式
     for (auto const& entry : term.entries) {
       t["entries"].push_back(entry);
@@ -37,14 +709,6 @@ nlohmann::json Lexicon::Store() const {
   }
 
   json["contexts"] = contexts;
-  for (auto const& state : states) {
-    nlohmann::json s;
-    if (state.accepts) s["accepts"] = *state.accepts;
-    for (auto const& [ch, st] : state.transitions) {
-      s["transitions"][std::to_string(ch)] = st;
-    }
-    json["states"].push_back(s);
-  }
   return json;
 }
 
@@ -53,6 +717,7 @@ Lex Lexicon::Load(nlohmann::json const& json) {
   for (auto const& t : json["terms"]) {
     Lexicon::Term term{};
     term.name = t["name"];
+    if (t.contains("keyword")) term.keyword = t["keyword"];
     if (t.contains("entries"))
       for (auto const& entry : t["entries"]) {
         term.entries.insert(entry.get<char>());
@@ -72,6 +737,7 @@ Lex Lexicon::Load(nlohmann::json const& json) {
     lex->states.push_back(state);
   }
 
+  lex->Compile();
   return lex;
 }
 
@@ -102,13 +768,10 @@ Lexicon::Builder& Lexicon::Builder::Define(
 
   auto id = lex_->terms.size();
   lex_->terms.push_back({name, pattern, entries});
-  RegexTree::AcceptNode::On(pattern, id);
 
-  if (regex_ == nullptr) {
-    regex_ = pattern;
-  } else {
-    regex_ = RegexTree::UnionNode::Of(regex_, pattern);
-  }
+  auto const root = arena_.Add(pattern);
+  arena_.Accept(root, id);
+  patterns_.emplace(id, root);
 
   return *this;
 }
@@ -127,98 +790,498 @@ Lexicon::Builder& Lexicon::Builder::Annotate(std::string const& term,
       "Cannot find term {} to annotate with {} = {}", term, key, value.dump()));
 }
 
+Lexicon::Builder& Lexicon::Builder::Minimize(bool enable) {
+  minimize_ = enable;
+  return *this;
+}
+
+Lexicon::Builder& Lexicon::Builder::Keywords(bool enable) {
+  auto_keywords_ = enable;
+  return *this;
+}
+
+Lexicon::Builder& Lexicon::Builder::Keyword(std::string const& term) {
+  keywords_.insert(term);
+  return *this;
+}
+
+Lexicon::Builder& Lexicon::Builder::Lazy(size_t budget) {
+  lazy_ = budget;
+  return *this;
+}
+
+namespace {
+
+/**
+ * 若正则表达式只由单个字符连接而成，将其文本追加到 text 并返回 true
+ */
+bool LiteralOf(RegexTree& node, std::string& text) {
+  if (auto ch = dynamic_cast<RegexTree::CharNode*>(&node)) {
+    text += ch->ch_;
+    return true;
+  }
+  if (auto concat = dynamic_cast<RegexTree::ConcatNode*>(&node)) {
+    return LiteralOf(*concat->left_, text) && LiteralOf(*concat->right_, text);
+  }
+  return false;
+}
+
+}  // namespace
+
+void Lexicon::Builder::ExtractKeywords() {
+  auto& terms = lex_->terms;
+  auto const& positions = arena_.positions;
+
+  for (auto const& name : keywords_) {
+    auto it = std::find_if(terms.begin(), terms.end(),
+                           [&](auto const& term) { return term.name == name; });
+    if (it == terms.end()) throw InvalidKeyword(name);
+  }
+
+  std::map<std::string, std::vector<SymbolID>> literals;
+  std::set<SymbolID> literal_terms;
+  for (auto const& [id, _] : patterns_) {
+    std::string text;
+    if (!LiteralOf(*terms[id].pattern, text)) continue;
+    literals[text].push_back(id);
+    literal_terms.insert(id);
+  }
+
+  /**
+   * 在宿主单词的位置上逐字节模拟，判断宿主能否完整匹配文本
+   */
+  auto accepts = [&](SymbolID host, std::string const& text) {
+    auto const span = arena_.nodes[patterns_.at(host)].firstpos;
+    std::vector<uint32_t> current(arena_.begin(span), arena_.end(span));
+    std::vector<uint32_t> next;
+    for (auto const ch : text) {
+      next.clear();
+      for (auto const pos : current) {
+        if (!positions[pos].chars.Contains(ch)) continue;
+        auto const& follow = positions[pos].followpos;
+        next.insert(next.end(), follow.begin(), follow.end());
+      }
+      std::sort(next.begin(), next.end());
+      next.erase(std::unique(next.begin(), next.end()), next.end());
+      current.swap(next);
+    }
+    return std::any_of(current.begin(), current.end(), [&](auto pos) {
+      return positions[pos].accept == host;
+    });
+  };
+
+  /**
+   * 宿主不能是字面量单词，且必须在关键字的全部上下文中生效
+   */
+  auto hosts = [&](SymbolID host, Term const& keyword,
+                   std::string const& text) {
+    if (literal_terms.count(host)) return false;
+    auto const& scope = terms[host].entries;
+    auto const& entries = keyword.entries;
+    auto const covered =
+        scope.empty() ||
+        (!entries.empty() && std::includes(scope.begin(), scope.end(),
+                                           entries.begin(), entries.end()));
+    return covered && accepts(host, text);
+  };
+
+  for (auto const& [text, ids] : literals) {
+    for (auto const id : ids) {
+      auto& term = terms[id];
+      auto const declared = keywords_.count(term.name) != 0;
+      if (!declared && !auto_keywords_) continue;
+
+      auto const hosted =
+          ids.size() == 1 &&
+          std::any_of(patterns_.begin(), patterns_.end(), [&](auto const& p) {
+            return hosts(p.first, term, text);
+          });
+      if (hosted) {
+        term.keyword = text;
+      } else if (declared) {
+        throw InvalidKeyword(term.name);
+      }
+    }
+  }
+}
+
 Lex Lexicon::Builder::Build() {
-  regex_->CalcFollowpos();
+  ExtractKeywords();
 
-  std::vector<StateID> pending_states;
-  std::map<StateID, RegexTree::Leafs> state_pos_map;
+  /**
+   * 位置的后继、匹配的字节和接受的单词已在定义单词时展开到存储中
+   */
+  auto const& positions = arena_.positions;
 
+  std::vector<std::vector<uint32_t>> term_firstpos(lex_->terms.size());
+  for (auto const& [id, root] : patterns_) {
+    auto const span = arena_.nodes[root].firstpos;
+    term_firstpos[id].assign(arena_.begin(span), arena_.end(span));
+  }
+
+  /**
+   * 将字节划分为等价类，同一等价类的字节被全部位置同等对待
+   *
+   * 等价类按最小字节排序，保证新状态的发现顺序与逐字节尝试时一致
+   */
+  std::vector<CharSet> classes{};
   {
-    // 起始状态
-    lex_->states.push_back({});
+    CharSet bytes = ~CharSet{};
+    bytes.reset(0);
+    classes.push_back(bytes);
+
+    std::unordered_set<std::bitset<256>> distinct;
+    for (auto const& position : positions) distinct.insert(position.chars);
+    for (auto const& match : distinct) {
+      std::vector<CharSet> refined;
+      for (auto const& cls : classes) {
+        CharSet const in = cls & match;
+        CharSet const out = cls & ~match;
+        if (in.any()) refined.push_back(in);
+        if (out.any()) refined.push_back(out);
+      }
+      classes.swap(refined);
+    }
+
+    std::sort(classes.begin(), classes.end(),
+              [](auto const& lhs, auto const& rhs) {
+                return lhs.First() < rhs.First();
+              });
+  }
 
-    // 每个上下文拥有一个首位置状态，包含当前上下文能接受的全部首位置
-    auto ctxend = static_cast<char>(lex_->contexts.size());
-    for (char ctxid = 0; ctxid < ctxend; ctxid++) {
-      // 创建首状态
-      auto const stateid = lex_->states.size();
-      pending_states.push_back(stateid);
-      lex_->states.push_back({});
+  std::vector<std::vector<char>> class_bytes(classes.size());
+  for (auto cls = 0UL; cls < classes.size(); ++cls) {
+    for (auto c = 1; c <= 255; ++c) {
+      if (!classes[cls].test(c)) continue;
+      class_bytes[cls].push_back(static_cast<char>(c));
+    }
+  }
+
+  std::vector<std::vector<size_t>> position_classes(positions.size());
+  for (auto pos = 0UL; pos < positions.size(); ++pos) {
+    for (auto cls = 0UL; cls < classes.size(); ++cls) {
+      if (positions[pos].chars.test(classes[cls].First())) {
+        position_classes[pos].push_back(cls);
+      }
+    }
+  }
 
-      // 对起始状态来说上下文id被用作输入
-      lex_->states.front().transitions.emplace(ctxid, stateid);
+  /**
+   * 每个上下文的首位置集合包含当前上下文能接受的全部首位置
+   */
+  auto const ncontexts = lex_->contexts.size();
+  std::vector<std::vector<uint32_t>> entry_firstpos(ncontexts);
+  for (auto ctxid = 0UL; ctxid < ncontexts; ctxid++) {
+    auto& firstpos = entry_firstpos[ctxid];
+    for (auto id = 0UL; id < lex_->terms.size(); ++id) {
+      auto const& term = lex_->terms.at(id);
+      if (!term.pattern || !term.keyword.empty()) continue;
+      if (!term.entries.empty() && term.entries.count(ctxid) == 0) continue;
 
-      // 计算当前上下文能接受的首位置
-      for (auto const& term : lex_->terms) {
-        if (!term.pattern) continue;
-        if (!term.entries.empty() && term.entries.count(ctxid) == 0) continue;
+      auto const& pos = term_firstpos[id];
+      firstpos.insert(firstpos.end(), pos.begin(), pos.end());
+    }
+    std::sort(firstpos.begin(), firstpos.end());
+    firstpos.erase(std::unique(firstpos.begin(), firstpos.end()),
+                   firstpos.end());
+  }
 
-        auto pos = term.pattern->GetFirstpos();
-        state_pos_map[stateid].insert(pos.begin(), pos.end());
+  /**
+   * 惰性构造时只保留位置信息，字节 0 不被任何位置匹配，单独作为最后一个等价类
+   */
+  if (lazy_) {
+    auto lazy = std::make_shared<Lexicon::Lazy>();
+    lazy->budget = lazy_;
+    lazy->width = classes.size() + 1;
+    lazy->classes.fill(classes.size());
+    for (auto cls = 0UL; cls < classes.size(); ++cls) {
+      for (auto const ch : class_bytes[cls]) {
+        lazy->classes[static_cast<uint8_t>(ch)] = cls;
       }
     }
+    for (auto pos = 0UL; pos < positions.size(); ++pos) {
+      auto& matches = lazy->matches.emplace_back();
+      for (auto const cls : position_classes[pos]) matches.set(cls);
+      lazy->followpos.push_back(positions[pos].followpos);
+      lazy->accepts.push_back(positions[pos].accept.value_or(Table::kReject));
+    }
+    lazy->firstpos = std::move(entry_firstpos);
+    lex_->lazy = lazy;
+    lex_->Compile();
+    return lex_;
+  }
+
+  /**
+   * 状态与位置集合互相映射，位置集合由散列表驻留
+   */
+  std::vector<StateID> pending_states;
+  std::vector<std::vector<uint32_t>> state_positions;
+  std::unordered_map<std::vector<uint32_t>, StateID, Lazy::Hash> interned;
+
+  // 起始状态
+  lex_->states.push_back({});
+  state_positions.push_back({});
+
+  // 每个上下文拥有一个首位置状态
+  auto ctxend = static_cast<char>(ncontexts);
+  for (char ctxid = 0; ctxid < ctxend; ctxid++) {
+    auto& firstpos = entry_firstpos[ctxid];
+
+    // 创建首状态，对起始状态来说上下文id被用作输入
+    auto const stateid = lex_->states.size();
+    pending_states.push_back(stateid);
+    lex_->states.push_back({});
+    lex_->states.front().transitions.emplace(ctxid, stateid);
+    interned.emplace(firstpos, stateid);
+    state_positions.push_back(std::move(firstpos));
   }
 
   // 处理尚未处理的状态
+  std::vector<std::vector<uint32_t>> targets(class_bytes.size());
   while (!pending_states.empty()) {
-    // 收集当前状态信息
     auto const state_id = pending_states.back();
-    auto const& current_pos = state_pos_map.at(state_id);
-
-    // 将状态标记为已处理
     pending_states.pop_back();
 
-    // 计算当前状态接受的词法记号
-    for (auto const& posit : current_pos) {
-      if (auto accept = std::dynamic_pointer_cast<RegexTree::AcceptNode>(posit);
-          accept != nullptr) {
-        auto& state = lex_->states.at(state_id);
-        // 词法记号ID越小，优先级越高
-        if (!state.accepts || accept->term_ < state.accepts) {
-          state.accepts = accept->term_;
-        }
+    // 计算当前状态接受的词法记号，词法记号ID越小，优先级越高
+    for (auto const pos : state_positions[state_id]) {
+      auto& state = lex_->states.at(state_id);
+      auto const& accept = positions[pos].accept;
+      if (accept && (!state.accepts || *accept < *state.accepts)) {
+        state.accepts = accept;
       }
     }
 
-    // 计算当前状态的出度转移
-    for (auto c = 1; c <= 255; c++) {
-      auto const ch = static_cast<char>(c);
-      RegexTree::Leafs followpos;
+    // 按等价类收集当前状态能到达的所有位置
+    for (auto const pos : state_positions[state_id]) {
+      for (auto const cls : position_classes[pos]) {
+        auto& target = targets[cls];
+        auto const& follow = positions[pos].followpos;
+        target.insert(target.end(), follow.begin(), follow.end());
+      }
+    }
+
+    for (auto cls = 0UL; cls < class_bytes.size(); ++cls) {
+      auto& target = targets[cls];
+      if (target.empty()) continue;
 
-      // 收集当前输入字符能到达的所有位置
-      for (auto it : current_pos) {
-        if (!it->Match(ch)) continue;
+      std::sort(target.begin(), target.end());
+      target.erase(std::unique(target.begin(), target.end()), target.end());
 
-        followpos.insert(it->followpos_.begin(), it->followpos_.end());
+      // 若当前等价类能到达的状态尚未创建，则创建之
+      auto [it, created] = interned.emplace(target, lex_->states.size());
+      if (created) {
+        pending_states.push_back(it->second);
+        lex_->states.push_back({});
+        state_positions.push_back(target);
       }
 
-      // 若当前输入字符不能到达任何位置，则跳过
-      if (followpos.empty()) continue;
+      // 添加转移
+      for (auto const ch : class_bytes[cls]) {
+        lex_->states.at(state_id).transitions.emplace(ch, it->second);
+      }
+      target.clear();
+    }
+  }
 
-      // 计算当前输入字符能到达的状态
-      StateID next_state_id = 0;
-      for (auto const& [candidate_state_id, candidate_state_pos] :
-           state_pos_map) {
-        if (candidate_state_pos != followpos) continue;
+  if (minimize_) MinimizeStates();
 
-        next_state_id = candidate_state_id;
-        break;
+  lex_->Compile();
+  return lex_;
+}
+
+namespace {
+
+/**
+ * 可细化的状态划分
+ *
+ * 同一分组的元素在 elems 中连续存放，[first, mid) 区间为被标记的元素
+ */
+struct Partition {
+  static constexpr size_t npos = -1UL;
+
+  std::vector<size_t> elems{};  // 按分组排列的元素
+  std::vector<size_t> loc{};    // 元素 -> 在 elems 中的下标
+  std::vector<size_t> group{};  // 元素 -> 所在分组
+  std::vector<size_t> first{};  // 分组 -> 起始下标
+  std::vector<size_t> end{};    // 分组 -> 结束下标
+  std::vector<size_t> mid{};    // 分组 -> 标记区间的结束下标
+
+  /**
+   * 依据元素的键构造初始划分，键相同的元素被划分到同一分组
+   */
+  explicit Partition(std::vector<size_t> const& keys)
+      : elems(keys.size()), loc(keys.size()), group(keys.size()) {
+    std::iota(elems.begin(), elems.end(), 0);
+    std::stable_sort(elems.begin(), elems.end(),
+                     [&](auto a, auto b) { return keys[a] < keys[b]; });
+    for (auto i = 0UL; i < elems.size(); ++i) {
+      auto const e = elems[i];
+      if (i == 0 || keys[e] != keys[elems[i - 1]]) {
+        if (i != 0) end.push_back(i);
+        first.push_back(i);
+        mid.push_back(i);
       }
+      loc[e] = i;
+      group[e] = first.size() - 1;
+    }
+    if (!elems.empty()) end.push_back(elems.size());
+  }
 
-      // 若当前输入字符能到达的状态尚未创建，则创建之
-      if (next_state_id == 0) {
-        next_state_id = lex_->states.size();
-        pending_states.push_back(next_state_id);
-        lex_->states.push_back({});
-        state_pos_map.emplace(next_state_id, followpos);
+  size_t Size(size_t g) const { return end[g] - first[g]; }
+
+  void Mark(size_t e) {
+    auto const g = group[e];
+    auto const i = loc[e];
+    auto const j = mid[g];
+    if (i < j) return;
+
+    std::swap(elems[i], elems[j]);
+    loc[elems[i]] = i;
+    loc[elems[j]] = j;
+    mid[g]++;
+  }
+
+  /**
+   * 将分组中被标记的元素分离为新的分组，返回新分组或 npos
+   */
+  size_t Split(size_t g) {
+    if (mid[g] == end[g]) {
+      mid[g] = first[g];
+      return npos;
+    }
+
+    auto const ng = first.size();
+    first.push_back(first[g]);
+    end.push_back(mid[g]);
+    mid.push_back(first[g]);
+    for (auto i = first[ng]; i < end[ng]; ++i) group[elems[i]] = ng;
+
+    first[g] = mid[g];
+    return ng;
+  }
+};
+
+}  // namespace
+
+void Lexicon::Builder::MinimizeStates() {
+  auto& states = lex_->states;
+  auto const nstates = states.size();
+
+  /**
+   * 缺失的转移视作通往隐含的死状态
+   *
+   * 死状态独占一个分组且永不分裂，因此不需要计算它的前驱
+   */
+  auto const dead = nstates;
+
+  /**
+   * 反向转移表 state -> [<input, source>]
+   */
+  std::vector<std::vector<std::pair<uint8_t, StateID>>> inverse(nstates);
+  for (auto state = 1UL; state < nstates; ++state) {
+    for (auto const& [ch, next] : states.at(state).transitions) {
+      inverse.at(next).emplace_back(static_cast<uint8_t>(ch), state);
+    }
+  }
+
+  /**
+   * 初始划分：起始状态和死状态各自独立，其余状态按接受的单词分组
+   * 起始状态的转移以上下文为输入，不参与等价判定
+   */
+  std::vector<size_t> keys(nstates + 1);
+  keys[0] = 0;
+  keys[dead] = 1;
+  for (auto state = 1UL; state < nstates; ++state) {
+    auto const& accepts = states.at(state).accepts;
+    keys[state] = accepts ? *accepts + 3 : 2;
+  }
+  Partition partition{keys};
+
+  std::vector<size_t> pending;
+  std::vector<bool> in_pending;
+  for (auto g = 0UL; g < partition.first.size(); ++g) {
+    auto const is_dead = partition.group[dead] == g;
+    in_pending.push_back(!is_dead);
+    if (!is_dead) pending.push_back(g);
+  }
+
+  std::array<std::vector<StateID>, 256> sources;
+  std::vector<size_t> touched;
+  while (!pending.empty()) {
+    auto const splitter = pending.back();
+    pending.pop_back();
+    in_pending[splitter] = false;
+
+    /**
+     * 先收集分裂者在每个输入上的前驱，再依次细化
+     */
+    for (auto i = partition.first[splitter]; i < partition.end[splitter];
+         ++i) {
+      for (auto const& [input, source] : inverse[partition.elems[i]]) {
+        sources[input].push_back(source);
       }
+    }
 
-      // 添加转移
-      lex_->states.at(state_id).transitions.emplace(ch, next_state_id);
+    for (auto& predecessors : sources) {
+      if (predecessors.empty()) continue;
+
+      for (auto const source : predecessors) {
+        auto const g = partition.group[source];
+        if (partition.mid[g] == partition.first[g]) touched.push_back(g);
+        partition.Mark(source);
+      }
+
+      for (auto const g : touched) {
+        auto const ng = partition.Split(g);
+        if (ng == Partition::npos) continue;
+
+        in_pending.push_back(false);
+        if (in_pending[g] || partition.Size(ng) <= partition.Size(g)) {
+          pending.push_back(ng);
+          in_pending[ng] = true;
+        } else {
+          pending.push_back(g);
+          in_pending[g] = true;
+        }
+      }
+
+      touched.clear();
+      predecessors.clear();
     }
   }
 
-  return lex_;
+  /**
+   * 按分组中最小的原状态ID排列新状态，起始状态保持ID为0
+   */
+  auto const ngroups = partition.first.size();
+  std::vector<StateID> representative(ngroups, dead);
+  for (auto state = 0UL; state < nstates; ++state) {
+    auto& rep = representative[partition.group[state]];
+    rep = std::min(rep, state);
+  }
+
+  std::vector<StateID> reps;
+  for (auto const rep : representative) {
+    if (rep != dead) reps.push_back(rep);
+  }
+  std::sort(reps.begin(), reps.end());
+
+  std::vector<StateID> renumber(ngroups);
+  for (auto id = 0UL; id < reps.size(); ++id) {
+    renumber[partition.group[reps[id]]] = id;
+  }
+
+  std::vector<State> minimized;
+  minimized.reserve(reps.size());
+  for (auto const rep : reps) {
+    auto state = states.at(rep);
+    for (auto& [_, next] : state.transitions) {
+      next = renumber[partition.group[next]];
+    }
+    minimized.push_back(std::move(state));
+  }
+
+  states = std::move(minimized);
 }
 
 }  // namespace alioth
\ No newline at end of file
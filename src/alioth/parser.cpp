@@ -1,11 +1,44 @@
 #include "alioth/parser.h"
 
+#include <algorithm>
+
 namespace alioth {
 
 Parser::Parser(Syntax syntax, Doc doc) : root_{new ASTRootNode} {
   root_->doc = doc;
   root_->syntax = syntax;
   root_->root = root_;
+  root_->atoms = std::make_shared<Atoms>();
+
+  /**
+   * 属性 intern 为 true 的单词在扫描时驻留文本
+   */
+  for (auto const& term : syntax->lex->terms) {
+    auto it = term.attributes.find("intern");
+    interned_.push_back(it != term.attributes.end() && it->second == true);
+  }
+}
+
+void Parser::UseScanner(Scanner scanner) { scanner_ = std::move(scanner); }
+
+void Parser::DropIgnored(bool enable) { drop_ignored_ = enable; }
+
+void Parser::UseAtoms(std::shared_ptr<Atoms> atoms) {
+  root_->atoms = std::move(atoms);
+}
+
+void Parser::UseTokens(std::shared_ptr<Tokenizer::Batch const> tokens,
+                       ContextID context) {
+  auto lex = root_->syntax->lex;
+  scanner_ = [lex, tokens, context](std::string_view text, size_t offset,
+                                    ContextID ctx) {
+    auto const index = tokens->Find(offset);
+    if (ctx != context || index == tokens->Size()) {
+      return lex->Scan(text, offset, ctx);
+    }
+    return Lexicon::Token{.id = tokens->ids[index],
+                          .length = tokens->lengths[index]};
+  };
 }
 
 ASTRoot Parser::Parse() {
@@ -75,7 +108,8 @@ bool Parser::IgnoreOrFalse(Thread& thread) {
 
   if (!syntax->IsIgnored(input->id)) return false;
 
-  if (auto term = input->AsTerm()) thread.ignores.push_back(term);
+  auto term = input->AsTerm();
+  if (term && !drop_ignored_) thread.ignores.push_back(term);
   thread.inputs.erase(thread.inputs.begin());
   return true;
 }
@@ -83,12 +117,28 @@ bool Parser::IgnoreOrFalse(Thread& thread) {
 bool Parser::ReduceOrFalse(Thread& thread) {
   auto syntax = root_->syntax;
   auto input = thread.inputs.front();
-  auto state = &syntax->states.at(thread.stack.back());
-  auto reduce = state->reduce.find(input->id);
-
-  if (reduce == state->reduce.end()) return false;
+  auto const& table = *syntax->table;
 
-  auto const formula = reduce->second;
+  /**
+   * 终结符在具有默认归约的状态中直接归约，不必查看展望符号
+   * 非终结符是归约结果，只能被移进
+   * 被忽略的终结符不触发默认归约，以免在归约后的状态中扫描下一个单词
+   */
+  auto const state = thread.stack.back();
+  auto formula = table.defaults[state];
+  if (formula != Syntactic::Table::kNone && syntax->IsTerm(input->id) &&
+      !syntax->IsIgnored(input->id)) {
+    if (!thread.deferred) {
+      thread.deferred = true;
+      thread.origin = state;
+      thread.before = thread.seens.empty() ? nullptr : thread.seens.back();
+    }
+  } else {
+    auto const action = table.Find(state, input->id);
+    if (action == Syntactic::Table::kNone) return false;
+    if (!(action & Syntactic::Table::kReduce)) return false;
+    formula = action & ~Syntactic::Table::kReduce;
+  }
 
   /**
    * 触发0号产生式，接受解析结果
@@ -108,8 +158,8 @@ bool Parser::ReduceOrFalse(Thread& thread) {
   /**
    * 将被忽略的符号填回句子单词串
    */
-  if (!ntrm->sentence.empty()) {
-    auto from = ntrm->First()->offset;
+  if (auto first = ntrm->First()) {
+    auto from = first->offset;
     auto to = ntrm->Last()->offset;
     auto itx = 0UL;
     auto igx = 0UL;
@@ -122,8 +172,8 @@ bool Parser::ReduceOrFalse(Thread& thread) {
       }
 
       while (itx < ntrm->sentence.size()) {
-        auto symbol = ntrm->sentence.at(itx);
-        if (ignored->offset < symbol->First()->offset) break;
+        auto symbol = ntrm->sentence.at(itx)->First();
+        if (symbol && ignored->offset < symbol->offset) break;
         ++itx;
       }
 
@@ -148,14 +198,15 @@ bool Parser::ReduceOrFalse(Thread& thread) {
 bool Parser::ShiftOrFalse(Thread& thread) {
   auto syntax = root_->syntax;
   auto input = thread.inputs.front();
-  auto state = &syntax->states.at(thread.stack.back());
-  auto shift = state->shift.find(input->id);
+  auto const action = syntax->table->Find(thread.stack.back(), input->id);
 
-  if (shift == state->shift.end()) return false;
+  if (action == Syntactic::Table::kNone) return false;
+  if (action & Syntactic::Table::kReduce) return false;
 
-  thread.stack.push_back(shift->second);
+  thread.stack.push_back(action);
   thread.seens.push_back(input);
   thread.inputs.erase(thread.inputs.begin());
+  if (syntax->IsTerm(input->id)) thread.deferred = false;
   return true;
 }
 
@@ -222,17 +273,45 @@ void Parser::Crash() {
     fmt::println(stderr,
                  "\033[1;31merror:\033[0m {}: Unexpected symbol {} ({})",
                  input->Location(), input->Name(), input->Text());
-    if (!thread.seens.empty()) {
-      auto const& last = thread.seens.back();
+
+    /**
+     * 输入经过默认归约时，报告首次默认归约前的状态和最后识别的语法单元
+     */
+    auto state = thread.stack.back();
+    auto last = thread.seens.empty() ? nullptr : thread.seens.back();
+    if (thread.deferred) {
+      state = thread.origin;
+      last = thread.before;
+    }
+    if (last) {
       fmt::println(stderr, "note: last symbol was {} ({})", last->Name(),
                    last->Text());
     }
+
+    /**
+     * 先列出归约再列出移进
+     * 从镜像得到的语法只有动作表，默认归约的展望符号不在表中
+     * 此时改为列出默认归约后出错的状态的动作，该状态没有默认归约
+     */
+    auto const& syntax = root_->syntax;
     std::vector<std::string> expected;
-    auto const& state = root_->syntax->states.at(thread.stack.back());
-    for (auto const& reduce : state.reduce)
-      expected.push_back(root_->syntax->NameOf(reduce.first));
-    for (auto const& shift : state.shift)
-      expected.push_back(root_->syntax->NameOf(shift.first));
+    if (state < syntax->states.size()) {
+      auto const& rules = syntax->states.at(state);
+      for (auto const& reduce : rules.reduce)
+        expected.push_back(syntax->NameOf(reduce.first));
+      for (auto const& shift : rules.shift)
+        expected.push_back(syntax->NameOf(shift.first));
+    } else {
+      auto const symbols = syntax->lex->terms.size() + syntax->ntrms.size();
+      std::vector<std::string> shifts;
+      for (SymbolID symbol = 0; symbol < symbols; ++symbol) {
+        auto const action = syntax->table->Find(thread.stack.back(), symbol);
+        if (action == Syntactic::Table::kNone) continue;
+        auto& names = action & Syntactic::Table::kReduce ? expected : shifts;
+        names.push_back(syntax->NameOf(symbol));
+      }
+      expected.insert(expected.end(), shifts.begin(), shifts.end());
+    }
     fmt::println(stderr, "note: expected one of {}", fmt::join(expected, ", "));
   }
   throw ParseError{};
@@ -246,84 +325,180 @@ void Parser::Clean(std::vector<size_t> const& according) {
 
 void Parser::ScanAndFork() {
   auto syntax = root_->syntax;
-  auto lex = syntax->lex;
+  std::vector<ContextID> contexts;
+  std::vector<Lexicon::Token> tokens;
+  std::vector<Lexicon::Token> found;  // 各上下文的扫描结果
+
+  /**
+   * 所有分析线路都已越过的单词不会再被读取
+   */
+  auto const least = std::min_element(
+      threads_.begin(), threads_.end(),
+      [](auto const& a, auto const& b) { return a.offset < b.offset; });
+  if (least != threads_.end()) {
+    auto const offset = least->offset;
+    std::erase_if(memo_, [&](auto const& m) { return m.offset < offset; });
+  }
 
   for (auto i = 0UL; i < threads_.size(); i++) {
     if (!threads_[i].inputs.empty()) continue;
 
-    auto& state = syntax->states.at(threads_[i].stack.back());
-    if (state.contexts.empty() || state.contexts.size() == 1) {
+    auto const scope = syntax->table->Contexts(threads_[i].stack.back());
+    if (scope.size() <= 1) {
       auto& thread = threads_[i];
-      auto context = state.contexts.empty() ? 0 : *state.contexts.begin();
+      auto context = scope.empty() ? 0 : scope.front();
       auto term = Scan(thread, context);
       thread.inputs.push_back(term);
       continue;
     }
 
+    /**
+     * 只扫描未命中缓存的上下文
+     */
     auto const offset = threads_[i].offset;
+    contexts.clear();
+    found.clear();
+    for (auto const context : scope) {
+      if (auto memoized = Recall(offset, context)) {
+        stats_.hits++;
+        found.push_back(*memoized);
+      } else {
+        stats_.misses++;
+        found.push_back({});
+        contexts.push_back(context);
+      }
+    }
 
-    std::set<std::tuple<SymbolID, size_t, size_t>> seen;  // id, offset, length
-    for (auto const& context : state.contexts) {
-      if (seen.empty()) {
-        auto term = Scan(threads_[i], context);
+    if (!contexts.empty()) {
+      Scan(threads_[i].stack.back(), offset, contexts, tokens);
+    }
+    auto next = 0UL;
+    for (auto j = 0UL; j < found.size() && next < contexts.size(); ++j) {
+      if (scope[j] != contexts[next]) continue;
+      found[j] = tokens[next++];
+      memo_.push_back({offset, scope[j], found[j]});
+    }
+
+    /**
+     * 扫描结果不同的上下文分离为新的分析线路
+     */
+    auto const stack = threads_[i].stack;
+    auto const seens = threads_[i].seens;
+    for (auto it = found.begin(); it != found.end(); ++it) {
+      auto same = std::find_if(found.begin(), it, [&](auto& t) {
+        return t.id == it->id && t.length == it->length;
+      });
+      if (same != it) continue;
+
+      auto const term = Term(offset, *it);
+      if (it == found.begin()) {
+        threads_[i].offset = offset + term->length;
         threads_[i].inputs.push_back(term);
-        seen.insert({term->id, term->offset, term->length});
         continue;
       }
 
-      Thread th{.offset = offset};
-      auto term = Scan(th, context);
-      auto tuple = std::make_tuple(term->id, term->offset, term->length);
-      if (!seen.insert(tuple).second) continue;
-
       threads_.push_back(Thread{
-          .offset = th.offset,
-          .stack = threads_[i].stack,
-          .seens = threads_[i].seens,
+          .offset = offset + term->length,
+          .stack = stack,
+          .seens = seens,
           .inputs = {term},
       });
     }
   }
 }
 
+Lexicon::Token const* Parser::Recall(size_t offset, ContextID context) const {
+  for (auto const& m : memo_) {
+    if (m.offset == offset && m.context == context) return &m.token;
+  }
+  return nullptr;
+}
+
 ASTTerm Parser::Scan(Thread& thread, ContextID context) {
   auto doc = root_->doc;
   auto syntax = root_->syntax;
-  auto lex = syntax->lex;
-
-  auto term = root_->Term(Lexicon::kEOF, thread.offset);
-  if (thread.offset >= doc->content.size()) return term;
-
-  auto start = lex->states.front();
-  auto state = start.transitions.at(context);
-
-  while (state != 0 && thread.offset <= doc->content.size()) {
-    auto const ch = doc->content[thread.offset];
-    auto const& st = lex->states.at(state);
-    auto next = st.transitions.find(ch);
-    if (next == st.transitions.end()) {
-      state = 0;
-      if (st.accepts) {
-        term->id = *st.accepts;
-        break;
-      }
-    } else {
-      state = next->second;
+
+  /**
+   * 只有一条分析线路时，它越过的单词不会再被任何线路读取，无需缓存
+   * 先前分叉的线路留下的缓存仍可命中，缓存为空时查找没有开销
+   */
+  auto const alone = threads_.size() == 1;
+
+  for (;;) {
+    if (auto memoized = Recall(thread.offset, context)) {
+      stats_.hits++;
+      auto term = Term(thread.offset, *memoized);
+      thread.offset += memoized->length;
+      return term;
+    }
+
+    stats_.misses++;
+    auto token = scanner_
+                     ? scanner_(doc->content, thread.offset, context)
+                     : syntax->lex->Scan(doc->content, thread.offset, context);
+
+    /**
+     * 丢弃被忽略的单词时直接越过它，不创建终结符
+     */
+    if (drop_ignored_ && syntax->IsIgnored(token.id)) {
+      thread.offset += token.length;
+      continue;
+    }
+
+    auto term = Term(thread.offset, token);
+    if (!alone) memo_.push_back({thread.offset, context, token});
+    thread.offset += token.length;
+    return term;
+  }
+}
+
+void Parser::Scan(StateID state, size_t offset,
+                  std::vector<ContextID> const& contexts,
+                  std::vector<Lexicon::Token>& tokens) {
+  auto doc = root_->doc;
+  auto syntax = root_->syntax;
+  auto const product =
+      scanner_ ? nullptr : syntax->table->Join(state, *syntax->lex);
+  if (product) {
+    /**
+     * 乘积状态机扫描状态的全部上下文，只保留要求的部分
+     */
+    syntax->lex->Scan(doc->content, offset, *product, tokens);
+    auto next = 0UL;
+    for (auto j = 0UL; j < tokens.size() && next < contexts.size(); ++j) {
+      if (product->contexts[j] == contexts[next]) tokens[next++] = tokens[j];
     }
+    tokens.resize(next);
+    return;
+  }
+  if (!scanner_) {
+    return syntax->lex->Scan(doc->content, offset, contexts, tokens);
+  }
 
-    term->id = Lexicon::kERR;
-    term->length++;
-    thread.offset++;
+  tokens.clear();
+  for (auto const context : contexts) {
+    tokens.push_back(scanner_(doc->content, offset, context));
   }
+}
+
+ASTTerm Parser::Term(size_t offset, Lexicon::Token const& token) {
+  auto lex = root_->syntax->lex;
+  auto term = root_->Term(token.id, offset, token.length);
 
   /**
    * 为终结符指定初始属性
    */
   if (term->id != Lexicon::kEOF && term->id != Lexicon::kERR) {
     term->attributes = lex->terms.at(term->id).attributes;
+    if (interned_[term->id]) {
+      auto text = std::string_view(root_->doc->content);
+      term->atom = root_->atoms->Intern(text.substr(offset, token.length));
+    }
   }
 
   return term;
 }
 
+Parser::Statistics const& Parser::Stats() const { return stats_; }
+
 }  // namespace alioth
\ No newline at end of file
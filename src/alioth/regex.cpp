@@ -1,116 +1,25 @@
 #include "alioth/regex.h"
 
+#include <algorithm>
 #include <optional>
 
 #include "alioth/strings.h"
 
 namespace alioth {
 
-void RegexTree::LeafNode::CalcFollowpos() { /** 无动作 */ }
-
-bool RegexTree::AcceptNode::GetNullable() { return {}; }
-RegexTree::Leafs RegexTree::AcceptNode::GetFirstpos() { return {}; }
-RegexTree::Leafs RegexTree::AcceptNode::GetLastpos() { return {}; }
-bool RegexTree::AcceptNode::Match(char) { return {}; }
-
-bool RegexTree::CharNode::GetNullable() { return false; }
-RegexTree::Leafs RegexTree::CharNode::GetFirstpos() {
-  return {shared_from_this()};
-}
-RegexTree::Leafs RegexTree::CharNode::GetLastpos() {
-  return {shared_from_this()};
-}
 bool RegexTree::CharNode::Match(char ch) { return ch_ == ch; }
-
-bool RegexTree::RangeNode::GetNullable() { return false; }
-RegexTree::Leafs RegexTree::RangeNode::GetFirstpos() {
-  return {shared_from_this()};
-}
-RegexTree::Leafs RegexTree::RangeNode::GetLastpos() {
-  return {shared_from_this()};
-}
-bool RegexTree::RangeNode::Match(char ch) {
-  return includes_ == (0 != set_.count(ch));
+CharSet RegexTree::CharNode::Matches() {
+  return ch_ ? CharSet{}.Insert(ch_) : CharSet{};
 }
 
-bool RegexTree::ConcatNode::GetNullable() {
-  return left_->GetNullable() && right_->GetNullable();
-}
-RegexTree::Leafs RegexTree::ConcatNode::GetFirstpos() {
-  auto set = left_->GetFirstpos();
-  if (left_->GetNullable()) set.merge(right_->GetFirstpos());
-  return set;
-}
-RegexTree::Leafs RegexTree::ConcatNode::GetLastpos() {
-  auto set = right_->GetLastpos();
-  if (right_->GetNullable()) set.merge(left_->GetLastpos());
-  return set;
-}
-void RegexTree::ConcatNode::CalcFollowpos() {
-  left_->CalcFollowpos();
-  right_->CalcFollowpos();
-
-  for (auto& node : left_->GetLastpos()) {
-    node->followpos_.merge(right_->GetFirstpos());
-  }
-}
-
-bool RegexTree::UnionNode::GetNullable() {
-  return left_->GetNullable() || right_->GetNullable();
-}
-RegexTree::Leafs RegexTree::UnionNode::GetFirstpos() {
-  auto set = left_->GetFirstpos();
-  set.merge(right_->GetFirstpos());
-  return set;
-}
-RegexTree::Leafs RegexTree::UnionNode::GetLastpos() {
-  auto set = left_->GetLastpos();
-  set.merge(right_->GetLastpos());
-  return set;
-}
-void RegexTree::UnionNode::CalcFollowpos() {
-  left_->CalcFollowpos();
-  right_->CalcFollowpos();
-}
-
-bool RegexTree::KleeneNode::GetNullable() { return true; }
-RegexTree::Leafs RegexTree::KleeneNode::GetFirstpos() {
-  return child_->GetFirstpos();
-}
-RegexTree::Leafs RegexTree::KleeneNode::GetLastpos() {
-  return child_->GetLastpos();
-}
-void RegexTree::KleeneNode::CalcFollowpos() {
-  child_->CalcFollowpos();
-
-  for (auto& node : child_->GetLastpos()) {
-    node->followpos_.merge(child_->GetFirstpos());
-  }
-}
-
-bool RegexTree::PositiveNode::GetNullable() { return child_->GetNullable(); }
-RegexTree::Leafs RegexTree::PositiveNode::GetFirstpos() {
-  return child_->GetFirstpos();
-}
-RegexTree::Leafs RegexTree::PositiveNode::GetLastpos() {
-  return child_->GetLastpos();
-}
-void RegexTree::PositiveNode::CalcFollowpos() {
-  child_->CalcFollowpos();
-
-  for (auto& node : child_->GetLastpos()) {
-    node->followpos_.merge(child_->GetFirstpos());
-  }
-}
-
-bool RegexTree::OptionalNode::GetNullable() { return true; }
-RegexTree::Leafs RegexTree::OptionalNode::GetFirstpos() {
-  return child_->GetFirstpos();
+bool RegexTree::RangeNode::Match(char ch) {
+  return includes_ == set_.Contains(ch);
 }
-RegexTree::Leafs RegexTree::OptionalNode::GetLastpos() {
-  return child_->GetLastpos();
+CharSet RegexTree::RangeNode::Matches() {
+  CharSet matches = includes_ ? set_ : CharSet{~set_};
+  matches.reset(0);
+  return matches;
 }
-void RegexTree::OptionalNode::CalcFollowpos() { child_->CalcFollowpos(); }
 
 std::string const& RegexTree::Operators() {
   static std::string str = "+*?|()";
@@ -118,228 +27,376 @@ std::string const& RegexTree::Operators() {
 }
 
 /**
- * 从start位置分析一个由方括号引领的字符类表达式，成功则原地归约，失败则抛出异常
+ * 从offset位置分析一个由方括号引领的字符类表达式，成功则返回字符类节点
+ * 并将offset移动到右方括号之后，失败则抛出异常
  */
-void RegexTree::ParseRange(std::vector<Unit>& input, size_t const start) {
+Regex RegexTree::ParseRange(std::string const& pattern, size_t& offset) {
   int state = 1;
-  std::optional<char> range_left;
+  char range_left{};
+  bool has_left{};
   const auto node = std::make_shared<RangeNode>();
 
-  if (input[start].Char() != '[') {
+  if (offset >= pattern.size() || pattern[offset] != '[') {
     throw InvalidRange{};
   } else {
-    input.erase(input.begin() + start);
+    ++offset;
   }
 
-  if (input[start].Char() == '^') {
+  if (offset < pattern.size() && pattern[offset] == '^') {
     node->includes_ = false;
-    input.erase(input.begin() + start);
+    ++offset;
   } else {
     node->includes_ = true;
   }
 
   while (state > 0) {
-    if (!input[start].IsChar()) {
+    if (offset >= pattern.size()) {
       throw InvalidRange{};
     }
 
+    auto const ch = pattern[offset++];
     switch (state) {
       case 1: {
-        if (input[start].Char() == ']') {
+        if (ch == ']') {
           state = 0;
-        } else if (input[start].Char() == '-') {
-          if (!range_left)
-            node->set_.insert('-');
+        } else if (ch == '-') {
+          if (!has_left)
+            node->set_.Insert('-');
           else
             state = 3;
-        } else if (input[start].Char() == '\\') {
+        } else if (ch == '\\') {
           state = 2;
         } else {
-          range_left = input[start].Char();
-          node->set_.insert(*range_left);
+          range_left = ch;
+          has_left = true;
+          node->set_.Insert(ch);
         }
       } break;
       case 2: {  // 转义字符
-        auto [range, includes] = Chars::Extract(input[start].Char());
+        auto [range, includes] = Chars::Extract(ch);
         if (!includes) throw InvalidRange{};
-        for (auto const& c : range) {
-          node->set_.insert(c);
+        node->set_ |= CharSet{range};
+        if (range.size() == 1) {
+          range_left = range.front();
+          has_left = true;
         }
-        if (range.size() == 1) range_left = range.front();
         state = 1;
       } break;
       case 3: {  // 字符范围
-        if (input[start].Char() == ']') {
-          node->set_.insert('-');
+        if (ch == ']') {
+          node->set_.Insert('-');
           state = 0;
         } else {
-          node->set_ += Chars::Range(*range_left, input[start].Char());
-          range_left.reset();
+          node->set_ |= CharSet::Range(range_left, ch);
+          has_left = false;
           state = 1;
         }
       } break;
     }
-
-    input.erase(input.begin() + start);
   }
 
-  if (state != 0) throw InvalidRange{};
-
-  input.insert(input.begin() + start, node);
+  return node;
 }
 
 /**
- * 做词法分析，将字符和转义字符都归约成节点
+ * 做词法分析，将字符和转义字符都转换成节点，运算符保留为字符
  */
-void RegexTree::ParseChars(std::vector<Unit>& input) {
+std::vector<RegexTree::Unit> RegexTree::ParseChars(std::string const& pattern) {
+  std::vector<Unit> units;
+  units.reserve(pattern.size());
+
   size_t i = 0;
-  while (i < input.size()) {
-    if (input[i].IsChar()) {
-      if (input[i].Char() == '[') {
-        ParseRange(input, i);
-      } else if (Operators().find(input[i].Char()) != std::string::npos) {
-        // skip
-      } else if (input[i].Char() == '\\') {
-        if (i + 1 >= input.size()) throw InvalidEscape{};
-
-        input.erase(input.begin() + i);
-        auto [range, includes] = Chars::Extract(input[i].Char());
-        if (range.size() == 1) {
-          auto const node = std::make_shared<CharNode>();
-          node->ch_ = range[0];
-          input[i] = node;
-        } else {
-          auto const node = std::make_shared<RangeNode>();
-          node->includes_ = includes;
-          for (auto c : range) node->set_.insert(c);
-          input[i] = node;
-        }
-      } else if (input[i].Char() == '.') {
-        auto const node = std::make_shared<RangeNode>();
-        node->includes_ = false;
-        node->set_ = {};
-        input[i] = node;
-      } else {
+  while (i < pattern.size()) {
+    if (pattern[i] == '[') {
+      units.emplace_back(ParseRange(pattern, i));
+      continue;
+    }
+
+    if (Operators().find(pattern[i]) != std::string::npos) {
+      units.emplace_back(pattern[i]);
+    } else if (pattern[i] == '\\') {
+      if (i + 1 >= pattern.size()) throw InvalidEscape{};
+
+      auto [range, includes] = Chars::Extract(pattern[++i]);
+      if (range.size() == 1) {
         auto const node = std::make_shared<CharNode>();
-        node->ch_ = input[i].Char();
-        input[i] = node;
+        node->ch_ = range[0];
+        units.emplace_back(node);
+      } else {
+        auto const node = std::make_shared<RangeNode>();
+        node->includes_ = includes;
+        node->set_ = CharSet{range};
+        units.emplace_back(node);
       }
+    } else if (pattern[i] == '.') {
+      auto const node = std::make_shared<RangeNode>();
+      node->includes_ = false;
+      node->set_ = {};
+      units.emplace_back(node);
+    } else {
+      auto const node = std::make_shared<CharNode>();
+      node->ch_ = pattern[i];
+      units.emplace_back(node);
     }
     ++i;
   }
+
+  return units;
 }
 
 /**
- * 解析正则表达式
- *  1. 递归处理括号，将分析完毕的表达式在原地归约
- *  2. 处理后缀运算符，将分析完毕的表达式在原地归约
- *  3. 处理连接，将分析完毕的表达式在原地归约
- *  4. 处理或运算符，将分析完毕的表达式在原地归约
+ * 解析或运算，或运算左结合
+ *  expr := term { '|' term }
  */
-void RegexTree::Parse(std::vector<Unit>& base, size_t const start) {
-  // 1. 递归处理括号，将分析完毕的表达式在原地归约
-  for (size_t i = start;
-       i < base.size() && (!base[i].IsChar() || base[i].Char() != ')'); ++i) {
-    if (base[i].IsChar() && base[i].Char() == '(') {
-      base.erase(base.begin() + i);
-      Parse(base, i);
-      if (i + 1 >= base.size() || base[i + 1].Char() != ')') {
-        throw InvalidPattern{};
-      }
-      base.erase(base.begin() + i + 1);
-    }
+Regex RegexTree::Parse(std::vector<Unit> const& units, size_t& offset) {
+  auto regex = ParseTerm(units, offset);
+  while (offset < units.size() && units[offset].IsChar() &&
+         units[offset].Char() == '|') {
+    ++offset;
+    auto const node = std::make_shared<UnionNode>();
+    node->left_ = regex;
+    node->right_ = ParseTerm(units, offset);
+    regex = node;
   }
+  return regex;
+}
 
-  // 2. 处理后缀运算符，将分析完毕的表达式在原地归约
-  for (size_t i = start;
-       i < base.size() && (!base[i].IsChar() || base[i].Char() != ')'); ++i) {
-    if (base[i].IsChar() && base[i].Char() == '*') {
-      if (i == start || !base[i - 1].IsNode()) {
-        throw InvalidPattern{};
-      }
+/**
+ * 解析连接，连接左结合，至少包含一个因子
+ *  term := factor { factor }
+ */
+Regex RegexTree::ParseTerm(std::vector<Unit> const& units, size_t& offset) {
+  auto regex = ParseFactor(units, offset);
+  while (offset < units.size()) {
+    auto const& unit = units[offset];
+    if (unit.IsChar() && unit.Char() != '(') break;
 
-      auto const node = std::make_shared<KleeneNode>();
-      node->child_ = base[--i].Node();
-      base.erase(base.begin() + i);
-      base[i] = node;
-    } else if (base[i].IsChar() && base[i].Char() == '+') {
-      if (i == start || !base[i - 1].IsNode()) {
-        throw InvalidPattern{};
-      }
+    auto const node = std::make_shared<ConcatNode>();
+    node->left_ = regex;
+    node->right_ = ParseFactor(units, offset);
+    regex = node;
+  }
+  return regex;
+}
 
-      auto const node = std::make_shared<PositiveNode>();
-      node->child_ = base[--i].Node();
-      base.erase(base.begin() + i);
-      base[i] = node;
-    } else if (base[i].IsChar() && base[i].Char() == '?') {
-      if (i == start || !base[i - 1].IsNode()) {
-        throw InvalidPattern{};
-      }
+/**
+ * 解析因子，后缀运算符可以叠加
+ *  factor := primary { '*' | '+' | '?' }
+ *  primary := '(' expr ')' | node
+ */
+Regex RegexTree::ParseFactor(std::vector<Unit> const& units, size_t& offset) {
+  if (offset >= units.size()) throw InvalidPattern{};
+
+  Regex regex;
+  if (units[offset].IsNode()) {
+    regex = units[offset++].Node();
+  } else if (units[offset].Char() == '(') {
+    regex = Parse(units, ++offset);
+    if (offset >= units.size() || !units[offset].IsChar() ||
+        units[offset].Char() != ')') {
+      throw InvalidPattern{};
+    }
+    ++offset;
+  } else {
+    throw InvalidPattern{};
+  }
 
-      auto const node = std::make_shared<OptionalNode>();
-      node->child_ = base[--i].Node();
-      base.erase(base.begin() + i);
-      base[i] = node;
+  while (offset < units.size() && units[offset].IsChar()) {
+    std::shared_ptr<MonoNode> node;
+    switch (units[offset].Char()) {
+      case '*':
+        node = std::make_shared<KleeneNode>();
+        break;
+      case '+':
+        node = std::make_shared<PositiveNode>();
+        break;
+      case '?':
+        node = std::make_shared<OptionalNode>();
+        break;
+      default:
+        return regex;
     }
+    node->child_ = regex;
+    regex = node;
+    ++offset;
   }
+  return regex;
+}
 
-  // 3. 处理连接，将分析完毕的表达式在原地归约
-  for (size_t i = start;
-       i < base.size() && (!base[i].IsChar() || base[i].Char() != ')'); ++i) {
-    if (i <= start || !base[i].IsNode() || !base[i - 1].IsNode()) continue;
+Regex RegexTree::Compile(std::string const& pattern) {
+  /**
+   * 先完成词法分析，字符类和转义错误优先于结构错误报告
+   */
+  auto const units = ParseChars(pattern);
+
+  size_t offset = 0;
+  auto const regex = Parse(units, offset);
+  if (offset != units.size()) {
+    throw InvalidPattern{};
+  }
 
-    auto const node = std::make_shared<ConcatNode>();
-    node->right_ = base[i].Node();
-    node->left_ = base[--i].Node();
-    base[i] = node;
-    base.erase(base.begin() + i + 1);
+  return regex;
+}
+
+Regex RegexTree::UnionNode::Of(Regex const& left, Regex const& right) {
+  auto const node = std::make_shared<UnionNode>();
+  node->left_ = left;
+  node->right_ = right;
+  return node;
+}
+
+uint32_t RegexTree::Arena::Add(Regex const& regex) {
+  auto const begin = positions.size();
+  auto const root = Flatten(*regex);
+
+  /**
+   * 星闭包和正闭包会重复添加后继位置，展开完成后统一去重
+   */
+  for (auto pos = begin; pos < positions.size(); ++pos) {
+    auto& follow = positions[pos].followpos;
+    std::sort(follow.begin(), follow.end());
+    follow.erase(std::unique(follow.begin(), follow.end()), follow.end());
   }
 
-  // 4. 处理或运算符，将分析完毕的表达式在原地归约
-  for (size_t i = start;
-       i < base.size() && (!base[i].IsChar() || base[i].Char() != ')'); ++i) {
-    if (!base[i].IsChar() || base[i].Char() != '|') continue;
+  return root;
+}
 
-    if (i == start || !base[i - 1].IsNode() || i >= base.size() ||
-        !base[i + 1].IsNode()) {
-      throw InvalidPattern{};
-    }
+uint32_t RegexTree::Arena::Accept(uint32_t root, SymbolID term) {
+  auto const pos = static_cast<uint32_t>(positions.size());
+  positions.push_back({.accept = term});
 
-    auto const node = std::make_shared<UnionNode>();
-    base.erase(base.begin() + i);
-    node->right_ = base[i].Node();
-    node->left_ = base[--i].Node();
-    base[i] = node;
-    base.erase(base.begin() + i + 1);
+  // 接受位置的ID大于全部已有位置，追加后后继位置仍然有序
+  auto const last = nodes[root].lastpos;
+  for (auto i = 0U; i < last.size; ++i) {
+    positions[pool[last.offset + i]].followpos.push_back(pos);
   }
+  return pos;
 }
 
-Regex RegexTree::Compile(std::string const& pattern) {
-  std::vector<Unit> input{pattern.begin(), pattern.end()};
+uint32_t RegexTree::Arena::Flatten(RegexTree& node) {
+  if (auto leaf = dynamic_cast<LeafNode*>(&node)) return Leaf(*leaf);
+  if (dynamic_cast<UnionNode*>(&node)) return Union(node);
+
+  Node flat{};
+  if (auto mono = dynamic_cast<MonoNode*>(&node)) {
+    auto const child = nodes[flat.left = Flatten(*mono->child_)];
+    flat.firstpos = child.firstpos;
+    flat.lastpos = child.lastpos;
+    if (dynamic_cast<KleeneNode*>(mono)) {
+      flat.kind = Kind::kKleene;
+      flat.nullable = true;
+      Follow(child.lastpos, child.firstpos);
+    } else if (dynamic_cast<PositiveNode*>(mono)) {
+      flat.kind = Kind::kPositive;
+      flat.nullable = child.nullable;
+      Follow(child.lastpos, child.firstpos);
+    } else {
+      flat.kind = Kind::kOptional;
+      flat.nullable = true;
+    }
+  } else {
+    auto const concat = dynamic_cast<ConcatNode*>(&node);
+    auto const lhs = nodes[flat.left = Flatten(*concat->left_)];
+    auto const rhs = nodes[flat.right = Flatten(*concat->right_)];
+    flat.kind = Kind::kConcat;
+    flat.nullable = lhs.nullable && rhs.nullable;
+    flat.firstpos =
+        lhs.nullable ? Merge(lhs.firstpos, rhs.firstpos) : lhs.firstpos;
+    flat.lastpos = rhs.nullable ? Merge(lhs.lastpos, rhs.lastpos) : rhs.lastpos;
+    Follow(lhs.lastpos, rhs.firstpos);
+  }
 
-  ParseChars(input);
-  Parse(input, 0);
+  nodes.push_back(flat);
+  return nodes.size() - 1;
+}
 
-  if (input.size() != 1 || !input[0].IsNode()) {
-    throw InvalidPattern{};
+uint32_t RegexTree::Arena::Union(RegexTree& node) {
+  /**
+   * 或运算左结合，a|b|c 形成向左延伸的链
+   * 逐层合并位置集合会反复复制左侧的集合，因此先展开整条链的全部分支
+   */
+  std::vector<RegexTree*> branches{};
+  auto it = &node;
+  while (auto const binary = dynamic_cast<UnionNode*>(it)) {
+    branches.push_back(binary->right_.get());
+    it = binary->left_.get();
+  }
+  branches.push_back(it);
+  std::reverse(branches.begin(), branches.end());
+
+  std::vector<uint32_t> children{};
+  for (auto const branch : branches) children.push_back(Flatten(*branch));
+
+  /**
+   * 分支的位置依次递增，按顺序拼接即可得到有序的并集
+   * 链上每个节点的位置集合都是拼接结果的前缀
+   */
+  auto const firstpos = static_cast<uint32_t>(pool.size());
+  for (auto const child : children) {
+    auto const span = nodes[child].firstpos;
+    for (auto i = 0U; i < span.size; ++i) {
+      pool.push_back(pool[span.offset + i]);
+    }
+  }
+  auto const lastpos = static_cast<uint32_t>(pool.size());
+  for (auto const child : children) {
+    auto const span = nodes[child].lastpos;
+    for (auto i = 0U; i < span.size; ++i) {
+      pool.push_back(pool[span.offset + i]);
+    }
   }
 
-  return input[0].Node();
+  auto root = children.front();
+  for (auto i = 1UL; i < children.size(); ++i) {
+    auto const lhs = nodes[root];
+    auto const rhs = nodes[children[i]];
+    nodes.push_back({
+        .kind = Kind::kUnion,
+        .left = root,
+        .right = children[i],
+        .nullable = lhs.nullable || rhs.nullable,
+        .firstpos = {firstpos, lhs.firstpos.size + rhs.firstpos.size},
+        .lastpos = {lastpos, lhs.lastpos.size + rhs.lastpos.size},
+    });
+    root = nodes.size() - 1;
+  }
+  return root;
 }
 
-std::shared_ptr<RegexTree::AcceptNode> RegexTree::AcceptNode::On(
-    Regex const& regex, SymbolID term) {
-  auto const node = std::make_shared<AcceptNode>();
-  node->term_ = term;
-  for (auto it : regex->GetLastpos()) it->followpos_.insert(node);
-  return node;
+uint32_t RegexTree::Arena::Leaf(LeafNode& leaf) {
+  auto const pos = static_cast<uint32_t>(positions.size());
+  auto& position = positions.emplace_back();
+  position.chars = leaf.Matches();
+
+  Span const span{static_cast<uint32_t>(pool.size()), 1};
+  pool.push_back(pos);
+  nodes.push_back({.kind = Kind::kLeaf,
+                   .left = pos,
+                   .firstpos = span,
+                   .lastpos = span});
+  return nodes.size() - 1;
 }
 
-Regex RegexTree::UnionNode::Of(Regex const& left, Regex const& right) {
-  auto const node = std::make_shared<UnionNode>();
-  node->left_ = left;
-  node->right_ = right;
-  return node;
+RegexTree::Arena::Span RegexTree::Arena::Merge(Span lhs, Span rhs) {
+  /**
+   * 位置按后序编号，左子树的位置总是小于右子树的位置
+   * 依次拼接即可保持集合有序
+   */
+  Span const span{lhs.offset, lhs.size + rhs.size};
+  if (lhs.offset + lhs.size == rhs.offset) return span;
+
+  Span const merged{static_cast<uint32_t>(pool.size()), span.size};
+  pool.reserve(pool.size() + merged.size);
+  for (auto i = 0U; i < lhs.size; ++i) pool.push_back(pool[lhs.offset + i]);
+  for (auto i = 0U; i < rhs.size; ++i) pool.push_back(pool[rhs.offset + i]);
+  return merged;
+}
+
+void RegexTree::Arena::Follow(Span from, Span to) {
+  for (auto i = 0U; i < from.size; ++i) {
+    auto& follow = positions[pool[from.offset + i]].followpos;
+    follow.insert(follow.end(), begin(to), end(to));
+  }
 }
 
-}  // namespace alioth
\ No newline at end of file
+}  // namespace alioth
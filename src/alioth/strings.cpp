@@ -1,5 +1,6 @@
 #include "alioth/strings.h"
 
+#include <bit>
 #include <cctype>
 #include <map>
 #include <stdexcept>
@@ -26,6 +27,29 @@ std::string Includes(size_t reserve, F&& pick) {
 }
 }  // namespace
 
+CharSet::CharSet(std::string const& chars) {
+  for (auto const c : chars) Insert(c);
+}
+
+CharSet CharSet::Range(char from, char to) {
+  if (from > to) std::swap(from, to);
+  CharSet set;
+  for (int c = from; c <= to; ++c) set.Insert(static_cast<char>(c));
+  return set;
+}
+
+size_t CharSet::First() const {
+  /**
+   * 按64位分段查找，跳过全零的段
+   */
+  static CharSet const kWord{~0ULL};
+  for (auto offset = 0UL; offset < size(); offset += 64) {
+    uint64_t const word = ((*this >> offset) & kWord).to_ullong();
+    if (word) return offset + std::countr_zero(word);
+  }
+  return size();
+}
+
 std::string Chars::Range(char from, char to) {
   if (from > to) std::swap(from, to);
   std::string str;
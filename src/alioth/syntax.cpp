@@ -1,15 +1,85 @@
 #include "alioth/syntax.h"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <numeric>
+#include <thread>
 #include <tuple>
+#include <unordered_map>
+
+#include "alioth/worklist.h"
 
 namespace alioth {
 
+namespace {
+
+/**
+ * 将展望符号集合 src 并入 dst，返回 dst 是否变化
+ */
+bool Merge(std::vector<uint64_t>& dst, std::vector<uint64_t> const& src) {
+  auto changed = false;
+  for (auto i = 0UL; i < dst.size(); ++i) {
+    auto const merged = dst[i] | src[i];
+    changed |= merged != dst[i];
+    dst[i] = merged;
+  }
+  return changed;
+}
+
+/**
+ * 向展望符号集合中加入终结符
+ */
+void Insert(std::vector<uint64_t>& bits, SymbolID term) {
+  bits.at(term / 64) |= 1UL << term % 64;
+}
+
+/**
+ * 判断展望符号集合是否包含终结符
+ */
+bool Contains(std::vector<uint64_t> const& bits, SymbolID term) {
+  return term / 64 < bits.size() && (bits[term / 64] >> (term % 64) & 1);
+}
+
+/**
+ * 按ID从小到大列出展望符号集合中的终结符
+ */
+std::vector<SymbolID> Members(std::vector<uint64_t> const& bits) {
+  std::vector<SymbolID> members;
+  for (auto i = 0UL; i < bits.size(); ++i) {
+    for (auto word = bits[i]; word; word &= word - 1) {
+      members.push_back(i * 64 + __builtin_ctzll(word));
+    }
+  }
+  return members;
+}
+
+/**
+ * 压缩动作表的数组，编译完成后由动作表持有
+ */
+struct Arrays {
+  std::vector<uint32_t> bases;
+  std::vector<uint32_t> defaults;
+  std::vector<uint16_t> checks;
+  std::vector<uint32_t> actions;
+  std::vector<uint32_t> scopes;
+  std::vector<ContextID> contexts;
+};
+
+}  // namespace
+
 bool Syntactic::IsTerm(SymbolID id) const {
   return id < lex->terms.size() || id == Lexicon::kERR;
 }
 
 bool Syntactic::IsIgnored(SymbolID id) const { return ignores.count(id); }
 
+bool Syntactic::IsSynthetic(SymbolID id) const {
+  if (IsTerm(id)) return false;
+  return NameOf(id).find(kSynthetic) != std::string::npos;
+}
+
 std::string Syntactic::Lang() const { return lex->Lang(); }
 
 std::string Syntactic::NameOf(SymbolID symbol) const {
@@ -80,24 +150,122 @@ std::string Syntactic::PrintFormula(FormulaID formula,
   return result;
 }
 
-nlohmann::json Syntactic::Store() const {
-  nlohmann::json json;
-  json["lex"] = lex->Store();
-  json["ntrms"] = ntrms;
-  for (auto const& formula : formulas) {
-    nlohmann::json f;
-    f["head"] = formula.head;
-    if (formula.form) f["form"] = *formula.form;
-    for (auto const& symbol : formula.body) {
-      nlohmann::json s;
-      s["id"] = symbol.id;
-      if (symbol.attr) s["attr"] = *symbol.attr;
-      f["body"].push_back(s);
+void Syntactic::Compile() {
+  auto const symbols = lex->terms.size() + ntrms.size();
+  if (symbols >= Table::kEmpty) throw TooManySymbols{symbols};
+
+  auto arrays = std::make_shared<Arrays>();
+  arrays->bases.resize(states.size());
+  arrays->defaults.resize(states.size(), Table::kNone);
+
+  /**
+   * 各状态的上下文依次存放，scopes 记录每个状态的上下文列表在其中的起点
+   */
+  for (auto const& state : states) {
+    arrays->scopes.push_back(arrays->contexts.size());
+    arrays->contexts.insert(arrays->contexts.end(), state.contexts.begin(),
+                            state.contexts.end());
+  }
+  arrays->scopes.push_back(arrays->contexts.size());
+
+  /**
+   * 收集各状态进入动作表的动作 <符号, 动作>
+   */
+  std::vector<std::vector<std::pair<uint16_t, uint32_t>>> rows(states.size());
+  for (auto id = 0UL; id < states.size(); ++id) {
+    auto const& state = states.at(id);
+    auto& row = rows.at(id);
+    auto shift_term = false;
+    for (auto const& [symbol, next] : state.shift) {
+      shift_term |= IsTerm(symbol);
+      row.emplace_back(symbol, next);
+    }
+
+    /**
+     * 0号产生式用于接受解析结果，只能在文本结束时归约，不能作为默认归约
+     * 被忽略的终结符不触发默认归约，以它们为展望符号的归约规则仍进入动作表
+     */
+    std::set<FormulaID> formulas;
+    for (auto const& [_, formula] : state.reduce) formulas.insert(formula);
+    auto const fallback =
+        !shift_term && formulas.size() == 1 && *formulas.begin() != 0;
+    if (fallback) arrays->defaults.at(id) = *formulas.begin();
+
+    for (auto const& [symbol, formula] : state.reduce) {
+      if (fallback && !IsIgnored(symbol)) continue;
+      row.emplace_back(symbol, formula | Table::kReduce);
+    }
+    std::sort(row.begin(), row.end());
+  }
+
+  /**
+   * 从动作最多的行开始，为每行选择与已有行不冲突的最小偏移量
+   * 内容完全相同的行共用同一个偏移量，查找任何符号的结果都不受影响
+   */
+  std::vector<size_t> order(states.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](auto a, auto b) {
+    return rows.at(a).size() > rows.at(b).size();
+  });
+
+  std::vector<bool> used;  // 偏移量 -> 是否已被占用
+  auto vacant = 0UL;       // 最小的空槽
+  std::map<std::vector<std::pair<uint16_t, uint32_t>>, uint32_t> placed;
+  for (auto const id : order) {
+    auto const& row = rows.at(id);
+    if (auto it = placed.find(row); it != placed.end()) {
+      arrays->bases.at(id) = it->second;
+      continue;
+    }
+
+    auto const first = row.empty() ? 0UL : row.front().first;
+    auto base = vacant > first ? vacant - first : 0UL;
+    for (;; ++base) {
+      if (base < used.size() && used.at(base)) continue;
+
+      auto const fits = std::all_of(row.begin(), row.end(), [&](auto& e) {
+        auto const slot = base + e.first;
+        return slot >= arrays->checks.size() ||
+               arrays->checks.at(slot) == Table::kEmpty;
+      });
+      if (fits) break;
+    }
+
+    if (base >= used.size()) used.resize(base + 1);
+    used.at(base) = true;
+    arrays->bases.at(id) = base;
+    placed.emplace(row, base);
+    for (auto const& [symbol, action] : row) {
+      auto const slot = base + symbol;
+      if (slot >= arrays->checks.size()) {
+        arrays->checks.resize(slot + 1, Table::kEmpty);
+        arrays->actions.resize(slot + 1, Table::kNone);
+      }
+      arrays->checks.at(slot) = symbol;
+      arrays->actions.at(slot) = action;
+    }
+    while (vacant < arrays->checks.size() &&
+           arrays->checks.at(vacant) != Table::kEmpty) {
+      ++vacant;
     }
-    if (!formula.attributes.empty()) f["attrs"] = formula.attributes;
-    json["formulas"].push_back(f);
   }
 
+  auto table = std::make_shared<Table>();
+  table->bases = arrays->bases;
+  table->defaults = arrays->defaults;
+  table->checks = arrays->checks;
+  table->actions = arrays->actions;
+  table->scopes = arrays->scopes;
+  table->contexts = arrays->contexts;
+  table->storage = arrays;
+  this->table = table;
+}
+
+nlohmann::json Syntactic::Store() const {
+  if (table && table->bases.size() != states.size()) throw NotMaterialized{};
+
+  auto json = StoreMeta();
+  json["lex"] = lex->Store();
   for (auto const& state : states) {
     nlohmann::json s;
     for (auto const& shift : state.shift) {
@@ -111,7 +279,26 @@ nlohmann::json Syntactic::Store() const {
     }
     json["states"].push_back(s);
   }
+  return json;
+}
 
+nlohmann::json Syntactic::StoreMeta() const {
+  nlohmann::json json;
+  json["lex"] = lex->StoreMeta();
+  json["ntrms"] = ntrms;
+  for (auto const& formula : formulas) {
+    nlohmann::json f;
+    f["head"] = formula.head;
+    if (formula.form) f["form"] = *formula.form;
+    for (auto const& symbol : formula.body) {
+      nlohmann::json s;
+      s["id"] = symbol.id;
+      if (symbol.attr) s["attr"] = *symbol.attr;
+      f["body"].push_back(s);
+    }
+    if (!formula.attributes.empty()) f["attrs"] = formula.attributes;
+    json["formulas"].push_back(f);
+  }
   json["ignores"] = ignores;
 
   return json;
@@ -155,10 +342,45 @@ Syntax Syntactic::Load(nlohmann::json const& json) {
   }
 
   syntax->ignores = json["ignores"].get<std::set<SymbolID>>();
+  syntax->Compile();
 
   return syntax;
 }
 
+uint32_t Syntactic::Table::Find(StateID state, SymbolID symbol) const {
+  if (symbol >= kEmpty) return kNone;
+
+  auto const slot = bases[state] + symbol;
+  if (slot >= checks.size() || checks[slot] != symbol) return kNone;
+  return actions[slot];
+}
+
+std::span<ContextID const> Syntactic::Table::Contexts(StateID state) const {
+  return contexts.subspan(scopes[state], scopes[state + 1] - scopes[state]);
+}
+
+std::shared_ptr<Lexicon::Product const> Syntactic::Table::Join(
+    StateID state, Lexicon const& lex) const {
+  auto const scope = Contexts(state);
+  if (scope.size() < 2) return nullptr;
+
+  std::lock_guard lock{joining};
+  if (products.empty()) products.resize(bases.size());
+  auto& product = products[state];
+  if (!product) {
+    std::vector<ContextID> key(scope.begin(), scope.end());
+    auto it = joined.find(key);
+    if (it == joined.end()) it = joined.emplace(key, lex.Join(scope)).first;
+    product = it->second;
+  }
+  return product;
+}
+
+size_t Syntactic::Table::Bytes() const {
+  return bases.size() * sizeof(uint32_t) + defaults.size() * sizeof(uint32_t) +
+         checks.size() * sizeof(uint16_t) + actions.size() * sizeof(uint32_t);
+}
+
 bool Syntactic::LR0Item::operator<(LR0Item const& other) const {
   return std::tie(formula, point) < std::tie(other.formula, other.point);
 }
@@ -166,15 +388,6 @@ bool Syntactic::LR0Item::operator==(LR0Item const& other) const {
   return std::tie(formula, point) == std::tie(other.formula, other.point);
 }
 
-bool Syntactic::LR1Item::operator<(LR1Item const& other) const {
-  return std::tie(formula, point, ahead) <
-         std::tie(other.formula, other.point, other.ahead);
-}
-bool Syntactic::LR1Item::operator==(LR1Item const& other) const {
-  return std::tie(formula, point, ahead) ==
-         std::tie(other.formula, other.point, other.ahead);
-}
-
 bool Syntactic::Formula::Unfolded() const {
   if (form) return false;
   if (body.size() != 1) return false;
@@ -189,6 +402,9 @@ bool Syntactic::Formula::Symbol::Unfolded() const {
 Syntactic::Builder::Builder(Lex lex) {
   syntax_ = Syntax{new Syntactic{}};
   syntax_->lex = lex;
+  for (auto id = 0UL; id < lex->terms.size(); ++id) {
+    symbols_.emplace(lex->terms.at(id).name, id);
+  }
   auto start = TouchNtrm("S'");
   Formula(start).Symbol(start + 1, lex->Lang()).Commit();
 }
@@ -208,299 +424,397 @@ Syntactic::Builder::FormulaBuilder Syntactic::Builder::Formula(
 }
 
 Syntactic::Builder& Syntactic::Builder::Ignore(std::string const& name) {
-  for (auto id = 0UL; id < syntax_->lex->terms.size(); ++id) {
-    if (syntax_->lex->terms.at(id).name == name) {
-      syntax_->ignores.insert(id);
-      return *this;
-    }
+  auto const it = symbols_.find(name);
+  if (it == symbols_.end() || !syntax_->IsTerm(it->second)) {
+    throw UnknownTermError{name};
   }
-  throw UnknownTermError{name};
+  syntax_->ignores.insert(it->second);
+  return *this;
+}
+
+Syntactic::Builder& Syntactic::Builder::Lalr(bool enable) {
+  lalr_ = enable;
+  return *this;
+}
+
+Syntactic::Builder& Syntactic::Builder::Jobs(size_t jobs) {
+  jobs_ = jobs;
+  return *this;
 }
 
 Syntax Syntactic::Builder::Build() {
   CalculateNullable();
   CalculateFirst();
+  CalculateSuffixes();
   CalculateFollow();
+  CalculateExpansions();
   CalculateStates();
+  syntax_->Compile();
 
   return syntax_;
 }
 
+std::optional<std::string> const& Syntactic::Builder::MergeConflict() const {
+  return merge_conflict_;
+}
+
 void Syntactic::Builder::CalculateNullable() {
-  std::set<SymbolID> nullables;
+  auto const offset = syntax_->lex->terms.size();
 
-  /** 先统计能够直接判断的可空符号 */
+  /**
+   * 只由非终结符构成的产生式，其产生式头的可空性依赖产生式体的全部符号
+   * 含有终结符的产生式不可能推导出空串，不建立依赖
+   */
+  Worklist worklist{ntrms_.size()};
   for (auto const& formula : syntax_->formulas) {
-    if (formula.body.empty()) nullables.insert(formula.head);
-  }
-
-  /** 推导出所有可空符号 */
-  while (true) {
-    auto snapshot = nullables.size();
-    if (snapshot == 0 || snapshot == ntrms_.size()) break;
-
-    /** 遍历所有非终结符 */
-    for (auto const& formula : syntax_->formulas) {
-      if (nullables.count(formula.head)) continue;
-
-      /** 如果产生式右部所有符号都可空，则产生式左部也可空 */
-      bool all_nullable = true;
-      for (auto const& symbol : formula.body) {
-        if (syntax_->IsTerm(symbol.id) || !nullables.count(symbol.id)) {
-          all_nullable = false;
-          break;
-        }
-      }
-      if (all_nullable) {
-        nullables.insert(formula.head);
-        break;
-      }
+    auto const& body = formula.body;
+    if (std::any_of(body.begin(), body.end(), [&](auto const& symbol) {
+          return syntax_->IsTerm(symbol.id);
+        })) {
+      continue;
+    }
+    for (auto const& symbol : body) {
+      worklist.Depend(formula.head - offset, symbol.id - offset);
     }
-
-    /** 如果没有新的可空符号产生，则结束 */
-    if (snapshot == nullables.size()) break;
   }
 
-  for (auto const& id : nullables) {
-    ntrms_.at(id).nullable = true;
-  }
+  /** 若某个产生式体的全部符号都可空，则产生式头也可空 */
+  worklist.Solve([&](size_t index) {
+    auto& ntrm = ntrms_.at(offset + index);
+    if (ntrm.nullable) return false;
+
+    for (auto const formula_id : ntrm.formulas) {
+      auto const& body = syntax_->formulas.at(formula_id).body;
+      ntrm.nullable =
+          std::all_of(body.begin(), body.end(), [&](auto const& symbol) {
+            return !syntax_->IsTerm(symbol.id) && ntrms_.at(symbol.id).nullable;
+          });
+      if (ntrm.nullable) return true;
+    }
+    return false;
+  });
 }
 
 void Syntactic::Builder::CalculateFirst() {
-  std::set<SymbolID> inprogress;
-  std::set<SymbolID> calculated;
-
-  /**
-   * 前缀关系表，键为前缀非终结符，值为包含该前缀的非终结符集合
-   * prefix -> {ntrm}
-   */
-  std::map<SymbolID, std::set<SymbolID>> prefix_ntrms;
+  auto const offset = syntax_->lex->terms.size();
+  auto const words = (offset + 63) / 64;
 
   /**
-   * 为每个非终结符迭代全部产生式初步收集前缀集合
-   *
-   * 从左到右逐个将产生式体的符号加入前缀集合
-   * 遇到终结符或不可空非终结符时结束
+   * 从左到右遍历产生式体，直到遇到终结符或不可空非终结符
    *
-   * 若全部前缀符号均为终结符，则该非终结符的FIRST集合已计算完成
+   * 途经的终结符直接加入FIRST集合，途经的非终结符称为前缀
+   * 非终结符的FIRST集合依赖其全部前缀的FIRST集合
    */
+  Worklist worklist{ntrms_.size()};
+  std::vector<std::vector<SymbolID>> prefixes(ntrms_.size());
   for (auto& [id, ntrm] : ntrms_) {
-    for (auto const& formula_id : ntrm.formulas) {
-      auto const& formula = syntax_->formulas.at(formula_id);
-
-      for (auto const& symbol : formula.body) {
-        if (symbol.id != id) ntrm.first.insert(symbol.id);
-        if (syntax_->IsTerm(symbol.id)) break;
+    ntrm.first = Lookahead(words);
+    for (auto const formula_id : ntrm.formulas) {
+      for (auto const& symbol : syntax_->formulas.at(formula_id).body) {
+        if (syntax_->IsTerm(symbol.id)) {
+          Insert(ntrm.first, symbol.id);
+          break;
+        }
 
         if (symbol.id != id) {
-          prefix_ntrms[symbol.id].insert(id);
+          prefixes.at(id - offset).push_back(symbol.id);
+          worklist.Depend(id - offset, symbol.id - offset);
         }
-
         if (!ntrms_.at(symbol.id).nullable) break;
       }
     }
+  }
 
-    if (syntax_->IsTerm(*ntrm.first.rbegin())) {
-      calculated.insert(id);
-    } else {
-      inprogress.insert(id);
+  worklist.Solve([&](size_t index) {
+    auto& ntrm = ntrms_.at(offset + index);
+    auto changed = false;
+    for (auto const prefix : prefixes[index]) {
+      changed = Merge(ntrm.first, ntrms_.at(prefix).first) || changed;
     }
-  }
+    return changed;
+  });
 
   /**
-   * 基于已知的前缀关推广FIRST集合
+   * 不可空且FIRST集合为空的非终结符推导不出任何句子
+   * 没有产生式的非终结符未定义，其余的只在彼此之间循环推导
    */
-  while (!inprogress.empty()) {
-    auto const snapshot = inprogress.size();
-    auto const known = std::move(calculated);
+  std::vector<std::string> circular;
+  for (auto const& [id, ntrm] : ntrms_) {
+    if (ntrm.nullable) continue;
+    if (std::any_of(ntrm.first.begin(), ntrm.first.end(),
+                    [](auto word) { return word != 0; })) {
+      continue;
+    }
+    if (ntrm.formulas.empty()) throw EmptyFirstError{ntrm.name};
+    circular.push_back(ntrm.name);
+  }
+  if (!circular.empty()) throw CircularFirstError{circular};
+}
 
-    /** 基于已知的FIRST，计算新的FIRST */
-    for (auto const& prefix_id : known) {
-      const auto& prefix = ntrms_.at(prefix_id);
+void Syntactic::Builder::CalculateFollow() {
+  auto const offset = syntax_->lex->terms.size();
+  auto const words = (offset + 63) / 64;
+  for (auto& [_, ntrm] : ntrms_) ntrm.follow = Lookahead(words);
 
-      for (auto const& ntrm_id : prefix_ntrms[prefix_id]) {
-        auto& ntrm = ntrms_.at(ntrm_id);
+  /**
+   * 非终结符的FOLLOW集合包含其后继符号串的FIRST集合
+   * 若后继符号串可空，则还依赖产生式头的FOLLOW集合
+   */
+  Worklist worklist{ntrms_.size()};
+  std::vector<std::vector<SymbolID>> heads(ntrms_.size());
+  for (auto formula_id = 0UL; formula_id < syntax_->formulas.size();
+       ++formula_id) {
+    auto const& formula = syntax_->formulas.at(formula_id);
+    auto const& suffixes = suffixes_.at(formula_id);
+    for (auto i = 0UL; i < formula.body.size(); ++i) {
+      auto const id = formula.body.at(i).id;
+      if (syntax_->IsTerm(id)) continue;
+
+      auto const& suffix = suffixes.at(i + 1);
+      Merge(ntrms_.at(id).follow, suffix.first);
+      if (suffix.nullable && id != formula.head) {
+        heads.at(id - offset).push_back(formula.head);
+        worklist.Depend(id - offset, formula.head - offset);
+      }
+    }
+  }
 
-        ntrm.first.erase(prefix_id);
-        ntrm.first.insert(prefix.first.begin(), prefix.first.end());
+  worklist.Solve([&](size_t index) {
+    auto& ntrm = ntrms_.at(offset + index);
+    auto changed = false;
+    for (auto const head : heads[index]) {
+      changed = Merge(ntrm.follow, ntrms_.at(head).follow) || changed;
+    }
+    return changed;
+  });
+}
 
-        if (ntrm.first.empty()) throw EmptyFirstError{ntrm.name};
+void Syntactic::Builder::CalculateSuffixes() {
+  auto const words = (syntax_->lex->terms.size() + 63) / 64;
+  suffixes_.clear();
 
-        if (syntax_->IsTerm(*ntrm.first.rbegin())) {
-          calculated.insert(ntrm_id);
-          inprogress.erase(ntrm_id);
-        }
-      }
-    }
+  for (auto const& formula : syntax_->formulas) {
+    auto const size = formula.body.size();
+    auto& suffixes = suffixes_.emplace_back(
+        size + 1, Suffix{.first = Lookahead(words), .nullable = true});
 
-    if (snapshot == inprogress.size()) {
-      std::vector<std::string> inprogress_names;
-      for (auto id : inprogress) inprogress_names.push_back(ntrms_.at(id).name);
+    /**
+     * 倒序计算，遇到可空非终结符时并入其后符号串的FIRST集合
+     */
+    for (auto i = size; i > 0; --i) {
+      auto const id = formula.body.at(i - 1).id;
+      auto& suffix = suffixes.at(i - 1);
+      if (syntax_->IsTerm(id)) {
+        Insert(suffix.first, id);
+        suffix.nullable = false;
+        continue;
+      }
 
-      throw CircularFirstError{inprogress_names};
+      auto const& ntrm = ntrms_.at(id);
+      Merge(suffix.first, ntrm.first);
+      suffix.nullable = ntrm.nullable && suffixes.at(i).nullable;
+      if (ntrm.nullable) Merge(suffix.first, suffixes.at(i).first);
     }
   }
 }
 
-void Syntactic::Builder::CalculateFollow() {
-  /**
-   * 非终结符与其后缀关系表，键为非终结符，值为后缀符号集合
-   * ntrm -> {suffix}
-   */
-  std::map<SymbolID, std::set<SymbolID>> ntrm_suffixes;
+void Syntactic::Builder::CalculateExpansions() {
+  auto const words = (syntax_->lex->terms.size() + 63) / 64;
 
-  /**
-   * 依据产生式统计后缀关系和部分FOLLOW
-   */
-  for (auto formula : syntax_->formulas) {
-    bool suffix = true;
-    auto const body_size = formula.body.size();
+  for (auto& [id, def] : ntrms_) {
+    auto& expansions = def.expansions;
+    expansions.clear();
+    expansions.push_back(
+        {.ntrm = id, .spontaneous = Lookahead(words), .propagate = true});
 
     /**
-     * 倒序遍历产生式体
-     * 在遇到终结符或不可空非终结符前的符号均为当前产生式头的后缀
+     * 沿产生式的第一个符号传播展望符号，直到模板不再变化
      */
-    for (auto i = body_size; i > 0; --i) {
-      auto const& symbol = formula.body.at(i - 1);
-
-      /** 统计后缀关系 */
-      if (suffix && !syntax_->IsTerm(symbol.id) && symbol.id != formula.head) {
-        ntrm_suffixes[formula.head].insert(symbol.id);
-      }
+    std::map<SymbolID, size_t> index{{id, 0}};  // 非终结符 -> 模板项
+    std::vector<size_t> tasks{0};
+    while (!tasks.empty()) {
+      auto const from = tasks.back();
+      tasks.pop_back();
+
+      auto const& current = ntrms_.at(expansions.at(from).ntrm);
+      for (auto const formula_id : current.formulas) {
+        auto const& formula = syntax_->formulas.at(formula_id);
+        if (formula.body.empty()) continue;
+
+        auto const symbol = formula.body.front().id;
+        if (syntax_->IsTerm(symbol)) continue;
+
+        auto const [it, inserted] = index.emplace(symbol, expansions.size());
+        if (inserted) {
+          expansions.push_back(
+              {.ntrm = symbol, .spontaneous = Lookahead(words)});
+        }
 
-      /**
-       * 遇到终结符时，后缀关系结束
-       */
-      if (syntax_->IsTerm(symbol.id)) {
-        suffix = false;
-        continue;
+        auto const& suffix = suffixes_.at(formula_id).at(1);
+        auto& to = expansions.at(it->second);
+        auto changed = Merge(to.spontaneous, suffix.first) || inserted;
+        if (suffix.nullable) {
+          auto const& source = expansions.at(from);
+          changed = Merge(to.spontaneous, source.spontaneous) || changed;
+          if (source.propagate && !to.propagate) {
+            to.propagate = true;
+            changed = true;
+          }
+        }
+        if (changed) tasks.push_back(it->second);
       }
+    }
+  }
+}
 
-      /**
-       * 聚焦当前非终结符
-       */
-      auto& focus = ntrms_.at(symbol.id);
-
-      /**
-       * 若当前非终结符不可空，则后缀关系结束
-       */
-      if (!focus.nullable) suffix = false;
-
-      /**
-       * 当前非终结符的FOLLOW集包含其后继符号的FIRST集
-       * 终结符或不可空的非终结符会结束后继关系
-       */
-      for (auto j = i; j < body_size; ++j) {
-        auto const& follow_symbol = formula.body.at(j);
-        if (syntax_->IsTerm(follow_symbol.id)) {
-          focus.follow.insert(follow_symbol.id);
-          break;  // 终结符结束后继关系
-        }
+void Syntactic::Builder::CalculateStates() {
+  Lookahead eof((syntax_->lex->terms.size() + 63) / 64);
+  Insert(eof, Lexicon::kEOF);
 
-        auto const& follow_ntrm = ntrms_.at(follow_symbol.id);
-        focus.follow.insert(follow_ntrm.first.begin(), follow_ntrm.first.end());
-        if (!follow_ntrm.nullable) break;  // 不可空非终结符结束后继关系
+  /**
+   * 分片的核心表，以核心查找已有状态，各线程可以同时查找或登记不同分片
+   *
+   * 只保存核心，闭包在展开状态时计算
+   * 散列表的节点地址稳定，草稿直接引用其中的核心
+   */
+  struct Shard {
+    std::mutex mutex;
+    std::unordered_map<Kernel, size_t, KernelHash> drafts;
+    std::vector<std::pair<size_t, Kernel const*>> fresh;  // 本轮登记的核心
+  };
+
+  auto const jobs =
+      jobs_ ? jobs_ : std::max<size_t>(1, std::thread::hardware_concurrency());
+  std::vector<Shard> shards(jobs == 1 ? 1 : jobs * 8);
+  std::atomic<size_t> registered{0};
+  auto const intern = [&](Kernel&& kernel) {
+    auto& shard = shards.at(KernelHash{}(kernel) % shards.size());
+    std::lock_guard lock{shard.mutex};
+    auto [it, inserted] = shard.drafts.try_emplace(std::move(kernel));
+    if (inserted) {
+      it->second = registered++;
+      shard.fresh.emplace_back(it->second, &it->first);
+    }
+    return it->second;
+  };
+
+  std::vector<Draft> drafts;
+  auto const collect = [&] {
+    drafts.resize(registered);
+    for (auto& shard : shards) {
+      for (auto const& [id, kernel] : shard.fresh) {
+        drafts.at(id).kernel = kernel;
       }
+      shard.fresh.clear();
     }
-  }
+  };
 
   /**
-   * 需要向自己的后缀传播FOLLOW集的非终结符
+   * 逐轮展开上一轮登记的状态，同一轮的状态互不依赖，可以并行展开
    */
-  std::set<SymbolID> active;
-  for (auto const& [id, _] : ntrm_suffixes) {
-    active.insert(id);
-  }
-
-  /** 利用后缀关系补全FOLLOW */
-  while (!active.empty()) {
-    auto const known = std::move(active);
-
-    for (auto ntrm_id : known) {
-      auto& ntrm = ntrms_.at(ntrm_id);
-
-      /**
-       * 当前非终结符的全部后缀符号的FOLLOW集均包含当前非终结符的FOLLOW集
-       */
-      for (auto const& suffix_id : ntrm_suffixes[ntrm_id]) {
-        auto& suffix = ntrms_.at(suffix_id);
-
-        /**
-         * 若FOLLOW集发生变化，则激活后缀非终结符，以便传播变化
-         */
-        auto const snapshot = suffix.follow.size();
-        suffix.follow.insert(ntrm.follow.begin(), ntrm.follow.end());
-        if (snapshot != suffix.follow.size()) active.insert(suffix_id);
+  intern(Kernel{{{}, eof}});
+  collect();
+  for (auto begin = 0UL; begin < drafts.size();) {
+    auto const end = drafts.size();
+    std::atomic<size_t> next{begin};
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    auto const work = [&] {
+      try {
+        for (auto i = next++; i < end; i = next++) Expand(drafts[i], intern);
+      } catch (...) {
+        std::lock_guard lock{error_mutex};
+        if (!error) error = std::current_exception();
       }
+    };
+
+    auto const threads = std::min(jobs, end - begin);
+    if (threads <= 1) {
+      work();
+    } else {
+      std::vector<std::thread> workers;
+      for (auto i = 0UL; i < threads; ++i) workers.emplace_back(work);
+      for (auto& worker : workers) worker.join();
     }
-  }
-}
+    if (error) std::rethrow_exception(error);
 
-void Syntactic::Builder::CalculateStates() {
-  std::map<StateID, std::set<LR1Item>> itemsets;
-  itemsets.emplace(0, Closure({{}}));
-  syntax_->states.push_back({});
-  std::vector<StateID> tasks{0};
+    collect();
+    begin = end;
+  }
 
+  /**
+   * 模拟单线程深度优先展开的顺序为状态编号，使结果与线程数无关
+   */
+  std::vector<StateID> ids(drafts.size(), -1UL);
+  std::vector<size_t> order;  // 单线程构造时展开状态的顺序
+  std::vector<size_t> tasks{0};
+  ids.front() = 0;
+  auto states = 1UL;
   while (!tasks.empty()) {
-    auto const state_id = tasks.back();
+    auto const draft = tasks.back();
     tasks.pop_back();
-    auto itemset = itemsets.at(state_id);
-    for (auto x : Alphabet(itemset)) {
-      auto next = Goto(itemset, x);
-      if (next.empty()) continue;
-
-      std::optional<StateID> next_state;
-      for (auto const& [s, I] : itemsets) {
-        if (I != next) continue;
-        next_state = s;
-        break;
-      }
-      if (!next_state) {
-        next_state = syntax_->states.size();
-        syntax_->states.push_back({});
-        itemsets.emplace(*next_state, next);
-        tasks.push_back(*next_state);
-      }
-
-      auto& state = syntax_->states.at(state_id);
-      state.shift.emplace(x, *next_state);
+    order.push_back(draft);
+    for (auto const& [symbol, target] : drafts.at(draft).gotos) {
+      if (ids.at(target) != -1UL) continue;
+      ids.at(target) = states++;
+      tasks.push_back(target);
     }
+  }
 
-    for (auto const& item : itemset) {
-      auto const& formula = syntax_->formulas.at(item.formula);
-      if (item.point != formula.body.size()) continue;
+  std::vector<Kernel const*> kernels(drafts.size());
+  syntax_->states.resize(drafts.size());
+  for (auto const draft : order) {
+    auto const state_id = ids.at(draft);
+    auto const& [kernel, gotos, reduces] = drafts.at(draft);
+    kernels.at(state_id) = kernel;
 
-      auto& state = syntax_->states.at(state_id);
-      if (state.shift.count(item.ahead)) {
-        fmt::println(stderr, "shift reduce conflict: {}",
-                     syntax_->NameOf(item.ahead));
-        fmt::println(stderr, "Reduce: {}", syntax_->PrintFormula(item.formula));
-        fmt::println(stderr, "Shift:");
-        for (auto const& it : itemset) {
-          if (it.ahead != item.ahead) continue;
+    auto& state = syntax_->states.at(state_id);
+    for (auto const& [symbol, target] : gotos) {
+      state.shift.emplace(symbol, ids.at(target));
+    }
 
-          fmt::println(stderr, "  {}",
-                       syntax_->PrintFormula(it.formula, it.point));
+    for (auto const& [formula, aheads] : reduces) {
+      for (auto const ahead : Members(aheads)) {
+        if (state.shift.count(ahead)) {
+          auto const& formulas = syntax_->formulas;
+          std::set<std::string> heads{
+              syntax_->NameOf(formulas.at(formula).head)};
+          auto detail = fmt::format("shift reduce conflict: {}\n",
+                                    syntax_->NameOf(ahead));
+          detail += fmt::format("Reduce: {}\n", syntax_->PrintFormula(formula));
+          detail += "Shift:\n";
+          for (auto const& [it, its] : Closure(*kernel)) {
+            if (!Contains(its, ahead)) continue;
+
+            heads.insert(syntax_->NameOf(formulas.at(it.formula).head));
+            detail += fmt::format("  {}\n",
+                                  syntax_->PrintFormula(it.formula, it.point));
+          }
+          detail += fmt::format("state: {}", syntax_->PrintState(state_id));
+          throw ShiftReduceConflict{detail, std::move(heads)};
         }
-        fmt::println(stderr, "state: {}", syntax_->PrintState(state_id));
-        throw ShiftReduceConflict{};
-      }
 
-      if (state.reduce.count(item.ahead)) {
-        fmt::println(stderr, "reduce-reduce conflict: {}",
-                     syntax_->NameOf(item.ahead));
-        fmt::println(stderr, "Reduce: {}", syntax_->PrintFormula(item.formula));
-        fmt::println(stderr, "Reduce: {}",
-                     syntax_->PrintFormula(state.reduce.at(item.ahead)));
-        fmt::println(stderr, "state: {}", syntax_->PrintState(state_id));
-        throw ReduceReduceConflict{};
-      }
+        if (state.reduce.count(ahead)) {
+          auto const other = state.reduce.at(ahead);
+          auto const& formulas = syntax_->formulas;
+          std::set<std::string> heads{
+              syntax_->NameOf(formulas.at(formula).head),
+              syntax_->NameOf(formulas.at(other).head)};
+          auto detail = fmt::format("reduce-reduce conflict: {}\n",
+                                    syntax_->NameOf(ahead));
+          detail += fmt::format("Reduce: {}\n", syntax_->PrintFormula(formula));
+          detail += fmt::format("Reduce: {}\n", syntax_->PrintFormula(other));
+          detail += fmt::format("state: {}", syntax_->PrintState(state_id));
+          throw ReduceReduceConflict{detail, std::move(heads)};
+        }
 
-      state.reduce.emplace(item.ahead, item.formula);
+        state.reduce.emplace(ahead, formula);
+      }
     }
   }
 
+  if (lalr_) MergeStates(kernels);
+
   /** 为每个状态计算所处上下文 */
   for (auto& state : syntax_->states) {
     std::set<SymbolID> terms;
@@ -519,70 +833,122 @@ void Syntactic::Builder::CalculateStates() {
   }
 }
 
-std::set<Syntactic::LR1Item> Syntactic::Builder::Closure(
-    std::set<LR1Item> items) {
-  while (true) {
-    auto const snapshot = items.size();
+void Syntactic::Builder::MergeStates(
+    std::vector<Kernel const*> const& kernels) {
+  /**
+   * 按LR(0)核心分组，组号按组内最小的状态ID依次分配
+   * 闭包只增加点在开头的项目，因此比较项目集核心的LR(0)核心即可
+   */
+  std::map<std::set<LR0Item>, StateID> cores;
+  std::vector<StateID> groups(kernels.size());
+  for (auto id = 0UL; id < kernels.size(); ++id) {
+    std::set<LR0Item> core;
+    for (auto const& [item, _] : *kernels.at(id)) core.insert(item);
+    auto const group = cores.size();
+    groups.at(id) = cores.emplace(std::move(core), group).first->second;
+  }
+  if (cores.size() == kernels.size()) return;
 
-    for (auto const& item : items) {
-      auto const& formula = syntax_->formulas.at(item.formula);
-      if (item.point == formula.body.size()) continue;
+  /**
+   * 同心状态的移进目标也同心，因此移进规则合并后仍然一致
+   */
+  std::vector<State> merged(cores.size());
+  for (auto id = 0UL; id < groups.size(); ++id) {
+    auto const& state = syntax_->states.at(id);
+    auto& target = merged.at(groups.at(id));
+    for (auto const& [symbol, next] : state.shift) {
+      target.shift[symbol] = groups.at(next);
+    }
+    for (auto const& [symbol, formula] : state.reduce) {
+      auto [it, inserted] = target.reduce.emplace(symbol, formula);
+      if (inserted || it->second == formula) continue;
+
+      merge_conflict_ = fmt::format(
+          "merging states causes reduce-reduce conflict on {}, keep LR(1) "
+          "states\nReduce: {}\nReduce: {}",
+          syntax_->NameOf(symbol), syntax_->PrintFormula(formula),
+          syntax_->PrintFormula(it->second));
+      return;
+    }
+  }
 
-      auto const& symbol = formula.body.at(item.point);
-      if (syntax_->IsTerm(symbol.id)) continue;
+  syntax_->states = std::move(merged);
+}
 
-      auto all_nullable = true;
-      std::set<SymbolID> aheads;
-      for (auto it = formula.body.begin() + item.point + 1;
-           it != formula.body.end(); ++it) {
-        if (syntax_->IsTerm(it->id)) {
-          all_nullable = false;
-          aheads.insert(it->id);
-          break;
-        }
-        auto const& first = ntrms_.at(it->id).first;
-        aheads.insert(first.begin(), first.end());
-        if (!ntrms_.at(it->id).nullable) {
-          all_nullable = false;
-          break;
-        }
-      }
-      if (all_nullable) aheads.insert(item.ahead);
+void Syntactic::Builder::Expand(
+    Draft& draft, std::function<size_t(Kernel&&)> const& intern) {
+  auto const items = Closure(*draft.kernel);
+  for (auto const symbol : Alphabet(items)) {
+    draft.gotos.emplace_back(symbol, intern(Goto(items, symbol)));
+  }
 
-      for (auto const formula_id : ntrms_.at(symbol.id).formulas) {
-        for (auto ahead : aheads) {
-          items.insert({.formula = formula_id, .point = 0, .ahead = ahead});
-        }
-      }
+  for (auto const& [item, aheads] : items) {
+    auto const& formula = syntax_->formulas.at(item.formula);
+    if (item.point == formula.body.size()) {
+      draft.reduces.emplace_back(item.formula, aheads);
     }
+  }
+}
+
+Syntactic::Builder::ItemSet Syntactic::Builder::Closure(
+    Kernel const& kernel) {
+  ItemSet items(kernel.begin(), kernel.end());
+
+  /**
+   * 非终结符 -> 其产生式以点开头的项目的展望符号
+   */
+  std::map<SymbolID, Lookahead> heads;
+  Lookahead inherited;
+  for (auto const& [item, aheads] : kernel) {
+    auto const& formula = syntax_->formulas.at(item.formula);
+    if (item.point == formula.body.size()) continue;
+
+    auto const& symbol = formula.body.at(item.point);
+    if (syntax_->IsTerm(symbol.id)) continue;
+
+    auto const& suffix = suffixes_.at(item.formula).at(item.point + 1);
+    inherited = suffix.first;
+    if (suffix.nullable) Merge(inherited, aheads);
 
-    if (snapshot == items.size()) break;
+    for (auto const& expansion : ntrms_.at(symbol.id).expansions) {
+      auto head = heads.try_emplace(expansion.ntrm, aheads.size()).first;
+      Merge(head->second, expansion.spontaneous);
+      if (expansion.propagate) Merge(head->second, inherited);
+    }
+  }
+
+  for (auto const& [ntrm, aheads] : heads) {
+    for (auto const formula : ntrms_.at(ntrm).formulas) {
+      auto [it, inserted] = items.try_emplace({.formula = formula}, aheads);
+      if (!inserted) Merge(it->second, aheads);
+    }
   }
 
   return items;
 }
 
-std::set<Syntactic::LR1Item> Syntactic::Builder::Goto(
-    std::set<LR1Item> const& items, SymbolID symbol) {
-  std::set<LR1Item> result;
-  for (auto const& item : items) {
+Syntactic::Builder::Kernel Syntactic::Builder::Goto(ItemSet const& items,
+                                                    SymbolID symbol) {
+  Kernel result;
+  for (auto const& [item, aheads] : items) {
     auto const& formula = syntax_->formulas.at(item.formula);
     if (item.point == formula.body.size()) continue;
 
     auto const& next = formula.body.at(item.point);
     if (next.id == symbol) {
-      result.insert({.formula = item.formula,
-                     .point = item.point + 1,
-                     .ahead = item.ahead});
+      result.emplace_back(LR0Item{item.formula, item.point + 1}, aheads);
     }
   }
-  return Closure(result);
+
+  /**
+   * 项目集有序，点后移不改变项目之间的顺序，因此核心仍然有序
+   */
+  return result;
 }
 
-std::set<SymbolID> Syntactic::Builder::Alphabet(
-    std::set<LR1Item> const& items) {
+std::set<SymbolID> Syntactic::Builder::Alphabet(ItemSet const& items) {
   std::set<SymbolID> alphabet;
-  for (auto const& item : items) {
+  for (auto const& [item, _] : items) {
     auto const& formula = syntax_->formulas.at(item.formula);
     if (item.point == formula.body.size()) continue;
 
@@ -592,15 +958,25 @@ std::set<SymbolID> Syntactic::Builder::Alphabet(
   return alphabet;
 }
 
-SymbolID Syntactic::Builder::TouchNtrm(std::string const& name) {
-  for (auto id = 0UL; id < syntax_->lex->terms.size(); ++id) {
-    if (syntax_->lex->terms.at(id).name == name) return id;
-  }
-  for (auto const& [id, ntrm] : ntrms_) {
-    if (ntrm.name == name) return id;
+size_t Syntactic::Builder::KernelHash::operator()(Kernel const& kernel) const {
+  auto hash = 14695981039346656037ULL;
+  auto mix = [&hash](uint64_t value) {
+    hash ^= value;
+    hash *= 1099511628211ULL;
+  };
+  for (auto const& [item, aheads] : kernel) {
+    mix(item.formula);
+    mix(item.point);
+    for (auto const word : aheads) mix(word);
   }
+  return hash;
+}
 
+SymbolID Syntactic::Builder::TouchNtrm(std::string const& name) {
   auto const id = syntax_->lex->terms.size() + syntax_->ntrms.size();
+  auto const [it, inserted] = symbols_.emplace(name, id);
+  if (!inserted) return it->second;
+
   syntax_->ntrms.push_back(name);
   ntrms_.emplace(id, NtrmDef{.name = name});
   return id;
@@ -0,0 +1,125 @@
+#include "alioth/tokenizer.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace alioth {
+
+Tokenizer::Tokenizer(Lex lex, Doc doc, ContextID context)
+    : lex_{lex}, doc_{doc}, context_{context} {}
+
+Tokenizer& Tokenizer::Switch(Follow follow) {
+  follow_ = std::move(follow);
+  return *this;
+}
+
+size_t Tokenizer::Next(Batch& batch, size_t capacity) {
+  auto const& text = doc_->content;
+  batch.Clear();
+  batch.ids.reserve(capacity);
+  batch.offsets.reserve(capacity);
+  batch.lengths.reserve(capacity);
+
+  while (batch.Size() < capacity && offset_ < text.size()) Step(batch);
+
+  return batch.Size();
+}
+
+size_t Tokenizer::All(Batch& batch, size_t jobs) {
+  auto const& text = doc_->content;
+  auto const begin = offset_;
+  auto const size = text.size() - std::min(begin, text.size());
+  if (jobs == 0) {
+    jobs = std::max(1U, std::thread::hardware_concurrency());
+    jobs = std::min(jobs, size / kChunkSize);
+  }
+  jobs = std::min(jobs, size);
+
+  if (jobs <= 1 || follow_) {
+    batch.Clear();
+    while (!Done()) Step(batch);
+    return batch.Size();
+  }
+
+  /**
+   * 各分块从块首开始推测扫描，直到单词越过块尾
+   */
+  std::vector<size_t> bounds(jobs + 1);
+  for (auto i = 0UL; i <= jobs; ++i) bounds[i] = begin + size * i / jobs;
+
+  std::vector<Batch> chunks(jobs);
+  std::vector<std::thread> workers;
+  for (auto i = 0UL; i < jobs; ++i) {
+    workers.emplace_back([&, i] {
+      auto tokenizer = Tokenizer(lex_, doc_, context_);
+      tokenizer.offset_ = bounds[i];
+      auto& chunk = chunks[i];
+      while (tokenizer.offset_ < bounds[i + 1]) tokenizer.Step(chunk);
+    });
+  }
+  for (auto& worker : workers) worker.join();
+
+  /**
+   * 依次拼接分块，推测扫描的起点可能位于单词中间
+   * 从上一块实际结束的位置重新扫描，直到与本块的某个单词起点对齐
+   * 对齐之后的扫描结果只取决于扫描位置，因此可以直接采用推测结果
+   */
+  auto total = 0UL;
+  for (auto const& chunk : chunks) total += chunk.Size();
+  batch.Clear();
+  batch.ids.reserve(total);
+  batch.offsets.reserve(total);
+  batch.lengths.reserve(total);
+  for (auto i = 0UL; i < jobs; ++i) {
+    auto const& chunk = chunks[i];
+    auto index = chunk.Find(offset_);
+    while (index == chunk.Size() && offset_ < bounds[i + 1]) {
+      Step(batch);
+      index = chunk.Find(offset_);
+    }
+    if (index == chunk.Size()) continue;
+
+    batch.ids.insert(batch.ids.end(), chunk.ids.begin() + index,
+                     chunk.ids.end());
+    batch.offsets.insert(batch.offsets.end(), chunk.offsets.begin() + index,
+                         chunk.offsets.end());
+    batch.lengths.insert(batch.lengths.end(), chunk.lengths.begin() + index,
+                         chunk.lengths.end());
+    offset_ = batch.offsets.back() + batch.lengths.back();
+  }
+
+  return batch.Size();
+}
+
+void Tokenizer::Step(Batch& batch) {
+  auto token = lex_->Scan(doc_->content, offset_, context_);
+
+  /**
+   * 能匹配空串的单词会使扫描停滞，将当前字节视作无法识别的文本
+   */
+  if (token.length == 0) token = {.id = Lexicon::kERR, .length = 1};
+
+  batch.ids.push_back(token.id);
+  batch.offsets.push_back(offset_);
+  batch.lengths.push_back(token.length);
+  offset_ += token.length;
+  if (follow_) context_ = follow_(token.id, context_);
+}
+
+bool Tokenizer::Done() const { return offset_ >= doc_->content.size(); }
+
+size_t Tokenizer::Batch::Size() const { return ids.size(); }
+
+size_t Tokenizer::Batch::Find(size_t offset) const {
+  auto it = std::lower_bound(offsets.begin(), offsets.end(), offset);
+  if (it == offsets.end() || *it != offset) return Size();
+  return it - offsets.begin();
+}
+
+void Tokenizer::Batch::Clear() {
+  ids.clear();
+  offsets.clear();
+  lengths.clear();
+}
+
+}  // namespace alioth
@@ -1,15 +1,37 @@
 #include "aliox/grammar.h"
 
+#include <map>
+
 #include "alioth/alioth.h"
 #include "alioth/parser.h"
 #include "nlohmann/json.hpp"
 
 namespace alioth {
 
-Syntax Grammar::Compile() const {
+Syntax Grammar::Compile(size_t jobs, std::vector<std::string>* notes) const {
   auto lang = options.at("lang").get<std::string>();
 
   auto lex = Lexicon::Builder(lang);
+  if (options.contains("minimize")) {
+    lex.Minimize(options.at("minimize").get<bool>());
+  }
+  if (options.contains("keywords")) {
+    auto const& keywords = options.at("keywords");
+    if (keywords.is_boolean()) {
+      lex.Keywords(keywords.get<bool>());
+    } else {
+      for (auto const& term : keywords) lex.Keyword(term.get<std::string>());
+    }
+  }
+  if (options.contains("lazy")) {
+    auto const& lazy = options.at("lazy");
+    if (lazy.is_boolean()) {
+      lex.Lazy(lazy.get<bool>() ? Lexicon::Lazy::kDefaultBudget : 0);
+    } else {
+      lex.Lazy(lazy.get<size_t>());
+    }
+  }
+
   for (auto const& term : terms) {
     auto src = term.regex;
     auto regex = RegexTree::Compile(src);
@@ -36,54 +58,126 @@ Syntax Grammar::Compile() const {
     }
   }
 
-  auto builder = Syntactic::Builder(lex.Build());
-  for (auto const& term : terms) {
-    if (term.ignore) {
-      builder.Ignore(term.name);
+  /**
+   * 默认将可省符号展开为拥有和不拥有该符号的全部组合
+   * k 个可省符号产生 2^k 个产生式
+   *
+   * optional 选项为 nullable 时，可省符号改为引用可空的辅助非终结符
+   * 辅助非终结符作为展开符号向产生式头传递属性，产生式数量随可省符号线性增长
+   * 可省的展开符号仍按组合展开，以免辅助非终结符成为展开产生式
+   * 辅助非终结符是合成符号，符号 A 和属性 a 对应的名称为 A'a
+   *
+   * 辅助非终结符的空产生式可能引入展开方式没有的冲突
+   * 此时涉及冲突的辅助非终结符改回展开方式，然后重新构造
+   */
+  auto nullable = false;
+  if (options.contains("optional")) {
+    auto const strategy = options.at("optional").get<std::string>();
+    if (strategy != "expand" && strategy != "nullable") {
+      throw std::runtime_error(
+          fmt::format("Unknown optional strategy {}", strategy));
     }
+    nullable = strategy == "nullable";
   }
 
-  for (auto const& ntrm : ntrms) {
-    for (auto const& f : ntrm.formulas) {
-      auto obits = std::accumulate(
-          f.symbols.begin(), f.symbols.end(), 0UL,
-          [](auto acc, auto const& s) { return acc + (s.optional ? 1 : 0); });
-      auto omax = 1UL << obits;
-      for (auto oflags = 0UL; oflags < omax; ++oflags) {
-        auto fbuilder = builder.Formula(ntrm.name, ntrm.form);
-        auto obit = 0UL;
-        for (auto const& symbol : f.symbols) {
-          if (!symbol.optional) {
-            fbuilder.Symbol(symbol.name, symbol.attr);
-            continue;
-          }
+  using Key = std::pair<std::string, std::optional<std::string>>;
+  auto const lexicon = lex.Build();
+  std::set<Key> expanded;  // 改回展开方式的可省符号
+  for (;;) {
+    auto builder = Syntactic::Builder(lexicon);
+    builder.Jobs(jobs);
+    if (options.contains("lalr")) {
+      builder.Lalr(options.at("lalr").get<bool>());
+    }
+    for (auto const& term : terms) {
+      if (term.ignore) {
+        builder.Ignore(term.name);
+      }
+    }
 
-          if (0 != (oflags & (1UL << obit++))) {
-            fbuilder.Symbol(symbol.name, symbol.attr);
-          }
+    std::map<Key, std::string> helpers;  // <符号, 属性> -> 辅助非终结符
+    for (auto const& ntrm : ntrms) {
+      for (auto const& f : ntrm.formulas) {
+        auto symbols = f.symbols;
+        for (auto& symbol : symbols) {
+          if (!nullable || !symbol.optional) continue;
+          if (symbol.attr.value_or("") == "...") continue;
+
+          auto const key = Key{symbol.name, symbol.attr};
+          if (expanded.count(key)) continue;
+
+          auto [it, _] = helpers.emplace(
+              key, fmt::format("{}{}{}", symbol.name, Syntactic::kSynthetic,
+                               symbol.attr.value_or("")));
+          symbol = {.name = it->second, .attr = "..."};
         }
-        for (auto const& attr : f.attributes) {
-          if (!attr.of) {
-            throw std::runtime_error("Cannot annotate ntrm directly");
-          }
-          fbuilder.Annotate(*attr.of, attr.key, attr.value);
-        }
-        for (auto const& anno : annotations) {
-          if (anno.symbol != ntrm.name) continue;
-          if (anno.form && anno.form != ntrm.form) continue;
 
-          for (auto const& attr : anno.attributes) {
+        auto obits = std::accumulate(
+            symbols.begin(), symbols.end(), 0UL,
+            [](auto acc, auto const& s) { return acc + (s.optional ? 1 : 0); });
+        auto omax = 1UL << obits;
+        for (auto oflags = 0UL; oflags < omax; ++oflags) {
+          auto fbuilder = builder.Formula(ntrm.name, ntrm.form);
+          auto obit = 0UL;
+          for (auto const& symbol : symbols) {
+            if (!symbol.optional) {
+              fbuilder.Symbol(symbol.name, symbol.attr);
+              continue;
+            }
+
+            if (0 != (oflags & (1UL << obit++))) {
+              fbuilder.Symbol(symbol.name, symbol.attr);
+            }
+          }
+          for (auto const& attr : f.attributes) {
             if (!attr.of) {
               throw std::runtime_error("Cannot annotate ntrm directly");
             }
             fbuilder.Annotate(*attr.of, attr.key, attr.value);
           }
+          for (auto const& anno : annotations) {
+            if (anno.symbol != ntrm.name) continue;
+            if (anno.form && anno.form != ntrm.form) continue;
+
+            for (auto const& attr : anno.attributes) {
+              if (!attr.of) {
+                throw std::runtime_error("Cannot annotate ntrm directly");
+              }
+              fbuilder.Annotate(*attr.of, attr.key, attr.value);
+            }
+          }
+          fbuilder.Commit();
         }
-        fbuilder.Commit();
       }
     }
+
+    for (auto const& [key, helper] : helpers) {
+      builder.Formula(helper).Commit();
+      builder.Formula(helper).Symbol(key.first, key.second).Commit();
+    }
+
+    /**
+     * 冲突不涉及辅助非终结符时，展开方式同样存在该冲突，直接报告
+     */
+    auto const fallback = [&](std::set<std::string> const& heads) {
+      auto const size = expanded.size();
+      for (auto const& [key, helper] : helpers) {
+        if (heads.count(helper)) expanded.insert(key);
+      }
+      return expanded.size() > size;
+    };
+    try {
+      auto syntax = builder.Build();
+      if (notes && builder.MergeConflict()) {
+        notes->push_back(*builder.MergeConflict());
+      }
+      return syntax;
+    } catch (Syntactic::Builder::ShiftReduceConflict const& e) {
+      if (!fallback(e.heads)) throw;
+    } catch (Syntactic::Builder::ReduceReduceConflict const& e) {
+      if (!fallback(e.heads)) throw;
+    }
   }
-  return builder.Build();
 }
 
 Grammar Grammar::Load(Doc grammar) {
@@ -3,6 +3,8 @@
 #include <queue>
 #include <vector>
 
+#include "alioth/worklist.h"
+
 namespace alioth {
 
 nlohmann::json Skeleton::Store() const {
@@ -65,16 +67,27 @@ Skeleton Skeleton::Deduce(Syntax const& syntax) {
 
 void Skeleton::DeduceStructures(Skeleton& lang) {
   auto syntax = lang.syntax;
+  auto const symbols = syntax->lex->terms.size() + syntax->ntrms.size();
 
   /**
    * 全量分析阶段不能判断属性是否可选
    *
-   * 反复填写属性特征直到没有变化
+   * 非终结符的属性结构依赖其产生式中展开符号的属性结构
+   * 以工作表反复填写属性特征直到没有变化
    */
-  bool growing{};
-  do {
-    growing = false;
-    for (auto formula = 0UL; formula < syntax->formulas.size(); ++formula) {
+  std::vector<std::vector<FormulaID>> formulas(symbols);
+  Worklist worklist{symbols};
+  for (auto formula = 0UL; formula < syntax->formulas.size(); ++formula) {
+    auto const& f = syntax->formulas[formula];
+    formulas.at(f.head).push_back(formula);
+    for (auto const& symbol : f.body) {
+      if (symbol.Unfolded()) worklist.Depend(f.head, symbol.id);
+    }
+  }
+
+  worklist.Solve([&](SymbolID head) {
+    bool growing{};
+    for (auto const formula : formulas[head]) {
       auto const& f = syntax->formulas[formula];
       auto& structure = lang.structures[f.head];
 
@@ -135,7 +148,8 @@ void Skeleton::DeduceStructures(Skeleton& lang) {
         }
       }
     }
-  } while (growing);
+    return growing;
+  });
 }
 
 void Skeleton::DeduceForms(Skeleton& lang) {
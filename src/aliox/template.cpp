@@ -457,8 +457,16 @@ Template::Filter Template::Compile(std::shared_ptr<InvokeExpr> expr) {
   for (auto param : expr->params) {
     params.push_back(Compile(param));
   }
+  auto name = std::string{};
+  if (auto var = std::dynamic_pointer_cast<VariableExpr>(expr->invoke)) {
+    if (!var->anchor) name = var->variable;
+  }
   return [=](Context& ctx, Array const&) {
     auto func = invoke(ctx, {});
+    /** 模型中的同名属性不应遮蔽元数据中的过滤器，例如名为 model 的属性 */
+    if (!func.IsFilter() && !name.empty()) {
+      if (auto it = ctx.meta.find(name); it != ctx.meta.end()) func = it->second;
+    }
     auto args = Array{};
     for (auto param : params) {
       args.push_back(param(ctx, {}));
@@ -470,9 +478,16 @@ Template::Filter Template::Compile(std::shared_ptr<InvokeExpr> expr) {
 Template::Filter Template::Compile(std::shared_ptr<PipeExpr> expr) {
   auto rhs = Compile(expr->pipe);
   auto lhs = Compile(expr->expr);
+  auto name = std::string{};
+  if (auto var = std::dynamic_pointer_cast<VariableExpr>(expr->pipe)) {
+    if (!var->anchor) name = var->variable;
+  }
   return [=](Context& ctx, Array const&) {
     auto value = lhs(ctx, {});
     auto pipe = rhs(ctx, {});
+    if (!pipe.IsFilter() && !name.empty()) {
+      if (auto it = ctx.meta.find(name); it != ctx.meta.end()) pipe = it->second;
+    }
     return pipe.GetFilter()(ctx, {value});
   };
 }
@@ -504,6 +519,8 @@ bool Template::Value::Truthy() const {
           return false;
         } else if constexpr (std::is_same_v<T, Boolean>) {
           return value;
+        } else if constexpr (std::is_same_v<T, Integer>) {
+          return value != 0;
         } else if constexpr (std::is_same_v<T, Number>) {
           return value != 0;
         } else if constexpr (std::is_same_v<T, String>) {
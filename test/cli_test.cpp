@@ -1 +1,192 @@
-#include "cli/cli.h"
\ No newline at end of file
+#include "cli/cli.h"
+
+#include <unistd.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <vector>
+
+#include "alioth-cli/syntax.h"
+#include "alioth/alioth.h"
+#include "gtest/gtest.h"
+
+namespace alioth {
+namespace test {
+
+namespace {
+
+/**
+ * 运行命令行工具，标准输出写入 output，返回退出码
+ *
+ * @param args 命令行参数
+ * @param output 标准输出重定向的文件
+ * @param env 仅对命令行工具生效的环境变量，形如 NAME=value
+ */
+int Cli(std::string const& args, std::filesystem::path const& output,
+        std::string const& env = {}) {
+  auto const command =
+      fmt::format("{} {} {} > {} 2>/dev/null", env, ALIOTH_TEST_CLI, args,
+                  output.string());
+  auto const status = std::system(command.c_str());
+  return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+std::string ReadFile(std::filesystem::path const& path) {
+  std::ifstream ifs(path, std::ios::binary);
+  return {std::istreambuf_iterator<char>(ifs), {}};
+}
+
+}  // namespace
+
+TEST(Cli, SyntaxCache) {
+  /**
+   * 缓存目录只通过子进程的环境变量指定，不修改当前进程的环境
+   * 当前进程的 AliothCache 可能已经初始化，不能用来定位缓存
+   */
+  auto const home = std::filesystem::temp_directory_path() /
+                    fmt::format("alioth-cache-test-{}", getpid());
+  auto const env = fmt::format("XDG_CACHE_HOME={}", home.string());
+  auto const dir = home / "alioth" / "syntax";
+  auto const entries = [&] {
+    std::vector<std::filesystem::path> paths;
+    std::error_code ec;
+    for (auto it = std::filesystem::directory_iterator(dir, ec);
+         !ec && it != std::filesystem::directory_iterator{}; it.increment(ec)) {
+      paths.push_back(it->path());
+    }
+    return paths;
+  };
+
+  auto const grammar = [&](std::string const& name, std::string const& opts) {
+    auto const path = home / fmt::format("{}.grammar", name);
+    std::filesystem::create_directories(home);
+    std::ofstream(path) << fmt::format(
+        "lang: \"{}\"\n{}\nID = /[a-z]+/\n{} -> ID@name;\n", name, opts,
+        name);
+    return path.string();
+  };
+
+  /**
+   * 惰性构造的词法规则不能输出镜像，加载时跳过缓存而不是失败
+   */
+  auto const lazy = grammar("lazy", "lazy: true");
+  EXPECT_EQ(Cli(fmt::format("skeleton {}", lazy), home / "output", env), 0);
+  EXPECT_TRUE(entries().empty());
+
+  /**
+   * 缓存的是二进制镜像，命中时映射镜像，输出与重新编译的一致
+   */
+  auto const eager = grammar("eager", "");
+  auto const compiled = home / "compiled.img";
+  ASSERT_EQ(Cli(fmt::format("syntax -b {}", eager), compiled, env), 0);
+  auto const cached = entries();
+  ASSERT_EQ(cached.size(), 1UL);
+  EXPECT_EQ(cached.front().extension(), ".img");
+  auto const entry = ReadFile(cached.front());
+  EXPECT_TRUE(entry.starts_with(ReadFile(compiled)));
+
+  auto const mapped = home / "mapped.img";
+  ASSERT_EQ(Cli(fmt::format("syntax -b {}", eager), mapped, env), 0);
+  EXPECT_EQ(ReadFile(mapped), ReadFile(compiled));
+  EXPECT_EQ(entries(), cached);
+
+  /**
+   * 输出 json 需要状态表，不读取缓存
+   */
+  auto const json = home / "syntax.json";
+  EXPECT_EQ(Cli(fmt::format("syntax {}", eager), json, env), 0);
+  EXPECT_EQ(::Syntax::Load(json.string(), 1, false)->Image(),
+            ReadFile(compiled));
+
+  /**
+   * 文件名只是键的哈希值，同名文件中是其他语法的镜像时不使用
+   * 无论镜像是否带有键，都重新编译并覆盖缓存
+   */
+  auto const other = grammar("other", "");
+  auto const image = home / "other.img";
+  ASSERT_EQ(Cli(fmt::format("syntax -b {}", other), image, env), 0);
+  auto const planted = entries();
+  ASSERT_EQ(planted.size(), 2UL);
+  auto const copied = planted.front() == cached.front() ? planted.back()
+                                                        : planted.front();
+  for (auto const& source : {image, copied}) {
+    std::filesystem::copy_file(
+        source, cached.front(),
+        std::filesystem::copy_options::overwrite_existing);
+    auto const output = home / "planted.img";
+    ASSERT_EQ(Cli(fmt::format("syntax -b {}", eager), output, env), 0)
+        << source;
+    EXPECT_EQ(ReadFile(output), ReadFile(compiled)) << source;
+    EXPECT_EQ(ReadFile(cached.front()), entry) << source;
+  }
+
+  std::filesystem::remove_all(home);
+}
+
+TEST(Cli, Image) {
+  auto const home = std::filesystem::temp_directory_path() /
+                    fmt::format("alioth-image-test-{}", getpid());
+  std::filesystem::create_directories(home);
+  auto const grammar =
+      (AliothHome() / "grammar" / "template.grammar").string();
+
+  /**
+   * 镜像只能重新输出为镜像，且与原镜像一致；从镜像生成的框架与从文法生成的一致
+   */
+  auto const image = home / "syntax.img";
+  ASSERT_EQ(Cli(fmt::format("syntax -b --no-cache {}", grammar), image), 0);
+  EXPECT_EQ(Cli(fmt::format("syntax {}", image.string()), home / "output"), 1);
+  auto const again = home / "again.img";
+  EXPECT_EQ(Cli(fmt::format("syntax -b {}", image.string()), again), 0);
+  EXPECT_EQ(ReadFile(again), ReadFile(image));
+
+  auto const expected = home / "expected";
+  ASSERT_EQ(Cli(fmt::format("framework --no-cache -o {} {}", expected.string(),
+                            grammar),
+                home / "output"),
+            0);
+  auto const actual = home / "actual";
+  ASSERT_EQ(Cli(fmt::format("framework -o {} {}", actual.string(),
+                            image.string()),
+                home / "output"),
+            0);
+  for (auto const& entry :
+       std::filesystem::recursive_directory_iterator(expected)) {
+    if (!entry.is_regular_file()) continue;
+    auto const relative = entry.path().lexically_relative(expected);
+    EXPECT_EQ(ReadFile(actual / relative), ReadFile(entry.path())) << relative;
+  }
+
+  std::filesystem::remove_all(home);
+}
+
+TEST(Cli, Jobs) {
+  auto const home = std::filesystem::temp_directory_path() /
+                    fmt::format("alioth-jobs-test-{}", getpid());
+  std::filesystem::create_directories(home);
+  auto const grammar = (AliothHome() / "grammar" / "grammar.grammar").string();
+
+  /**
+   * 所有命令的 -j 0 都表示由硬件决定线程数，非数字的值被拒绝
+   */
+  auto const expected = home / "expected.json";
+  ASSERT_EQ(Cli(fmt::format("syntax --no-cache -j 1 {}", grammar), expected),
+            0);
+  auto const actual = home / "actual.json";
+  EXPECT_EQ(Cli(fmt::format("syntax --no-cache -j 0 {}", grammar), actual), 0);
+  EXPECT_EQ(ReadFile(actual), ReadFile(expected));
+
+  auto const out = home / "out";
+  for (auto const command :
+       {"syntax --no-cache {}", "framework --no-cache -o {1} {0}",
+        "parse --no-cache -g {0} {0}", "tokenize --no-cache -g {0} {0}"}) {
+    auto const args = fmt::format(fmt::runtime(command), grammar, out.string());
+    EXPECT_EQ(Cli(fmt::format("{} -j 0", args), home / "output"), 0) << args;
+    EXPECT_EQ(Cli(fmt::format("{} -j x", args), home / "output"), 1) << args;
+  }
+
+  std::filesystem::remove_all(home);
+}
+
+}  // namespace test
+}  // namespace alioth
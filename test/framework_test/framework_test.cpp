@@ -0,0 +1,214 @@
+#include "alioth-cli/framework.h"
+
+#include <unistd.h>
+
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "alioth/alioth.h"
+#include "aliox/grammar.h"
+#include "grammar/syntax.h"
+#include "gtest/gtest.h"
+#include "keyword/syntax.h"
+#include "manifest/syntax.h"
+#include "opt/syntax.h"
+#include "play/syntax.h"
+#include "template/syntax.h"
+
+namespace alioth {
+namespace test {
+
+namespace {
+
+std::string ReadFile(std::filesystem::path const& path) {
+  std::stringstream ss;
+  ss << std::ifstream(path).rdbuf();
+  return ss.str();
+}
+
+}  // namespace
+
+TEST(Framework, Synthetic) {
+  auto const path =
+      AliothHome() / "test" / "framework_test" / "opt.grammar";
+  auto syntax = Grammar::Load(Document::Read(path)).Compile();
+
+  /**
+   * 可省符号的辅助非终结符是合成符号，不出现在生成的代码中
+   */
+  auto const helper = syntax->FindSymbol("A'a");
+  EXPECT_TRUE(syntax->IsSynthetic(helper));
+  EXPECT_TRUE(syntax->IsSynthetic(syntax->FindSymbol("B'")));
+  EXPECT_FALSE(syntax->IsSynthetic(syntax->FindSymbol("stmt")));
+  EXPECT_FALSE(syntax->IsSynthetic(syntax->FindSymbol("A")));
+
+  auto const output = std::filesystem::path(ALIOTH_TEST_FRAMEWORK) / "opt";
+  auto const header = ReadFile(output / "include" / "opt" / "syntax.h");
+  auto const source = ReadFile(output / "src" / "syntax.cpp");
+  EXPECT_NE(header.find("constexpr alioth::SymbolID kStmt ="), header.npos);
+  for (auto const& text : {header, source}) {
+    EXPECT_EQ(text.find('\''), text.npos);
+    EXPECT_EQ(text.find('?'), text.npos);
+  }
+}
+
+TEST(Framework, Parse) {
+  /**
+   * 生成的框架随测试一同编译，可省的属性在缺省时为空
+   */
+  auto const opt = ::opt::ParseOpt(Document::Create("a b c; c;"));
+  ASSERT_EQ(opt->stmts.size(), 2UL);
+  auto const first = opt->stmts.at(0).As<::opt::StmtNode>();
+  auto const second = opt->stmts.at(1).As<::opt::StmtNode>();
+  EXPECT_EQ(first->a->Text(), "a");
+  EXPECT_EQ(first->c->Text(), "c");
+  EXPECT_FALSE(second->a);
+  EXPECT_EQ(second->c->Text(), "c");
+}
+
+TEST(Framework, Keyword) {
+  /**
+   * 关键字由生成的 Resolve 识别，C++ 关键字命名的属性追加下划线
+   */
+  auto const path = AliothHome() / "test" / "framework_test" / "keyword.txt";
+  auto const keyword = ::keyword::ParseKeyword(Document::Read(path));
+  ASSERT_EQ(keyword->stmts.size(), 6UL);
+  auto const first = keyword->stmts.at(0).As<::keyword::StmtNode>();
+  auto const value = first->value.As<::keyword::ExprNode>();
+  EXPECT_EQ(value->lhs->Text(), "a");
+  EXPECT_EQ(value->rhs->Text(), "b");
+  auto const second = keyword->stmts.at(1).As<::keyword::StmtNode>();
+  EXPECT_EQ(second->name->Text(), "letter");
+  EXPECT_EQ(second->value.As<::keyword::ExprNode>()->if_->id, ::keyword::IF);
+  auto const fifth = keyword->stmts.at(4).As<::keyword::StmtNode>();
+  EXPECT_EQ(fifth->name->Text(), "in");
+}
+
+TEST(Framework, Clash) {
+  /**
+   * 驼峰形式相同的非终结符会生成同名的常量和类型
+   */
+  auto clash = Grammar::Load(Document::Create(R"(
+    lang: "clash"
+
+    A = /a/
+    B = /b/
+    C = /c/
+
+    clash -> a_b@x B | a__b@x C;
+    a_b -> A;
+    a__b -> A;
+  )")).Compile();
+  auto const output = std::filesystem::temp_directory_path() /
+                      fmt::format("alioth-framework-test-{}", getpid());
+  EXPECT_THROW(Framework::Generate(clash, output), std::runtime_error);
+  std::filesystem::remove_all(output);
+}
+
+TEST(Framework, Example) {
+  auto const example = AliothHome() / "examples" / "programming_language";
+  auto syntax =
+      Grammar::Load(Document::Read(example / "play.grammar")).Compile();
+
+  /**
+   * 示例中提交的框架代码与当前模板生成的一致
+   */
+  auto const output = std::filesystem::temp_directory_path() /
+                      fmt::format("alioth-framework-example-{}", getpid());
+  Framework::Generate(syntax, output);
+  for (auto const file : {"include/play/syntax.h", "src/syntax.cpp",
+                          "src/scanner.cpp"}) {
+    EXPECT_EQ(ReadFile(output / file), ReadFile(example / file)) << file;
+  }
+  std::filesystem::remove_all(output);
+
+  /**
+   * 示例中提交的框架代码随测试一同编译，能够解析示例源码
+   */
+  auto const play =
+      ::play::ParsePlay(Document::Read(example / "test.play"));
+  ASSERT_FALSE(play->stmts.empty());
+  auto const stmt = play->stmts.front().As<::play::StmtNode>();
+  auto const fn = stmt->function.As<::play::FunctionNode>();
+  EXPECT_EQ(fn->name->Text(), "main");
+}
+
+TEST(Framework, Scan) {
+  using Scanner = Lexicon::Token (*)(std::string_view, size_t, ContextID);
+  struct Case {
+    std::filesystem::path grammar;
+    Scanner scan;
+    std::vector<std::filesystem::path> samples;
+  };
+
+  auto const home = AliothHome();
+  auto const templates = home / "templates" / "skeleton" / "cpp";
+  auto const example = home / "examples" / "programming_language";
+  auto const cases = std::vector<Case>{
+      {home / "test" / "framework_test" / "opt.grammar", &::opt::Scan, {}},
+      {home / "test" / "framework_test" / "keyword.grammar",
+       &::keyword::Scan,
+       {home / "test" / "framework_test" / "keyword.txt"}},
+      {home / "grammar" / "grammar.grammar",
+       &::grammar::Scan,
+       {home / "grammar" / "grammar.grammar",
+        home / "grammar" / "template.grammar", example / "play.grammar"}},
+      {home / "grammar" / "template.grammar",
+       &::template_::Scan,
+       {templates / "syntax.h.template", templates / "syntax.cpp.template",
+        templates / "scanner.cpp.template"}},
+      {home / "examples" / "marking_language" / "manifest.grammar",
+       &::manifest::Scan,
+       {home / "examples" / "marking_language" / "example.manifest"}},
+      {example / "play.grammar", &::play::Scan, {example / "test.play"}},
+  };
+
+  /**
+   * 越界的上下文在两者中都抛出 out_of_range，以空值表示
+   */
+  auto const attempt = [](auto&& scan) -> std::optional<Lexicon::Token> {
+    try {
+      return scan();
+    } catch (std::out_of_range const&) {
+      return std::nullopt;
+    }
+  };
+
+  /**
+   * 生成的直接编码扫描器（含关键字查找）与 Lexicon::Scan 在每个上下文、
+   * 每个偏移量上产生相同的单词；额外的全字节文本覆盖无法识别的输入
+   */
+  std::string bytes;
+  for (auto c = 0; c < 256; ++c) bytes += static_cast<char>(c);
+  for (auto const& [grammar, scan, samples] : cases) {
+    auto const lex = Grammar::Load(Document::Read(grammar)).Compile()->lex;
+    auto texts = std::vector<std::string>{bytes};
+    for (auto const& sample : samples) texts.push_back(ReadFile(sample));
+
+    for (auto const& text : texts) {
+      for (auto ctx = 0UL; ctx <= lex->contexts.size(); ++ctx) {
+        auto const context = static_cast<ContextID>(ctx);
+        for (auto offset = 0UL; offset <= text.size(); ++offset) {
+          auto const expected =
+              attempt([&] { return lex->Scan(text, offset, context); });
+          auto const actual =
+              attempt([&] { return scan(text, offset, context); });
+          ASSERT_EQ(actual.has_value(), expected.has_value())
+              << grammar << " context " << ctx << " offset " << offset;
+          if (!expected) break;
+          ASSERT_EQ(actual->id, expected->id)
+              << grammar << " context " << ctx << " offset " << offset;
+          ASSERT_EQ(actual->length, expected->length)
+              << grammar << " context " << ctx << " offset " << offset;
+        }
+      }
+    }
+  }
+}
+
+}  // namespace test
+}  // namespace alioth
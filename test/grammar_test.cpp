@@ -61,5 +61,105 @@ TEST(Grammar, Form) {
   ASSERT_EQ(syntax->formulas.at(4).form, "assigned");
 }
 
+TEST(Grammar, Optional) {
+  auto gdoc = Document::Create(R"(
+    lang: "opt"
+
+    A = /a/
+    B = /b/
+    C = /c/
+    D = /d/
+    SEMI = /;/
+    SPACE ?= /\s+/
+
+    opt -> stmt@stmts | ...opt stmt@stmts;
+    stmt -> A?@a B? C?@c D@d A?@a SEMI;
+  )");
+
+  auto source = Document::Create("a b c d a; d; b d; c d a;");
+
+  auto grammar = Grammar::Load(gdoc);
+  auto expand = grammar.Compile();
+  grammar.options["optional"] = "nullable";
+  auto nullable = grammar.Compile();
+  ASSERT_EQ(expand->formulas.size(), 3 + 16);
+  ASSERT_EQ(nullable->formulas.size(), 3 + 1 + 3 * 2);
+
+  auto expected = Parser(expand, source).Parse()->Store({});
+  auto actual = Parser(nullable, source).Parse()->Store({});
+  EXPECT_EQ(expected, actual);
+  EXPECT_EQ(actual["opt"]["stmts"][0]["a"].size(), 2);
+
+  grammar.options["optional"] = "unknown";
+  EXPECT_THROW(grammar.Compile(), std::runtime_error);
+
+  /**
+   * 辅助非终结符的空产生式与 A 的移进冲突，该可省符号改回展开方式
+   */
+  auto conflict = Grammar::Load(Document::Create(R"(
+    lang: "conflict"
+
+    A = /a/
+    B = /b/
+    SPACE ?= /\s+/
+
+    n -> A?@x A@y B;
+  )"));
+  auto const text = Document::Create("a a b");
+  auto const fallback = Document::Create("a b");
+  auto const strict = conflict.Compile();
+  conflict.options["optional"] = "nullable";
+  auto const relaxed = conflict.Compile();
+  EXPECT_EQ(relaxed->Store(), strict->Store());
+  for (auto const& doc : {text, fallback}) {
+    EXPECT_EQ(Parser(relaxed, doc).Parse()->Store({}),
+              Parser(strict, doc).Parse()->Store({}));
+  }
+
+  /**
+   * 展开方式同样存在的冲突照常报告
+   */
+  auto ambiguous = Grammar::Load(Document::Create(R"(
+    lang: "ambiguous"
+
+    A = /a/
+
+    n -> A?@x A?@y;
+  )"));
+  EXPECT_THROW(ambiguous.Compile(), Syntactic::Builder::ReduceReduceConflict);
+  ambiguous.options["optional"] = "nullable";
+  EXPECT_THROW(ambiguous.Compile(), Syntactic::Builder::ReduceReduceConflict);
+}
+
+TEST(Grammar, LalrNote) {
+  auto grammar = Grammar::Load(Document::Create(R"(
+    lang: "lalr"
+    lalr: true
+
+    A = /a/
+    B = /b/
+    C = /c/
+    D = /d/
+    E = /e/
+
+    lalr -> A x D | A y E | B y D | B x E;
+    x -> C;
+    y -> C;
+  )"));
+
+  /**
+   * 合并引入冲突时保留LR(1)状态机，冲突作为说明交给调用者
+   */
+  std::vector<std::string> notes;
+  auto const kept = grammar.Compile(1, &notes);
+  ASSERT_EQ(notes.size(), 1UL);
+  EXPECT_NE(notes.front().find("keep LR(1) states"), std::string::npos);
+
+  grammar.options["lalr"] = false;
+  notes.clear();
+  EXPECT_EQ(grammar.Compile(1, &notes)->states.size(), kept->states.size());
+  EXPECT_TRUE(notes.empty());
+}
+
 }  // namespace test
 }  // namespace alioth
\ No newline at end of file
@@ -129,5 +129,211 @@ TEST(Lexicon, Complex) {
   }
 }
 
+TEST(Lexicon, Table) {
+  auto lex = Lexicon::Builder("test")
+                 .Define("IF", "if"_regex)
+                 .Define("ID", "[a-zA-Z_][a-zA-Z0-9_]*"_regex)
+                 .Define("NUM", "\\d+"_regex)
+                 .Define("SPACE", "\\s+"_regex)
+                 .Build();
+  auto const& table = *lex->table;
+  ASSERT_LT(table.width, 256);
+  ASSERT_EQ(table.accepts.size(), lex->states.size());
+
+  for (auto state = 1UL; state < lex->states.size(); ++state) {
+    auto const& st = lex->states.at(state);
+    EXPECT_EQ(table.accepts[state],
+              st.accepts.value_or(Lexicon::Table::kReject));
+    for (auto c = 0; c < 256; ++c) {
+      auto const ch = static_cast<char>(c);
+      auto it = st.transitions.find(ch);
+      auto expected = it == st.transitions.end() ? 0 : it->second;
+      auto cls = table.classes[c];
+      EXPECT_EQ(table.transitions[state * table.width + cls], expected);
+    }
+  }
+
+  auto token = lex->Scan("if x1 ?", 0, 0);
+  EXPECT_EQ(lex->NameOf(token.id), "IF");
+  EXPECT_EQ(token.length, 2);
+  token = lex->Scan("if x1 ?", 3, 0);
+  EXPECT_EQ(lex->NameOf(token.id), "ID");
+  EXPECT_EQ(token.length, 2);
+  token = lex->Scan("if x1 ?", 6, 0);
+  EXPECT_EQ(token.id, Lexicon::kERR);
+  token = lex->Scan("if x1 ?", 7, 0);
+  EXPECT_EQ(token.id, Lexicon::kEOF);
+}
+
+TEST(Lexicon, Skip) {
+  auto lex = Lexicon::Builder("test")
+                 .Define("COMMENT", "#[^\\n]*"_regex)
+                 .Define("SPACE", "\\s+"_regex)
+                 .Define("ID", "\\w+"_regex)
+                 .Build();
+  auto const& table = *lex->table;
+  auto skipping = 0UL;
+  for (auto const& skip : table.skips) {
+    if (!skip.count) continue;
+    skipping++;
+    EXPECT_LE(skip.count, Lexicon::Table::Skip::kMaxBytes);
+  }
+  EXPECT_EQ(skipping, 2UL);
+
+  for (auto length : {0UL, 1UL, 15UL, 16UL, 17UL, 31UL, 32UL, 33UL, 100UL}) {
+    auto const body = std::string(length, 'c');
+    auto token = lex->Scan("#" + body + "\n  x", 0, 0);
+    EXPECT_EQ(lex->NameOf(token.id), "COMMENT");
+    EXPECT_EQ(token.length, length + 1);
+    token = lex->Scan("#" + body, 0, 0);
+    EXPECT_EQ(token.length, length + 1);
+
+    auto const spaces = std::string(length + 1, ' ');
+    token = lex->Scan("x" + spaces + "x", 1, 0);
+    EXPECT_EQ(lex->NameOf(token.id), "SPACE");
+    EXPECT_EQ(token.length, length + 1);
+  }
+}
+
+TEST(Lexicon, Keywords) {
+  auto make = [](bool keywords) {
+    return Lexicon::Builder("test")
+        .Keywords(keywords)
+        .Define("LET", "let"_regex)
+        .Define("IN", "in"_regex, {"other"})
+        .Define("ID", "[a-z]+"_regex)
+        .Define("LE", "<="_regex)
+        .Define("FOR", "for"_regex)
+        .Define("SPACE", "\\s+"_regex)
+        .Build();
+  };
+  auto raw = make(false);
+  auto kw = make(true);
+  ASSERT_LT(kw->states.size(), raw->states.size());
+  EXPECT_EQ(kw->terms[kw->FindSymbol("LET")].keyword, "let");
+  EXPECT_EQ(kw->terms[kw->FindSymbol("IN")].keyword, "in");
+  EXPECT_TRUE(kw->terms[kw->FindSymbol("LE")].keyword.empty());
+
+  std::string const source = "let in lets for <= inlet";
+  for (ContextID context = 0; context < 2; ++context) {
+    auto offset = 0UL;
+    while (offset < source.size()) {
+      auto expected = raw->Scan(source, offset, context);
+      auto actual = kw->Scan(source, offset, context);
+      ASSERT_EQ(actual.id, expected.id);
+      ASSERT_EQ(actual.length, expected.length);
+      offset += expected.length;
+    }
+  }
+
+  auto builder = Lexicon::Builder("test");
+  builder.Keyword("LE")
+      .Define("LE", "<="_regex)
+      .Define("ID", "[a-z]+"_regex);
+  EXPECT_THROW(builder.Build(), Lexicon::Builder::InvalidKeyword);
+}
+
+TEST(Lexicon, Lazy) {
+  auto make = [](size_t budget) {
+    return Lexicon::Builder("test")
+        .Lazy(budget)
+        .Keyword("LET")
+        .Define("LET", "let"_regex)
+        .Define("FOR", "for|foreach"_regex, {"other"})
+        .Define("ID", "[a-z]+"_regex)
+        .Define("NUM", "\\d+(\\.\\d+)?"_regex)
+        .Define("COMMENT", "#[^\\n]*"_regex)
+        .Define("SPACE", "\\s+"_regex)
+        .Build();
+  };
+  auto eager = make(0);
+  auto lazy = make(Lexicon::Lazy::kDefaultBudget);
+  auto tiny = make(1);
+  ASSERT_TRUE(lazy->lazy);
+  ASSERT_TRUE(lazy->states.empty());
+  EXPECT_THROW(lazy->Store(), Lexicon::NotMaterialized);
+
+  std::string const source = "let x = 12.5 foreach fo # note\n lets 3. ?";
+  for (ContextID context = 0; context < 2; ++context) {
+    for (auto offset = 0UL; offset <= source.size(); ++offset) {
+      auto expected = eager->Scan(source, offset, context);
+      for (auto const& lex : {lazy, tiny}) {
+        auto actual = lex->Scan(source, offset, context);
+        ASSERT_EQ(actual.id, expected.id);
+        ASSERT_EQ(actual.length, expected.length);
+      }
+    }
+  }
+  EXPECT_EQ(lazy->lazy->flushes, 0UL);
+  EXPECT_GT(lazy->lazy->States(), 1UL);
+  EXPECT_GT(tiny->lazy->flushes, 0UL);
+}
+
+TEST(Lexicon, Contexts) {
+  auto lex = Lexicon::Builder("test")
+                 .Keywords(true)
+                 .Define("IN", "in"_regex, {"test", "other"})
+                 .Define("ID", "[a-z]+"_regex)
+                 .Define("STR", "\"[^\"]*\""_regex, {"other"})
+                 .Define("SPACE", "\\s+"_regex)
+                 .Build();
+  std::vector<ContextID> const contexts = {1, 0, 1};
+  std::vector<Lexicon::Token> tokens;
+  std::vector<Lexicon::Token> joined;
+  auto const product = lex->Join(contexts);
+  ASSERT_NE(product, nullptr);
+  EXPECT_EQ(product->arity, 2U);
+
+  std::string const source = "in \"in x\" inx \"";
+  for (auto offset = 0UL; offset <= source.size(); ++offset) {
+    lex->Scan(source, offset, contexts, tokens);
+    lex->Scan(source, offset, *product, joined);
+    ASSERT_EQ(tokens.size(), contexts.size());
+    ASSERT_EQ(joined.size(), contexts.size());
+    for (auto i = 0UL; i < contexts.size(); ++i) {
+      auto expected = lex->Scan(source, offset, contexts[i]);
+      EXPECT_EQ(tokens[i].id, expected.id);
+      EXPECT_EQ(tokens[i].length, expected.length);
+      EXPECT_EQ(joined[i].id, expected.id);
+      EXPECT_EQ(joined[i].length, expected.length);
+    }
+  }
+  EXPECT_EQ(lex->Join(std::vector<ContextID>{1, 1}), nullptr);
+
+  for (ContextID const unknown : {ContextID(2), ContextID(-1)}) {
+    EXPECT_THROW(lex->Scan(source, 0, unknown), std::out_of_range);
+    EXPECT_THROW(lex->Scan(source, 0, {0, unknown}, tokens), std::out_of_range);
+    EXPECT_THROW(lex->Join(std::vector<ContextID>{0, unknown}),
+                 std::out_of_range);
+  }
+}
+
+TEST(Lexicon, Minimize) {
+  auto make = [](bool minimize) {
+    return Lexicon::Builder("test")
+        .Minimize(minimize)
+        .Define("AB", "ab"_regex)
+        .Define("CB", "cb"_regex, {"other"})
+        .Define("XY", "x(a|b)*|y(a|b)*"_regex)
+        .Define("SPACE", "\\s+"_regex)
+        .Build();
+  };
+  auto raw = make(false);
+  auto min = make(true);
+  ASSERT_LT(min->states.size(), raw->states.size());
+
+  std::string const source = "ab xabba cb yb ab";
+  for (ContextID context = 0; context < 2; ++context) {
+    auto offset = 0UL;
+    while (offset < source.size()) {
+      auto expected = raw->Scan(source, offset, context);
+      auto actual = min->Scan(source, offset, context);
+      ASSERT_EQ(actual.id, expected.id);
+      ASSERT_EQ(actual.length, expected.length);
+      offset += expected.length;
+    }
+  }
+}
+
 }  // namespace test
 }  // namespace alioth
\ No newline at end of file
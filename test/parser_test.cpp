@@ -3,6 +3,7 @@
 #include "alioth/regex.h"
 #include "alioth/strings.h"
 #include "alioth/syntax.h"
+#include "aliox/grammar.h"
 #include "fmt/ranges.h"
 #include "gtest/gtest.h"
 #include "nlohmann/json.hpp"
@@ -79,5 +80,250 @@ TEST(Parser, Simple) {
   ASSERT_EQ(tokenized, source);
 }
 
+TEST(Parser, Scanner) {
+  auto lex = Lexicon::Builder("prog")
+                 .Define("ID", "[a-z]+"_regex)
+                 .Define("SPACE", "\\s+"_regex)
+                 .Define("SEMI", ";"_regex)
+                 .Build();
+  auto syntax = Syntactic::Builder(lex)
+                    .Ignore("SPACE")
+                    .Formula("prog")
+                    .Symbol("stmt", "stmts")
+                    .Commit()
+                    .Formula("prog")
+                    .Symbol("prog", "...")
+                    .Symbol("stmt", "stmts")
+                    .Commit()
+                    .Formula("stmt")
+                    .Symbol("ID", "name")
+                    .Symbol("SEMI")
+                    .Commit()
+                    .Build();
+  auto doc = Document::Create("a; bc;\n d;");
+
+  auto scanned = 0UL;
+  auto parser = Parser(syntax, doc);
+  parser.UseScanner(
+      [&](std::string_view text, size_t offset, ContextID context) {
+        scanned++;
+        return lex->Scan(text, offset, context);
+      });
+  auto root = parser.Parse();
+  auto stmts = root->Attr("prog")->Attrs("stmts");
+  ASSERT_EQ(stmts.size(), 3);
+  EXPECT_EQ(stmts[1]->Attr("name")->Text(), "bc");
+  EXPECT_GE(scanned, 9UL);
+  EXPECT_EQ(parser.Stats().misses, scanned);
+}
+
+TEST(Parser, DropIgnored) {
+  auto lex = Lexicon::Builder("prog")
+                 .Define("ID", "[a-z]+"_regex)
+                 .Define("SPACE", "\\s+"_regex)
+                 .Define("COMMENT", "#[^\\n]*"_regex)
+                 .Define("SEMI", ";"_regex)
+                 .Build();
+  auto syntax = Syntactic::Builder(lex)
+                    .Ignore("SPACE")
+                    .Ignore("COMMENT")
+                    .Formula("prog")
+                    .Symbol("stmt", "stmts")
+                    .Commit()
+                    .Formula("prog")
+                    .Symbol("prog", "...")
+                    .Symbol("stmt", "stmts")
+                    .Commit()
+                    .Formula("stmt")
+                    .Symbol("ID", "name")
+                    .Symbol("SEMI")
+                    .Commit()
+                    .Build();
+  auto doc = Document::Create("# head\na ;\n  bc # tail\n;\n d;\n");
+
+  auto keep = Parser(syntax, doc).Parse();
+  auto parser = Parser(syntax, doc);
+  parser.DropIgnored(true);
+  auto drop = parser.Parse();
+  EXPECT_EQ(drop->Store({}), keep->Store({}));
+
+  std::string tokenized;
+  for (auto const& token : drop->Store({.flatten = true})) {
+    tokenized += token.get<std::string>();
+  }
+  EXPECT_EQ(tokenized, "a;bc;d;");
+}
+
+TEST(Parser, Atoms) {
+  auto lex = Lexicon::Builder("prog")
+                 .Define("ID", "[a-z]+"_regex)
+                 .Define("NUM", "\\d+"_regex)
+                 .Define("SPACE", "\\s+"_regex)
+                 .Define("SEMI", ";"_regex)
+                 .Annotate("ID", "intern", true)
+                 .Build();
+  auto syntax = Syntactic::Builder(lex)
+                    .Ignore("SPACE")
+                    .Formula("prog")
+                    .Symbol("stmt", "stmts")
+                    .Commit()
+                    .Formula("prog")
+                    .Symbol("prog", "...")
+                    .Symbol("stmt", "stmts")
+                    .Commit()
+                    .Formula("stmt")
+                    .Symbol("ID", "name")
+                    .Symbol("NUM", "value")
+                    .Symbol("SEMI")
+                    .Commit()
+                    .Build();
+  auto atoms = std::make_shared<Atoms>();
+  auto parser = Parser(syntax, Document::Create("ab 1; cd 2; ab 3;"));
+  parser.UseAtoms(atoms);
+  auto stmts = parser.Parse()->Attr("prog")->Attrs("stmts");
+  ASSERT_EQ(stmts.size(), 3);
+  auto a = stmts[0]->Attr("name")->Atom();
+  auto c = stmts[1]->Attr("name")->Atom();
+  EXPECT_NE(a, Atoms::kNone);
+  EXPECT_NE(a, c);
+  EXPECT_EQ(stmts[2]->Attr("name")->Atom(), a);
+  EXPECT_EQ(stmts[0]->Attr("value")->Atom(), Atoms::kNone);
+  EXPECT_EQ(atoms->Size(), 2);
+  EXPECT_EQ(atoms->Text(c), "cd");
+
+  auto other = Parser(syntax, Document::Create("cd 4;"));
+  other.UseAtoms(atoms);
+  auto root = other.Parse();
+  EXPECT_EQ(root->Attr("prog")->Attrs("stmts")[0]->Attr("name")->Atom(), c);
+  EXPECT_EQ(atoms->Find("ef"), Atoms::kNone);
+}
+
+TEST(Parser, Memo) {
+  auto gdoc = Document::Create(R"(
+    lang: "leak"
+
+    A<leak> = /a/
+    B<X> = /a/
+    C<leak> = /c/
+    D<X> = /d/
+    W = /w/
+    Z = /z/
+
+    leak -> x@x W Z | y@y W;
+    x -> A C@c {
+      c.tokenize: { "type": "FROM_X" }
+    } | A D;
+    y -> B C@c | B D;
+  )");
+  auto syntax = Grammar::Load(gdoc).Compile();
+
+  /**
+   * 经由 x 的分析线路会失败，它写入的标注属性不应出现在 y 的终结符上
+   */
+  auto parser = Parser(syntax, Document::Create("acw"));
+  auto root = parser.Parse()->Store({.unfold = true});
+  EXPECT_EQ(root["leak"]["y"]["c"], "c");
+  EXPECT_GT(parser.Stats().hits, 0UL);
+}
+
+TEST(Parser, DefaultReduce) {
+  auto lex = Lexicon::Builder("test")
+                 .Define("ID", "[a-z]+"_regex)
+                 .Define("ADD", "\\+"_regex)
+                 .Define("SPACE", "\\s+"_regex)
+                 .Build();
+  auto syntax = Syntactic::Builder(lex)
+                    .Ignore("SPACE")
+                    .Formula("expr")
+                    .Symbol("expr")
+                    .Symbol("ADD")
+                    .Symbol("ID")
+                    .Commit()
+                    .Formula("expr")
+                    .Symbol("ID")
+                    .Commit()
+                    .Build();
+
+  /**
+   * expr -> ID 是默认归约，出错时仍报告归约前的状态
+   */
+  testing::internal::CaptureStderr();
+  EXPECT_THROW(Parser(syntax, Document::Create("a b")).Parse(),
+               Parser::ParseError);
+  auto const error = testing::internal::GetCapturedStderr();
+  EXPECT_NE(error.find("last symbol was ID (a)"), std::string::npos) << error;
+  EXPECT_NE(error.find("expected one of <EOF>, ADD\n"), std::string::npos)
+      << error;
+}
+
+TEST(Parser, DefaultReduceIgnored) {
+  auto lex = Lexicon::Builder("test")
+                 .Define("A", "a"_regex)
+                 .Define("B", "b"_regex, {"p"})
+                 .Define("C", "c"_regex)
+                 .Define("D", "d"_regex, {"q"})
+                 .Define("E", "e"_regex)
+                 .Define("SPACE", "\\s+"_regex)
+                 .Build();
+  auto syntax = Syntactic::Builder(lex)
+                    .Ignore("SPACE")
+                    .Lalr(true)
+                    .Formula("s")
+                    .Symbol("A")
+                    .Symbol("x")
+                    .Symbol("B")
+                    .Commit()
+                    .Formula("s")
+                    .Symbol("C")
+                    .Symbol("x")
+                    .Symbol("D")
+                    .Commit()
+                    .Formula("x")
+                    .Symbol("E")
+                    .Commit()
+                    .Build();
+
+  /**
+   * x -> E 所在的状态合并了两种展望符号，默认归约后的状态只接受 B
+   * 被忽略的空白不触发默认归约，B 仍在合并状态的全部上下文中扫描
+   */
+  std::map<size_t, std::set<ContextID>> scanned;  // 扫描位置 -> 上下文
+  auto parser = Parser(syntax, Document::Create("a e b"));
+  parser.UseScanner(
+      [&](std::string_view text, size_t offset, ContextID context) {
+        scanned[offset].insert(context);
+        return lex->Scan(text, offset, context);
+      });
+  auto root = parser.Parse()->Store({.unfold = true});
+  EXPECT_EQ(scanned[4].size(), 2UL);
+  EXPECT_EQ(scanned[4], scanned[3]);
+}
+
+TEST(Parser, DefaultReduceIgnoredAhead) {
+  auto gdoc = Document::Create(R"(
+    lang: "lines"
+
+    ID = /[a-z]+/
+    NL ?= /\n/
+
+    lines -> ...lines? stmt@stmts;
+    stmt -> x@x NL;
+    x -> ID@id;
+  )");
+  auto syntax = Grammar::Load(gdoc).Compile();
+
+  /**
+   * x -> ID 是默认归约，规则显式使用了被忽略的 NL，仍须以 NL 为展望符号归约
+   */
+  auto doc = Document::Create("ab\ncd\n");
+  auto root = Parser(syntax, doc).Parse()->Store({.unfold = true});
+  ASSERT_EQ(root["lines"]["stmts"].size(), 2UL);
+  EXPECT_EQ(root["lines"]["stmts"][1]["x"]["id"], "cd");
+  EXPECT_EQ(Parser(Syntactic::View(syntax->Image()), doc)
+                .Parse()
+                ->Store({.unfold = true}),
+            root);
+}
+
 }  // namespace test
 }  // namespace alioth
\ No newline at end of file
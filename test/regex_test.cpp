@@ -74,5 +74,48 @@ TEST(Regex, Match) {
   }
 }
 
+TEST(Regex, Error) {
+  EXPECT_THROW(RegexTree::Compile("[a-z"), RegexTree::InvalidRange);
+  EXPECT_THROW(RegexTree::Compile("[\\D]"), RegexTree::InvalidRange);
+  EXPECT_THROW(RegexTree::Compile("ab\\"), RegexTree::InvalidEscape);
+  EXPECT_THROW(RegexTree::Compile(""), RegexTree::InvalidPattern);
+  EXPECT_THROW(RegexTree::Compile("a|"), RegexTree::InvalidPattern);
+  EXPECT_THROW(RegexTree::Compile("*a"), RegexTree::InvalidPattern);
+  EXPECT_THROW(RegexTree::Compile("(a"), RegexTree::InvalidPattern);
+  EXPECT_THROW(RegexTree::Compile("a)"), RegexTree::InvalidPattern);
+  EXPECT_THROW(RegexTree::Compile("()"), RegexTree::InvalidPattern);
+
+  auto const stacked = "a*+"_regex;
+  auto positive = std::dynamic_pointer_cast<RegexTree::PositiveNode>(stacked);
+  EXPECT_TRUE(positive);
+  EXPECT_TRUE(
+      std::dynamic_pointer_cast<RegexTree::KleeneNode>(positive->child_));
+}
+
+TEST(Regex, Arena) {
+  RegexTree::Arena arena{};
+  auto const root = arena.Add("(a|b)*abb"_regex);
+  auto const accept = arena.Accept(root, 1);
+  using Positions = std::vector<uint32_t>;
+
+  EXPECT_FALSE(arena.nodes[root].nullable);
+  auto const first = arena.nodes[root].firstpos;
+  EXPECT_EQ(Positions(arena.begin(first), arena.end(first)),
+            Positions({0, 1, 2}));
+  auto const last = arena.nodes[root].lastpos;
+  EXPECT_EQ(Positions(arena.begin(last), arena.end(last)), Positions({4}));
+
+  EXPECT_EQ(arena.positions[0].followpos, Positions({0, 1, 2}));
+  EXPECT_EQ(arena.positions[1].followpos, Positions({0, 1, 2}));
+  EXPECT_EQ(arena.positions[2].followpos, Positions({3}));
+  EXPECT_EQ(arena.positions[3].followpos, Positions({4}));
+  EXPECT_EQ(arena.positions[4].followpos, Positions({accept}));
+  EXPECT_EQ(arena.positions[accept].accept, 1UL);
+
+  EXPECT_TRUE(arena.positions[0].chars.test('a'));
+  EXPECT_FALSE(arena.positions[0].chars.test('b'));
+  EXPECT_EQ(arena.positions[accept].chars.count(), 0UL);
+}
+
 }  // namespace test
 }  // namespace alioth
\ No newline at end of file
@@ -0,0 +1,83 @@
+#include "alioth/strings.h"
+
+#include "gtest/gtest.h"
+
+namespace alioth {
+namespace test {
+
+TEST(Strings, CharSetRange) {
+  auto const digits = CharSet::Range('0', '9');
+  EXPECT_EQ(digits.count(), 10);
+  EXPECT_TRUE(digits.Contains('0'));
+  EXPECT_TRUE(digits.Contains('9'));
+  EXPECT_FALSE(digits.Contains('/'));
+  EXPECT_FALSE(digits.Contains(':'));
+  EXPECT_EQ(digits.First(), '0');
+
+  // 端点顺序不影响结果
+  EXPECT_EQ(CharSet::Range('9', '0'), digits);
+
+  // 高位字节作为有符号字符参与比较，与 Chars::Range 一致
+  auto const high = CharSet::Range('\x80', '\xff');
+  EXPECT_EQ(high.count(), 128);
+  EXPECT_TRUE(high.Contains('\x80'));
+  EXPECT_TRUE(high.Contains('\xff'));
+  EXPECT_FALSE(high.Contains('\x7f'));
+  EXPECT_FALSE(high.Contains('\0'));
+  EXPECT_EQ(high.First(), 0x80);
+
+  // 跨越符号边界的范围: -1 ~ 1 即 0xff, 0x00, 0x01
+  auto const across = CharSet::Range('\xff', '\x01');
+  EXPECT_EQ(across.count(), 3);
+  EXPECT_TRUE(across.Contains('\xff'));
+  EXPECT_TRUE(across.Contains('\0'));
+  EXPECT_TRUE(across.Contains('\x01'));
+  EXPECT_FALSE(across.Contains('\xfe'));
+  EXPECT_EQ(across.First(), 0);
+
+  for (auto const& [from, to] : {std::pair{'a', 'z'}, std::pair{'\x80', 'A'},
+                                 std::pair{'\xfe', '\xff'}}) {
+    EXPECT_EQ(CharSet::Range(from, to), CharSet(Chars::Range(from, to)))
+        << int(from) << " ~ " << int(to);
+  }
+}
+
+TEST(Strings, CharSetComplement) {
+  auto const word = CharSet(Chars::Word());
+  CharSet const other = ~word;
+  EXPECT_EQ(word.count() + other.count(), 256);
+  EXPECT_EQ((word & other).count(), 0);
+  EXPECT_TRUE((word | other).all());
+  EXPECT_TRUE(other.Contains('\0'));
+  EXPECT_TRUE(other.Contains('\xff'));
+  EXPECT_FALSE(other.Contains('_'));
+  EXPECT_EQ(other.First(), 0);
+  EXPECT_EQ(~other, word);
+
+  EXPECT_EQ(CharSet{}.First(), 256);
+  EXPECT_EQ(CharSet(~CharSet{}).First(), 0);
+}
+
+TEST(Strings, CharSetString) {
+  auto const set = CharSet(std::string("b\xe4\xb8\xad" "a\0b", 6));
+  EXPECT_EQ(set.count(), 6);
+  EXPECT_TRUE(set.Contains('a'));
+  EXPECT_TRUE(set.Contains('b'));
+  EXPECT_TRUE(set.Contains('\0'));
+  EXPECT_TRUE(set.Contains('\xe4'));
+  EXPECT_TRUE(set.Contains('\xb8'));
+  EXPECT_TRUE(set.Contains('\xad'));
+  EXPECT_FALSE(set.Contains('c'));
+  EXPECT_EQ(set.First(), 0);
+
+  EXPECT_EQ(CharSet(std::string{}), CharSet{});
+  EXPECT_EQ(CharSet(Chars::Any()), ~CharSet{}.Insert('\0'));
+
+  auto inserted = CharSet{};
+  inserted.Insert('\xad').Insert('\xe4').Insert('\xb8');
+  EXPECT_EQ(inserted.First(), 0xad);
+  EXPECT_EQ(inserted | CharSet(std::string("ab")) | CharSet(std::string(1, '\0')), set);
+}
+
+}  // namespace test
+}  // namespace alioth
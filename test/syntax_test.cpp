@@ -1,5 +1,10 @@
 #include "alioth/syntax.h"
 
+#include <algorithm>
+#include <cstring>
+
+#include "alioth/alioth.h"
+#include "alioth/parser.h"
 #include "alioth/regex.h"
 #include "aliox/grammar.h"
 #include "fmt/ranges.h"
@@ -81,5 +86,284 @@ TEST(Syntactic, ReduceShift) {
                     .Build();
 }
 
+TEST(Syntactic, Table) {
+  auto syntax = Grammar::SyntaxOf();
+  auto const& table = *syntax->table;
+  auto const symbols = syntax->lex->terms.size() + syntax->ntrms.size();
+  for (StateID id = 0; id < syntax->states.size(); ++id) {
+    auto const& state = syntax->states.at(id);
+    auto const fallback = table.defaults[id];
+    for (SymbolID sym = 0; sym < symbols; ++sym) {
+      auto action = table.Find(id, sym);
+      if (action == Syntactic::Table::kNone && fallback != table.kNone) {
+        action = fallback | table.kReduce;
+      }
+      if (state.shift.contains(sym)) {
+        EXPECT_EQ(action, state.shift.at(sym));
+      } else if (state.reduce.contains(sym)) {
+        EXPECT_EQ(action, state.reduce.at(sym) | table.kReduce);
+      } else if (fallback == table.kNone) {
+        EXPECT_EQ(action, table.kNone);
+      }
+    }
+  }
+}
+
+TEST(Syntactic, Jobs) {
+  /**
+   * 并行构造的状态编号和表格必须与顺序构造完全一致
+   */
+  for (auto const path : {"grammar/grammar.grammar", "grammar/template.grammar",
+                          "examples/programming_language/play.grammar",
+                          "examples/marking_language/manifest.grammar"}) {
+    auto grammar = Grammar::Load(Document::Read(AliothHome() / path));
+    for (auto const lalr : {false, true}) {
+      grammar.options["lalr"] = lalr;
+      auto const expected = grammar.Compile(1)->Store();
+      for (auto const jobs : {2UL, 3UL, 8UL, 0UL}) {
+        EXPECT_EQ(grammar.Compile(jobs)->Store(), expected)
+            << path << " lalr: " << lalr << " jobs: " << jobs;
+      }
+    }
+  }
+}
+
+TEST(Syntactic, Image) {
+  auto syntax = Grammar::SyntaxOf();
+  auto const image = syntax->Image();
+  auto view = Syntactic::View(image);
+  EXPECT_TRUE(view->states.empty());
+  EXPECT_THROW(view->Store(), Syntactic::NotMaterialized);
+
+  auto doc = Document::Read(AliothHome() / "grammar" / "template.grammar");
+  auto const expected = Parser(syntax, doc).Parse()->Store({});
+  EXPECT_EQ(Parser(view, doc).Parse()->Store({}), expected);
+
+  auto broken = image;
+  broken.resize(broken.size() / 2);
+  EXPECT_THROW(Syntactic::View(broken), Syntactic::InvalidImage);
+
+  /**
+   * 文件头的 24 字节之后依次是各段的偏移量和大小，各 8 字节
+   * 段的顺序为元数据、等价类、入口、转移、接受、跳跃、关键字、
+   * 偏移量、默认归约、检查、动作、上下文起点、上下文
+   */
+  auto corrupt = [&](size_t section, auto edit) {
+    auto copy = image;
+    uint64_t extent[2];
+    std::memcpy(extent, copy.data() + 24 + section * 16, sizeof(extent));
+    edit(copy.data() + extent[0], extent[1]);
+    return copy;
+  };
+  auto const last = [](char* data, size_t size) {
+    uint32_t value;
+    std::memcpy(&value, data + size - 4, 4);
+    value++;
+    std::memcpy(data + size - 4, &value, 4);
+  };
+  auto const fill = [](char* data, size_t size) {
+    std::fill(data, data + size, '\x7f');
+  };
+  EXPECT_THROW(Syntactic::View(corrupt(3, fill)), Syntactic::InvalidImage);
+  EXPECT_THROW(Syntactic::View(corrupt(8, fill)), Syntactic::InvalidImage);
+  EXPECT_THROW(Syntactic::View(corrupt(10, fill)), Syntactic::InvalidImage);
+  EXPECT_THROW(Syntactic::View(corrupt(11, last)), Syntactic::InvalidImage);
+}
+
+TEST(Syntactic, Join) {
+  auto home = AliothHome();
+  auto gdoc = Document::Read(home / "grammar" / "template.grammar");
+  auto syntax = Grammar::Load(gdoc).Compile();
+  auto const image = syntax->Image();
+  auto view = Syntactic::View(image);
+
+  /**
+   * 乘积状态机在首次扫描多个上下文时才构造，上下文列表相同的状态共用同一个
+   */
+  EXPECT_TRUE(view->table->joined.empty());
+  auto doc = Document::Read(home / "templates/skeleton/cpp/syntax.h.template");
+  auto const expected = Parser(syntax, doc).Parse()->Store({});
+  EXPECT_EQ(Parser(view, doc).Parse()->Store({}), expected);
+  EXPECT_FALSE(view->table->joined.empty());
+
+  std::map<std::vector<ContextID>, std::shared_ptr<Lexicon::Product const>>
+      seen;
+  for (StateID state = 0; state < view->table->bases.size(); ++state) {
+    auto const scope = view->table->Contexts(state);
+    auto const product = view->table->Join(state, *view->lex);
+    if (scope.size() < 2) {
+      EXPECT_EQ(product, nullptr);
+      continue;
+    }
+    ASSERT_NE(product, nullptr);
+    auto const key = std::vector<ContextID>(scope.begin(), scope.end());
+    EXPECT_EQ(seen.emplace(key, product).first->second, product);
+  }
+  EXPECT_EQ(seen.size(), view->table->joined.size());
+}
+
+TEST(Syntactic, Lalr) {
+  auto lex = Lexicon::Builder("test")
+                 .Define("ID", "[a-z]+"_regex)
+                 .Define("ADD", "\\+"_regex)
+                 .Define("MUL", "\\*"_regex)
+                 .Define("LP", "\\("_regex)
+                 .Define("RP", "\\)"_regex)
+                 .Define("SPACE", "\\s+"_regex)
+                 .Build();
+  auto define = [&](bool lalr) {
+    Syntactic::Builder builder(lex);
+    builder.Ignore("SPACE")
+        .Lalr(lalr)
+        .Formula("expr")
+        .Symbol("expr")
+        .Symbol("ADD")
+        .Symbol("term")
+        .Commit()
+        .Formula("expr")
+        .Symbol("term")
+        .Commit()
+        .Formula("term")
+        .Symbol("term")
+        .Symbol("MUL")
+        .Symbol("factor")
+        .Commit()
+        .Formula("term")
+        .Symbol("factor")
+        .Commit()
+        .Formula("factor")
+        .Symbol("LP")
+        .Symbol("expr")
+        .Symbol("RP")
+        .Commit()
+        .Formula("factor")
+        .Symbol("ID")
+        .Commit();
+    return builder.Build();
+  };
+  auto lr1 = define(false);
+  auto lalr = define(true);
+  EXPECT_LT(lalr->states.size(), lr1->states.size());
+
+  auto doc = Document::Create("a * (b + c) * d + e");
+  auto expected = Parser(lr1, doc).Parse()->Store({});
+  EXPECT_EQ(Parser(lalr, doc).Parse()->Store({}), expected);
+}
+
+TEST(Syntactic, Nullable) {
+  auto lex = Lexicon::Builder("test")
+                 .Define("A", "a"_regex)
+                 .Define("B", "b"_regex)
+                 .Define("C", "c"_regex)
+                 .Build();
+
+  /**
+   * 可空的 opt 位于 list 末尾，list 之后的展望符号需要穿过 opt 传播
+   */
+  auto syntax = Syntactic::Builder(lex)
+                    .Formula("prog")
+                    .Symbol("list", "items")
+                    .Symbol("C")
+                    .Commit()
+                    .Formula("list")
+                    .Commit()
+                    .Formula("list")
+                    .Symbol("list", "...")
+                    .Symbol("A", "items")
+                    .Symbol("opt")
+                    .Commit()
+                    .Formula("opt")
+                    .Commit()
+                    .Formula("opt")
+                    .Symbol("B")
+                    .Commit()
+                    .Build();
+  for (auto source : {"c", "ac", "aabac", "abababc"}) {
+    auto root = Parser(syntax, Document::Create(source)).Parse();
+    EXPECT_EQ(root->Attr("test")->Text(), source);
+  }
+}
+
+TEST(Syntactic, LalrConflict) {
+  auto lex = Lexicon::Builder("test")
+                 .Define("A", "a"_regex)
+                 .Define("B", "b"_regex)
+                 .Define("C", "c"_regex)
+                 .Define("D", "d"_regex)
+                 .Define("E", "e"_regex)
+                 .Build();
+  auto define = [&](Syntactic::Builder& builder, bool lalr) {
+    builder.Lalr(lalr);
+    for (auto const& [lead, x, y] : {std::tuple{"A", "x", "y"},
+                                     std::tuple{"B", "y", "x"}}) {
+      builder.Formula("s").Symbol(lead).Symbol(x).Symbol("D").Commit();
+      builder.Formula("s").Symbol(lead).Symbol(y).Symbol("E").Commit();
+    }
+    builder.Formula("x").Symbol("C").Commit();
+    builder.Formula("y").Symbol("C").Commit();
+    return builder.Build();
+  };
+
+  /**
+   * 合并状态会引入归约-归约冲突，因此保留LR(1)状态机并记录冲突
+   */
+  auto lr1 = Syntactic::Builder(lex);
+  auto lalr = Syntactic::Builder(lex);
+  EXPECT_EQ(define(lalr, true)->states.size(),
+            define(lr1, false)->states.size());
+  EXPECT_FALSE(lr1.MergeConflict());
+  ASSERT_TRUE(lalr.MergeConflict());
+  EXPECT_NE(lalr.MergeConflict()->find("reduce-reduce conflict"),
+            std::string::npos);
+}
+
+TEST(Syntactic, IndirectLeftRecursion) {
+  auto lex = Lexicon::Builder("test")
+                 .Define("A", "a"_regex)
+                 .Define("B", "b"_regex)
+                 .Define("C", "c"_regex)
+                 .Build();
+
+  /**
+   * s 与 t 互为前缀，FIRST集合需要在两者之间传播
+   */
+  auto syntax = Syntactic::Builder(lex)
+                    .Formula("s")
+                    .Symbol("t")
+                    .Symbol("C")
+                    .Commit()
+                    .Formula("s")
+                    .Symbol("A")
+                    .Commit()
+                    .Formula("t")
+                    .Symbol("s")
+                    .Symbol("B")
+                    .Commit()
+                    .Build();
+  for (auto source : {"a", "abc", "abcbcbc"}) {
+    auto root = Parser(syntax, Document::Create(source)).Parse();
+    EXPECT_EQ(root->Attr("test")->Text(), source);
+  }
+
+  /**
+   * 只在彼此之间循环推导的非终结符推导不出任何句子
+   */
+  auto circular = [&] {
+    Syntactic::Builder(lex)
+        .Formula("s")
+        .Symbol("x")
+        .Commit()
+        .Formula("x")
+        .Symbol("y")
+        .Commit()
+        .Formula("y")
+        .Symbol("x")
+        .Symbol("A")
+        .Commit()
+        .Build();
+  };
+  EXPECT_THROW(circular(), Syntactic::Builder::CircularFirstError);
+}
+
 }  // namespace test
 }  // namespace alioth
\ No newline at end of file
@@ -52,6 +52,36 @@ TEST(Template, Expressions) {
   ASSERT_EQ(result, expected);
 }
 
+TEST(Template, Shadow) {
+  /**
+   * 模型中与过滤器同名的变量不影响调用和管道运算
+   */
+  Template::Map model{};
+  model["var"] = Template::Value{"hello"};
+  model["obj"] = Template::Map{{"name", "World"}};
+  model["arr"] = Template::Array{{"a", "b", "c"}};
+  model["func"] = Template::Value{"func"};
+  model["upper"] = Template::Map{{"name", "upper"}};
+
+  Template::Map meta{};
+  meta["func"] = Template::Filter{[](auto&, auto const& args) {
+    std::vector<std::string> strings;
+    for (auto const& arg : args) strings.push_back(arg.TextOf());
+    return fmt::format("{}", fmt::join(strings, "---"));
+  }};
+  meta["upper"] = Template::Filter{[](auto&, auto const& args) {
+    auto text = args.front().TextOf();
+    for (auto& c : text) c = std::toupper(c);
+    return text;
+  }};
+
+  auto path = AliothHome() / "test" / "template_test" / "expr.template";
+  auto result = Template::Render(path, model, meta);
+
+  EXPECT_NE(result.find("函数调用 1---2---hello"), std::string::npos);
+  EXPECT_NE(result.find("管道运算 HELLO"), std::string::npos);
+}
+
 TEST(Template, Branch) {
   Template::Map model{};
   model["obj"] = Template::Map{{"name", "World"}};
@@ -0,0 +1,119 @@
+#include "alioth/tokenizer.h"
+
+#include "alioth/regex.h"
+#include "gtest/gtest.h"
+
+namespace alioth {
+namespace test {
+
+TEST(Tokenizer, Batch) {
+  auto lex = Lexicon::Builder("test")
+                 .Define("ID", "[a-z]+"_regex)
+                 .Define("SPACE", "\\s+"_regex)
+                 .Build();
+  auto doc = Document::Create("ab c ? def");
+  auto tokenizer = Tokenizer(lex, doc);
+  auto batch = Tokenizer::Batch{};
+
+  std::vector<std::string> names;
+  std::vector<size_t> offsets;
+  std::vector<size_t> lengths;
+  while (tokenizer.Next(batch, 3)) {
+    EXPECT_LE(batch.Size(), 3UL);
+    for (auto i = 0UL; i < batch.Size(); ++i) {
+      names.push_back(lex->NameOf(batch.ids[i]));
+      offsets.push_back(batch.offsets[i]);
+      lengths.push_back(batch.lengths[i]);
+    }
+  }
+  EXPECT_TRUE(tokenizer.Done());
+  EXPECT_EQ(names, (std::vector<std::string>{"ID", "SPACE", "ID", "SPACE",
+                                             "<ERR>", "SPACE", "ID"}));
+  EXPECT_EQ(offsets, (std::vector<size_t>{0, 2, 3, 4, 5, 6, 7}));
+  EXPECT_EQ(lengths, (std::vector<size_t>{2, 1, 1, 1, 1, 1, 3}));
+}
+
+TEST(Tokenizer, Switch) {
+  auto lex = Lexicon::Builder("test")
+                 .Define("QUOTE", "\""_regex)
+                 .Define("ID", "[a-z]+"_regex)
+                 .Define("TEXT", "[^\"]+"_regex, {"string"})
+                 .Build();
+  auto const quote = lex->FindSymbol("QUOTE");
+  auto doc = Document::Create("a\"b c\"d");
+  auto tokenizer = Tokenizer(lex, doc).Switch(
+      [&](SymbolID term, ContextID context) -> ContextID {
+        return term == quote ? 1 - context : context;
+      });
+  auto batch = Tokenizer::Batch{};
+  ASSERT_EQ(tokenizer.Next(batch), 5UL);
+
+  std::vector<std::string> names;
+  for (auto id : batch.ids) names.push_back(lex->NameOf(id));
+  EXPECT_EQ(names, (std::vector<std::string>{"ID", "QUOTE", "TEXT", "QUOTE",
+                                             "ID"}));
+  EXPECT_EQ(batch.lengths[2], 3UL);
+  EXPECT_EQ(tokenizer.Next(batch), 0UL);
+}
+
+TEST(Tokenizer, All) {
+  auto lex = Lexicon::Builder("test")
+                 .Define("ID", "[a-z]+"_regex)
+                 .Define("COMMENT", "#[^\\n]*"_regex)
+                 .Define("SPACE", "\\s+"_regex)
+                 .Build();
+  std::string source{};
+  for (auto i = 0; i < 200; ++i) {
+    source += std::string(i % 7 + 1, 'a') + std::string(i % 3 + 1, ' ');
+    if (i % 9 == 0) source += "# comment " + std::string(i, 'c') + "\n";
+  }
+  auto doc = Document::Create(source);
+
+  auto expected = Tokenizer::Batch{};
+  Tokenizer(lex, doc).All(expected, 1);
+  for (auto jobs : {2UL, 3UL, 7UL, 64UL, source.size()}) {
+    auto batch = Tokenizer::Batch{};
+    auto tokenizer = Tokenizer(lex, doc);
+    ASSERT_EQ(tokenizer.All(batch, jobs), expected.Size());
+    EXPECT_EQ(batch.ids, expected.ids);
+    EXPECT_EQ(batch.offsets, expected.offsets);
+    EXPECT_EQ(batch.lengths, expected.lengths);
+    EXPECT_TRUE(tokenizer.Done());
+  }
+}
+
+TEST(Tokenizer, AllLazy) {
+  auto make = [](size_t budget) {
+    return Lexicon::Builder("test")
+        .Lazy(budget)
+        .Define("ID", "[a-z]+"_regex)
+        .Define("NUM", "\\d+(\\.\\d+)?"_regex)
+        .Define("COMMENT", "#[^\\n]*"_regex)
+        .Define("SPACE", "\\s+"_regex)
+        .Build();
+  };
+  std::string source{};
+  for (auto i = 0; i < 2000; ++i) {
+    source += std::string(i % 7 + 1, 'a' + i % 26) + " " + std::to_string(i);
+    source += i % 5 ? " " : ".5 ";
+    if (i % 9 == 0) source += "# comment " + std::string(i % 50, 'c') + "\n";
+  }
+  auto doc = Document::Create(source);
+
+  auto expected = Tokenizer::Batch{};
+  Tokenizer(make(0), doc).All(expected, 1);
+  for (auto budget : {Lexicon::Lazy::kDefaultBudget, 1UL}) {
+    auto lex = make(budget);
+    ASSERT_TRUE(lex->lazy);
+    for (auto jobs : {1UL, 4UL, 16UL}) {
+      auto batch = Tokenizer::Batch{};
+      ASSERT_EQ(Tokenizer(lex, doc).All(batch, jobs), expected.Size());
+      EXPECT_EQ(batch.ids, expected.ids);
+      EXPECT_EQ(batch.offsets, expected.offsets);
+      EXPECT_EQ(batch.lengths, expected.lengths);
+    }
+  }
+}
+
+}  // namespace test
+}  // namespace alioth